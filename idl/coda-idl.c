@@ -44,6 +44,7 @@
 #include "coda.h"
 
 static int coda_idl_option_filter_record_fields = 1;
+static int coda_idl_option_struct_arrays = 0;
 static int coda_idl_option_swap_dimensions = 1;
 static int coda_idl_option_time_unit_days = 0;
 static int coda_idl_option_verbose = 1;
@@ -1646,8 +1647,9 @@ static int idl_coda_fetch_datahandle_scalar_filldata(struct IDL_CodaDataHandle *
     return 0;
 }
 
+/* skip_field can be used to skip fields that were already filled (see idl_coda_fetch_struct_array_filldata()) */
 static int idl_coda_fetch_datahandle_record_filldata(struct IDL_CodaDataHandle *datahandle, IDL_StructDefPtr sdef,
-                                                     char *data)
+                                                     char *data, const char *skip_field)
 {
     coda_type *record_type;
     long num_fields;
@@ -1706,6 +1708,11 @@ static int idl_coda_fetch_datahandle_record_filldata(struct IDL_CodaDataHandle *
                     include_field = 0;
                 }
             }
+            if (include_field && skip_field != NULL && skip_field[i])
+            {
+                field_index++;
+                include_field = 0;
+            }
             if (include_field)
             {
                 coda_type_class type_class;
@@ -1740,7 +1747,8 @@ static int idl_coda_fetch_datahandle_record_filldata(struct IDL_CodaDataHandle *
                 {
                     case coda_record_class:
                         /* This will expand the record in-situ, recursively */
-                        if (idl_coda_fetch_datahandle_record_filldata(datahandle, field_info->value.s.sdef, fill) != 0)
+                        if (idl_coda_fetch_datahandle_record_filldata(datahandle, field_info->value.s.sdef, fill,
+                                                                     NULL) != 0)
                         {
                             return -1;
                         }
@@ -1830,7 +1838,467 @@ static int idl_coda_fetch_datahandle_record_to_VPTR(struct IDL_CodaDataHandle *d
     }
     data = IDL_MakeTempStructVector(sdef, 1, &tmpval, IDL_TRUE);
 
-    if (idl_coda_fetch_datahandle_record_filldata(datahandle, sdef, data) != 0)
+    if (idl_coda_fetch_datahandle_record_filldata(datahandle, sdef, data, NULL) != 0)
+    {
+        IDL_Deltmp(tmpval);
+        return -1;
+    }
+
+    *retval = tmpval;
+    return 0;
+}
+
+/* returns 1 if all data items of the given type map to the same IDL structure definition, 0 if not, -1 on error */
+static int idl_coda_type_has_fixed_struct_layout(coda_type *type)
+{
+    coda_type_class type_class;
+
+    if (coda_type_get_class(type, &type_class) != 0)
+    {
+        return -1;
+    }
+    if (coda_get_option_bypass_special_types() && type_class == coda_special_class)
+    {
+        if (coda_type_get_special_base_type(type, &type) != 0)
+        {
+            return -1;
+        }
+        if (coda_type_get_class(type, &type_class) != 0)
+        {
+            return -1;
+        }
+    }
+    switch (type_class)
+    {
+        case coda_record_class:
+            {
+                long num_included_fields = 0;
+                long num_fields;
+                int is_union;
+                long i;
+
+                if (coda_type_get_record_union_status(type, &is_union) != 0)
+                {
+                    return -1;
+                }
+                if (is_union)
+                {
+                    return 0;
+                }
+                if (coda_type_get_num_record_fields(type, &num_fields) != 0)
+                {
+                    return -1;
+                }
+                for (i = 0; i < num_fields; i++)
+                {
+                    coda_type *field_type;
+                    int available;
+                    int result;
+
+                    if (coda_idl_option_filter_record_fields)
+                    {
+                        int hidden;
+
+                        if (coda_type_get_record_field_hidden_status(type, i, &hidden) != 0)
+                        {
+                            return -1;
+                        }
+                        if (hidden)
+                        {
+                            continue;
+                        }
+                    }
+                    if (coda_type_get_record_field_available_status(type, i, &available) != 0)
+                    {
+                        return -1;
+                    }
+                    if (available != 1)
+                    {
+                        /* optional fields are only included in the structure if they are available */
+                        return 0;
+                    }
+                    if (coda_type_get_record_field_type(type, i, &field_type) != 0)
+                    {
+                        return -1;
+                    }
+                    result = idl_coda_type_has_fixed_struct_layout(field_type);
+                    if (result != 1)
+                    {
+                        return result;
+                    }
+                    num_included_fields++;
+                }
+                if (num_included_fields == 0)
+                {
+                    return 0;
+                }
+            }
+            break;
+        case coda_array_class:
+            {
+                long dim[CODA_MAX_NUM_DIMS];
+                int num_dims;
+                int i;
+
+                /* the base type does not matter, since the array is stored as an IDL array of a fixed type */
+                if (coda_type_get_array_dim(type, &num_dims, dim) != 0)
+                {
+                    return -1;
+                }
+                for (i = 0; i < num_dims; i++)
+                {
+                    if (dim[i] < 0)
+                    {
+                        return 0;
+                    }
+                }
+            }
+            break;
+        case coda_raw_class:
+            {
+                int64_t bit_size;
+
+                if (coda_type_get_bit_size(type, &bit_size) != 0)
+                {
+                    return -1;
+                }
+                if (bit_size < 0)
+                {
+                    return 0;
+                }
+            }
+            break;
+        case coda_integer_class:
+        case coda_real_class:
+        case coda_text_class:
+        case coda_special_class:
+            break;
+    }
+
+    return 1;
+}
+
+/* returns the type with which a record field can be read for all elements of an array of records at once, or
+ * coda_native_type_not_available if the field needs to be read element by element.
+ * This is only done for binary records with a fixed size, since only for those the position of the field within each
+ * array element can be calculated directly.
+ */
+static coda_native_type idl_coda_fetch_get_field_array_read_type(coda_type *record_type, long field_index,
+                                                                 int *is_time)
+{
+    coda_native_type read_type;
+    coda_type_class type_class;
+    coda_format format;
+    coda_type *type;
+    int64_t bit_size;
+
+    *is_time = 0;
+    if (coda_type_get_format(record_type, &format) != 0 || coda_type_get_bit_size(record_type, &bit_size) != 0)
+    {
+        return coda_native_type_not_available;
+    }
+    if (format != coda_format_binary || bit_size < 0)
+    {
+        return coda_native_type_not_available;
+    }
+    if (coda_type_get_record_field_type(record_type, field_index, &type) != 0 ||
+        coda_type_get_class(type, &type_class) != 0)
+    {
+        return coda_native_type_not_available;
+    }
+    if (coda_get_option_bypass_special_types() && type_class == coda_special_class)
+    {
+        if (coda_type_get_special_base_type(type, &type) != 0 || coda_type_get_class(type, &type_class) != 0)
+        {
+            return coda_native_type_not_available;
+        }
+    }
+    switch (type_class)
+    {
+        case coda_integer_class:
+        case coda_real_class:
+            if (coda_type_get_read_type(type, &read_type) != 0)
+            {
+                return coda_native_type_not_available;
+            }
+            if (read_type == coda_native_type_int8)
+            {
+                /* IDL has no signed 8 bit type, so these are read as int16 */
+                return coda_native_type_int16;
+            }
+            return read_type;
+        case coda_special_class:
+            {
+                coda_special_type special_type;
+
+                if (coda_type_get_special_type(type, &special_type) != 0)
+                {
+                    return coda_native_type_not_available;
+                }
+                if (special_type == coda_special_vsf_integer || special_type == coda_special_time)
+                {
+                    *is_time = (special_type == coda_special_time);
+                    return coda_native_type_double;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+
+    return coda_native_type_not_available;
+}
+
+static int idl_coda_fetch_struct_array_filldata(struct IDL_CodaDataHandle *datahandle, IDL_StructDefPtr sdef,
+                                                char *data, IDL_MEMINT element_size, int num_dims, const long dim[],
+                                                coda_type *record_type, long number_of_elements)
+{
+    long num_fields;
+    long field_index;
+    long num_element_fields;
+    char *skip_field;
+    char *buffer;
+    long i;
+
+    if (coda_type_get_num_record_fields(record_type, &num_fields) != 0)
+    {
+        return -1;
+    }
+    skip_field = (char *)malloc(num_fields);
+    if (skip_field == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)num_fields, __FILE__, __LINE__);
+        return -1;
+    }
+    buffer = (char *)malloc(number_of_elements * sizeof(double));
+    if (buffer == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(number_of_elements * sizeof(double)), __FILE__, __LINE__);
+        free(skip_field);
+        return -1;
+    }
+
+    /* read the numeric fields column-wise for all array elements at once and scatter them into the structures */
+    num_element_fields = 0;
+    field_index = -1;
+    for (i = 0; i < num_fields; i++)
+    {
+        coda_native_type read_type;
+        const char *field_name;
+        IDL_VPTR field_info;
+        IDL_MEMINT offset;
+        int value_size;
+        int is_time;
+        int result;
+        long j;
+
+        skip_field[i] = 0;
+        if (coda_idl_option_filter_record_fields)
+        {
+            int hidden;
+
+            if (coda_type_get_record_field_hidden_status(record_type, i, &hidden) != 0)
+            {
+                free(buffer);
+                free(skip_field);
+                return -1;
+            }
+            if (hidden)
+            {
+                continue;
+            }
+        }
+        field_index++;
+
+        read_type = idl_coda_fetch_get_field_array_read_type(record_type, i, &is_time);
+        if (read_type == coda_native_type_not_available)
+        {
+            num_element_fields++;
+            continue;
+        }
+        if (coda_type_get_record_field_name(record_type, i, &field_name) != 0)
+        {
+            free(buffer);
+            free(skip_field);
+            return -1;
+        }
+        switch (read_type)
+        {
+            case coda_native_type_uint8:
+                value_size = 1;
+                result = coda_cursor_read_uint8_field_array(&datahandle->cursor, field_name, (uint8_t *)buffer);
+                break;
+            case coda_native_type_int16:
+                value_size = 2;
+                result = coda_cursor_read_int16_field_array(&datahandle->cursor, field_name, (int16_t *)buffer);
+                break;
+            case coda_native_type_uint16:
+                value_size = 2;
+                result = coda_cursor_read_uint16_field_array(&datahandle->cursor, field_name, (uint16_t *)buffer);
+                break;
+            case coda_native_type_int32:
+                value_size = 4;
+                result = coda_cursor_read_int32_field_array(&datahandle->cursor, field_name, (int32_t *)buffer);
+                break;
+            case coda_native_type_uint32:
+                value_size = 4;
+                result = coda_cursor_read_uint32_field_array(&datahandle->cursor, field_name, (uint32_t *)buffer);
+                break;
+            case coda_native_type_int64:
+                value_size = 8;
+                result = coda_cursor_read_int64_field_array(&datahandle->cursor, field_name, (int64_t *)buffer);
+                break;
+            case coda_native_type_uint64:
+                value_size = 8;
+                result = coda_cursor_read_uint64_field_array(&datahandle->cursor, field_name, (uint64_t *)buffer);
+                break;
+            case coda_native_type_float:
+                value_size = 4;
+                result = coda_cursor_read_float_field_array(&datahandle->cursor, field_name, (float *)buffer);
+                break;
+            default:
+                value_size = 8;
+                result = coda_cursor_read_double_field_array(&datahandle->cursor, field_name, (double *)buffer);
+                if (result == 0 && is_time && coda_idl_option_time_unit_days)
+                {
+                    for (j = 0; j < number_of_elements; j++)
+                    {
+                        ((double *)buffer)[j] = sec2day(((double *)buffer)[j]);
+                    }
+                }
+                break;
+        }
+        if (result != 0)
+        {
+            free(buffer);
+            free(skip_field);
+            return -1;
+        }
+        offset = IDL_StructTagInfoByIndex(sdef, field_index, IDL_MSG_LONGJMP, &field_info);
+        for (j = 0; j < number_of_elements; j++)
+        {
+            long index = coda_idl_option_swap_dimensions ? coda_c_index_to_fortran_index(num_dims, dim, j) : j;
+
+            memcpy(&data[index * element_size + offset], &buffer[j * value_size], value_size);
+        }
+        skip_field[i] = 1;
+    }
+    free(buffer);
+
+    /* fill the remaining fields element by element */
+    if (num_element_fields > 0)
+    {
+        if (coda_cursor_goto_first_array_element(&datahandle->cursor) != 0)
+        {
+            free(skip_field);
+            return -1;
+        }
+        for (i = 0; i < number_of_elements; i++)
+        {
+            long index = coda_idl_option_swap_dimensions ? coda_c_index_to_fortran_index(num_dims, dim, i) : i;
+
+            if (idl_coda_fetch_datahandle_record_filldata(datahandle, sdef, &data[index * element_size],
+                                                          skip_field) != 0)
+            {
+                free(skip_field);
+                return -1;
+            }
+            if (i < number_of_elements - 1)
+            {
+                if (coda_cursor_goto_next_array_element(&datahandle->cursor) != 0)
+                {
+                    free(skip_field);
+                    return -1;
+                }
+            }
+        }
+        if (coda_cursor_goto_parent(&datahandle->cursor) != 0)
+        {
+            free(skip_field);
+            return -1;
+        }
+    }
+    free(skip_field);
+
+    return 0;
+}
+
+/* returns an array of records as an array of IDL structures (if the StructArrays option is set).
+ * This is only possible if all records map to the same IDL structure definition. The structure definition is then
+ * created only once (using the first array element) and all records are filled into a single IDL array.
+ * Returns 0 on success, 1 if the records can not be represented as an array of IDL structures, and -1 on error.
+ */
+static int idl_coda_fetch_datahandle_struct_array_to_VPTR(struct IDL_CodaDataHandle *datahandle, IDL_VPTR *retval)
+{
+    coda_cursor element_cursor;
+    coda_type_class type_class;
+    coda_type *type;
+    coda_type *basetype;
+    IDL_MEMINT idl_dimspec[IDL_MAX_ARRAY_DIM];
+    IDL_StructDefPtr sdef;
+    IDL_VPTR tmpval;
+    long number_of_elements;
+    char *data;
+    long dim[IDL_MAX_ARRAY_DIM];
+    int num_dims;
+    int result;
+    int i;
+
+    if (coda_cursor_get_type(&datahandle->cursor, &type) != 0)
+    {
+        return -1;
+    }
+    if (coda_type_get_array_base_type(type, &basetype) != 0)
+    {
+        return -1;
+    }
+    if (coda_type_get_class(basetype, &type_class) != 0)
+    {
+        return -1;
+    }
+    if (type_class != coda_record_class)
+    {
+        return 1;
+    }
+    result = idl_coda_type_has_fixed_struct_layout(basetype);
+    if (result != 1)
+    {
+        return result == 0 ? 1 : -1;
+    }
+
+    number_of_elements = 1;
+    if (coda_cursor_get_array_dim(&datahandle->cursor, &num_dims, dim) != 0)
+    {
+        return -1;
+    }
+    for (i = 0; i < num_dims; i++)
+    {
+        long local_dim = coda_idl_option_swap_dimensions ? dim[i] : dim[num_dims - i - 1];
+
+        if (local_dim == 0)
+        {
+            /* leave the handling of empty arrays to idl_coda_fetch_datahandle_array_to_VPTR() */
+            return 1;
+        }
+        number_of_elements *= local_dim;
+        idl_dimspec[i] = local_dim;
+    }
+
+    element_cursor = datahandle->cursor;
+    if (coda_cursor_goto_first_array_element(&element_cursor) != 0)
+    {
+        return -1;
+    }
+    if (idl_coda_fetch_cursor_to_StructDefPtr(&element_cursor, &sdef) != 0)
+    {
+        return -1;
+    }
+
+    data = IDL_MakeTempStruct(sdef, num_dims, idl_dimspec, &tmpval, IDL_TRUE);
+    if (idl_coda_fetch_struct_array_filldata(datahandle, sdef, data, tmpval->value.s.arr->elt_len, num_dims, dim,
+                                             basetype, number_of_elements) != 0)
     {
         IDL_Deltmp(tmpval);
         return -1;
@@ -1852,6 +2320,16 @@ static int idl_coda_fetch_datahandle_to_VPTR(struct IDL_CodaDataHandle *datahand
     switch (type_class)
     {
         case coda_array_class:
+            if (coda_idl_option_struct_arrays)
+            {
+                int result;
+
+                result = idl_coda_fetch_datahandle_struct_array_to_VPTR(datahandle, retval);
+                if (result != 1)
+                {
+                    return result;
+                }
+            }
             return idl_coda_fetch_datahandle_array_to_VPTR(datahandle, retval);
         case coda_record_class:
             return idl_coda_fetch_datahandle_record_to_VPTR(datahandle, retval);
@@ -3099,6 +3577,12 @@ static IDL_VPTR x_coda_getopt(int argc, IDL_VPTR *argv)
         retval->type = IDL_TYP_INT;
         retval->value.i = coda_get_option_perform_boundary_checks();
     }
+    else if (strcasecmp("StructArrays", name) == 0)
+    {
+        retval = IDL_Gettmp();
+        retval->type = IDL_TYP_INT;
+        retval->value.i = coda_idl_option_struct_arrays;
+    }
     else if (strcasecmp("SwapDimensions", name) == 0)
     {
         retval = IDL_Gettmp();
@@ -3175,6 +3659,13 @@ static IDL_VPTR x_coda_setopt(int argc, IDL_VPTR *argv)
         retval->value.i = coda_get_option_perform_boundary_checks();
         coda_set_option_perform_boundary_checks(value != 0);
     }
+    else if (strcasecmp("StructArrays", name) == 0)
+    {
+        retval = IDL_Gettmp();
+        retval->type = IDL_TYP_INT;
+        retval->value.i = coda_idl_option_struct_arrays;
+        coda_idl_option_struct_arrays = (value != 0);
+    }
     else if (strcasecmp("SwapDimensions", name) == 0)
     {
         retval = IDL_Gettmp();
@@ -847,6 +847,201 @@ static jdoubleArray SWIG_JavaArrayOutDouble (JNIEnv *jenv, double *result, jsize
     }
 
 
+    static void codac_throw_exception(JNIEnv *jenv, const char *function_name)
+    {
+        const char *codamsg = coda_errno_to_string(coda_errno);
+        char *fullMessage = malloc(strlen(function_name) + 4 + strlen(codamsg) + 1);
+        jclass clazz = (*jenv)->FindClass(jenv, "nl/stcorp/coda/CodaException");
+
+        sprintf(fullMessage, "%s(): %s", function_name, codamsg);
+        (*jenv)->ThrowNew(jenv, clazz, fullMessage);
+        free(fullMessage);
+    }
+
+    static void *codac_get_direct_buffer_address(JNIEnv *jenv, jobject buffer, long num_elements, long element_size)
+    {
+        void *address;
+
+        if (buffer == NULL)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "buffer argument is null");
+            return NULL;
+        }
+        address = (*jenv)->GetDirectBufferAddress(jenv, buffer);
+        if (address == NULL)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "buffer argument is not a direct buffer");
+            return NULL;
+        }
+        if ((*jenv)->GetDirectBufferCapacity(jenv, buffer) < (jlong)num_elements * element_size)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "buffer argument is too small (%ld bytes needed)",
+                           num_elements * element_size);
+            return NULL;
+        }
+        return address;
+    }
+
+    static int codac_check_array_length(JNIEnv *jenv, jarray array, long num_elements)
+    {
+        if (array == NULL)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "array argument is null");
+            return -1;
+        }
+        if ((*jenv)->GetArrayLength(jenv, array) < num_elements)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "array argument is too small (%ld elements needed)",
+                           num_elements);
+            return -1;
+        }
+        return 0;
+    }
+
+    static void *codac_alloc_read_buffer(long num_elements, long element_size)
+    {
+        void *buffer;
+
+        /* always allocate at least one byte, so a NULL result is only returned when we are out of memory */
+        buffer = malloc(num_elements > 0 ? (size_t)num_elements * element_size : 1);
+        if (buffer == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)num_elements * element_size, __FILE__, __LINE__);
+        }
+        return buffer;
+    }
+
+#define CODAC_BULK_READ_FUNCTIONS(TYPE, CTYPE, JTYPE, JNAME, JARRAYTYPE) \
+    JNIEXPORT void JNICALL Java_nl_stcorp_coda_codacJNI_cursor_1read_1##TYPE##_1array_1direct(JNIEnv *jenv, \
+        jclass jcls, jlong jcursor, jobject jdst, jint jarray_ordering) \
+    { \
+        const coda_cursor *cursor = *(coda_cursor **)&jcursor; \
+        long num_elements; \
+        void *dst; \
+        \
+        (void)jcls; \
+        if (coda_cursor_get_num_elements(cursor, &num_elements) != 0 || \
+            (dst = codac_get_direct_buffer_address(jenv, jdst, num_elements, sizeof(CTYPE))) == NULL || \
+            coda_cursor_read_##TYPE##_array(cursor, (CTYPE *)dst, (coda_array_ordering)jarray_ordering) != 0) \
+        { \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_array"); \
+        } \
+    } \
+    \
+    JNIEXPORT void JNICALL Java_nl_stcorp_coda_codacJNI_cursor_1read_1##TYPE##_1array_1region(JNIEnv *jenv, \
+        jclass jcls, jlong jcursor, JARRAYTYPE jdst, jint jarray_ordering) \
+    { \
+        const coda_cursor *cursor = *(coda_cursor **)&jcursor; \
+        long num_elements; \
+        CTYPE *dst; \
+        \
+        (void)jcls; \
+        if (coda_cursor_get_num_elements(cursor, &num_elements) != 0 || \
+            codac_check_array_length(jenv, jdst, num_elements) != 0 || \
+            (dst = (CTYPE *)codac_alloc_read_buffer(num_elements, sizeof(CTYPE))) == NULL) \
+        { \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_array"); \
+            return; \
+        } \
+        if (coda_cursor_read_##TYPE##_array(cursor, dst, (coda_array_ordering)jarray_ordering) != 0) \
+        { \
+            free(dst); \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_array"); \
+            return; \
+        } \
+        (*jenv)->Set##JNAME##ArrayRegion(jenv, jdst, 0, (jsize)num_elements, (const JTYPE *)dst); \
+        free(dst); \
+    } \
+    \
+    JNIEXPORT void JNICALL Java_nl_stcorp_coda_codacJNI_cursor_1read_1##TYPE##_1field_1array_1direct(JNIEnv *jenv, \
+        jclass jcls, jlong jcursor, jstring jpath, jobject jdst) \
+    { \
+        const coda_cursor *cursor = *(coda_cursor **)&jcursor; \
+        const char *path; \
+        long num_elements; \
+        void *dst; \
+        int result; \
+        \
+        (void)jcls; \
+        if (jpath == NULL) \
+        { \
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path argument is null"); \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_field_array"); \
+            return; \
+        } \
+        if (coda_cursor_get_num_elements(cursor, &num_elements) != 0 || \
+            (dst = codac_get_direct_buffer_address(jenv, jdst, num_elements, sizeof(CTYPE))) == NULL) \
+        { \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_field_array"); \
+            return; \
+        } \
+        path = (*jenv)->GetStringUTFChars(jenv, jpath, NULL); \
+        if (path == NULL) \
+        { \
+            return; \
+        } \
+        result = coda_cursor_read_##TYPE##_field_array(cursor, path, (CTYPE *)dst); \
+        (*jenv)->ReleaseStringUTFChars(jenv, jpath, path); \
+        if (result != 0) \
+        { \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_field_array"); \
+        } \
+    } \
+    \
+    JNIEXPORT void JNICALL Java_nl_stcorp_coda_codacJNI_cursor_1read_1##TYPE##_1field_1array_1region(JNIEnv *jenv, \
+        jclass jcls, jlong jcursor, jstring jpath, JARRAYTYPE jdst) \
+    { \
+        const coda_cursor *cursor = *(coda_cursor **)&jcursor; \
+        const char *path; \
+        long num_elements; \
+        CTYPE *dst; \
+        int result; \
+        \
+        (void)jcls; \
+        if (jpath == NULL) \
+        { \
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path argument is null"); \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_field_array"); \
+            return; \
+        } \
+        if (coda_cursor_get_num_elements(cursor, &num_elements) != 0 || \
+            codac_check_array_length(jenv, jdst, num_elements) != 0 || \
+            (dst = (CTYPE *)codac_alloc_read_buffer(num_elements, sizeof(CTYPE))) == NULL) \
+        { \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_field_array"); \
+            return; \
+        } \
+        path = (*jenv)->GetStringUTFChars(jenv, jpath, NULL); \
+        if (path == NULL) \
+        { \
+            free(dst); \
+            return; \
+        } \
+        result = coda_cursor_read_##TYPE##_field_array(cursor, path, dst); \
+        (*jenv)->ReleaseStringUTFChars(jenv, jpath, path); \
+        if (result != 0) \
+        { \
+            free(dst); \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_field_array"); \
+            return; \
+        } \
+        (*jenv)->Set##JNAME##ArrayRegion(jenv, jdst, 0, (jsize)num_elements, (const JTYPE *)dst); \
+        free(dst); \
+    }
+
+    CODAC_BULK_READ_FUNCTIONS(int8, int8_t, jbyte, Byte, jbyteArray)
+    CODAC_BULK_READ_FUNCTIONS(uint8, uint8_t, jbyte, Byte, jbyteArray)
+    CODAC_BULK_READ_FUNCTIONS(int16, int16_t, jshort, Short, jshortArray)
+    CODAC_BULK_READ_FUNCTIONS(uint16, uint16_t, jshort, Short, jshortArray)
+    CODAC_BULK_READ_FUNCTIONS(int32, int32_t, jint, Int, jintArray)
+    CODAC_BULK_READ_FUNCTIONS(uint32, uint32_t, jint, Int, jintArray)
+    CODAC_BULK_READ_FUNCTIONS(int64, int64_t, jlong, Long, jlongArray)
+    CODAC_BULK_READ_FUNCTIONS(uint64, uint64_t, jlong, Long, jlongArray)
+    CODAC_BULK_READ_FUNCTIONS(float, float, jfloat, Float, jfloatArray)
+    CODAC_BULK_READ_FUNCTIONS(double, double, jdouble, Double, jdoubleArray)
+
+
 #ifdef __cplusplus
 extern "C" {
 #endif
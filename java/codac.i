@@ -100,6 +100,7 @@ typedef long long int	uint64_t;
   Java.
 */
 %ignore coda_errno;
+%ignore coda_get_errno;
 %ignore coda_set_error;
 %ignore coda_errno_to_string;
 
@@ -282,6 +283,264 @@ coda_cursor *deepcopy_coda_cursor(coda_cursor *self);
     }
 %}
 %ignore coda_time_to_utcstring; /* ignore the real method being wrapped */
+
+
+/*
+  Bulk read functions that bypass the SWIG array typemaps.
+
+  The array typemaps above copy the data from the Java array into a
+  temporary C array and back again. The functions below are
+  handwritten JNI functions (exposed with %native) that read the
+  data with a single copy. The destination is either a direct
+  java.nio.ByteBuffer (the data is read straight into the buffer and
+  values are stored in native byte order at the start of the buffer)
+  or a Java primitive array. For a Java array the data is read into a
+  native buffer which is then copied with Set<Type>ArrayRegion(), so
+  the array does not need to be pinned (which would block the garbage
+  collector) while CODA reads from the file.
+
+  The cursor_read_<type>_field_array_* variants read a single field
+  for all elements of an array of records (see
+  coda_cursor_read_<type>_field_array()). These replace the
+  coda_cursor_read_<type>_field_array() functions, which are
+  therefore ignored.
+
+  The functions for each type are generated with the C macro
+  CODAC_BULK_READ_FUNCTIONS and the matching %native declarations
+  with the SWIG macro CODAC_BULK_READ.
+
+  Errors are raised as nl.stcorp.coda.CodaException, using the same
+  message format as the global exception mechanism below.
+*/
+%{
+    static void codac_throw_exception(JNIEnv *jenv, const char *function_name)
+    {
+        const char *codamsg = coda_errno_to_string(coda_errno);
+        char *fullMessage = malloc(strlen(function_name) + 4 + strlen(codamsg) + 1);
+        jclass clazz = (*jenv)->FindClass(jenv, "nl/stcorp/coda/CodaException");
+
+        sprintf(fullMessage, "%s(): %s", function_name, codamsg);
+        (*jenv)->ThrowNew(jenv, clazz, fullMessage);
+        free(fullMessage);
+    }
+
+    static void *codac_get_direct_buffer_address(JNIEnv *jenv, jobject buffer, long num_elements, long element_size)
+    {
+        void *address;
+
+        if (buffer == NULL)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "buffer argument is null");
+            return NULL;
+        }
+        address = (*jenv)->GetDirectBufferAddress(jenv, buffer);
+        if (address == NULL)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "buffer argument is not a direct buffer");
+            return NULL;
+        }
+        if ((*jenv)->GetDirectBufferCapacity(jenv, buffer) < (jlong)num_elements * element_size)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "buffer argument is too small (%ld bytes needed)",
+                           num_elements * element_size);
+            return NULL;
+        }
+        return address;
+    }
+
+    static int codac_check_array_length(JNIEnv *jenv, jarray array, long num_elements)
+    {
+        if (array == NULL)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "array argument is null");
+            return -1;
+        }
+        if ((*jenv)->GetArrayLength(jenv, array) < num_elements)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "array argument is too small (%ld elements needed)",
+                           num_elements);
+            return -1;
+        }
+        return 0;
+    }
+
+    static void *codac_alloc_read_buffer(long num_elements, long element_size)
+    {
+        void *buffer;
+
+        /* always allocate at least one byte, so a NULL result is only returned when we are out of memory */
+        buffer = malloc(num_elements > 0 ? (size_t)num_elements * element_size : 1);
+        if (buffer == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)num_elements * element_size, __FILE__, __LINE__);
+        }
+        return buffer;
+    }
+
+#define CODAC_BULK_READ_FUNCTIONS(TYPE, CTYPE, JTYPE, JNAME, JARRAYTYPE) \
+    JNIEXPORT void JNICALL Java_nl_stcorp_coda_codacJNI_cursor_1read_1##TYPE##_1array_1direct(JNIEnv *jenv, \
+        jclass jcls, jlong jcursor, jobject jdst, jint jarray_ordering) \
+    { \
+        const coda_cursor *cursor = *(coda_cursor **)&jcursor; \
+        long num_elements; \
+        void *dst; \
+        \
+        (void)jcls; \
+        if (coda_cursor_get_num_elements(cursor, &num_elements) != 0 || \
+            (dst = codac_get_direct_buffer_address(jenv, jdst, num_elements, sizeof(CTYPE))) == NULL || \
+            coda_cursor_read_##TYPE##_array(cursor, (CTYPE *)dst, (coda_array_ordering)jarray_ordering) != 0) \
+        { \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_array"); \
+        } \
+    } \
+    \
+    JNIEXPORT void JNICALL Java_nl_stcorp_coda_codacJNI_cursor_1read_1##TYPE##_1array_1region(JNIEnv *jenv, \
+        jclass jcls, jlong jcursor, JARRAYTYPE jdst, jint jarray_ordering) \
+    { \
+        const coda_cursor *cursor = *(coda_cursor **)&jcursor; \
+        long num_elements; \
+        CTYPE *dst; \
+        \
+        (void)jcls; \
+        if (coda_cursor_get_num_elements(cursor, &num_elements) != 0 || \
+            codac_check_array_length(jenv, jdst, num_elements) != 0 || \
+            (dst = (CTYPE *)codac_alloc_read_buffer(num_elements, sizeof(CTYPE))) == NULL) \
+        { \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_array"); \
+            return; \
+        } \
+        if (coda_cursor_read_##TYPE##_array(cursor, dst, (coda_array_ordering)jarray_ordering) != 0) \
+        { \
+            free(dst); \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_array"); \
+            return; \
+        } \
+        (*jenv)->Set##JNAME##ArrayRegion(jenv, jdst, 0, (jsize)num_elements, (const JTYPE *)dst); \
+        free(dst); \
+    } \
+    \
+    JNIEXPORT void JNICALL Java_nl_stcorp_coda_codacJNI_cursor_1read_1##TYPE##_1field_1array_1direct(JNIEnv *jenv, \
+        jclass jcls, jlong jcursor, jstring jpath, jobject jdst) \
+    { \
+        const coda_cursor *cursor = *(coda_cursor **)&jcursor; \
+        const char *path; \
+        long num_elements; \
+        void *dst; \
+        int result; \
+        \
+        (void)jcls; \
+        if (jpath == NULL) \
+        { \
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path argument is null"); \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_field_array"); \
+            return; \
+        } \
+        if (coda_cursor_get_num_elements(cursor, &num_elements) != 0 || \
+            (dst = codac_get_direct_buffer_address(jenv, jdst, num_elements, sizeof(CTYPE))) == NULL) \
+        { \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_field_array"); \
+            return; \
+        } \
+        path = (*jenv)->GetStringUTFChars(jenv, jpath, NULL); \
+        if (path == NULL) \
+        { \
+            return; \
+        } \
+        result = coda_cursor_read_##TYPE##_field_array(cursor, path, (CTYPE *)dst); \
+        (*jenv)->ReleaseStringUTFChars(jenv, jpath, path); \
+        if (result != 0) \
+        { \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_field_array"); \
+        } \
+    } \
+    \
+    JNIEXPORT void JNICALL Java_nl_stcorp_coda_codacJNI_cursor_1read_1##TYPE##_1field_1array_1region(JNIEnv *jenv, \
+        jclass jcls, jlong jcursor, jstring jpath, JARRAYTYPE jdst) \
+    { \
+        const coda_cursor *cursor = *(coda_cursor **)&jcursor; \
+        const char *path; \
+        long num_elements; \
+        CTYPE *dst; \
+        int result; \
+        \
+        (void)jcls; \
+        if (jpath == NULL) \
+        { \
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path argument is null"); \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_field_array"); \
+            return; \
+        } \
+        if (coda_cursor_get_num_elements(cursor, &num_elements) != 0 || \
+            codac_check_array_length(jenv, jdst, num_elements) != 0 || \
+            (dst = (CTYPE *)codac_alloc_read_buffer(num_elements, sizeof(CTYPE))) == NULL) \
+        { \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_field_array"); \
+            return; \
+        } \
+        path = (*jenv)->GetStringUTFChars(jenv, jpath, NULL); \
+        if (path == NULL) \
+        { \
+            free(dst); \
+            return; \
+        } \
+        result = coda_cursor_read_##TYPE##_field_array(cursor, path, dst); \
+        (*jenv)->ReleaseStringUTFChars(jenv, jpath, path); \
+        if (result != 0) \
+        { \
+            free(dst); \
+            codac_throw_exception(jenv, "coda_cursor_read_" #TYPE "_field_array"); \
+            return; \
+        } \
+        (*jenv)->Set##JNAME##ArrayRegion(jenv, jdst, 0, (jsize)num_elements, (const JTYPE *)dst); \
+        free(dst); \
+    }
+
+    CODAC_BULK_READ_FUNCTIONS(int8, int8_t, jbyte, Byte, jbyteArray)
+    CODAC_BULK_READ_FUNCTIONS(uint8, uint8_t, jbyte, Byte, jbyteArray)
+    CODAC_BULK_READ_FUNCTIONS(int16, int16_t, jshort, Short, jshortArray)
+    CODAC_BULK_READ_FUNCTIONS(uint16, uint16_t, jshort, Short, jshortArray)
+    CODAC_BULK_READ_FUNCTIONS(int32, int32_t, jint, Int, jintArray)
+    CODAC_BULK_READ_FUNCTIONS(uint32, uint32_t, jint, Int, jintArray)
+    CODAC_BULK_READ_FUNCTIONS(int64, int64_t, jlong, Long, jlongArray)
+    CODAC_BULK_READ_FUNCTIONS(uint64, uint64_t, jlong, Long, jlongArray)
+    CODAC_BULK_READ_FUNCTIONS(float, float, jfloat, Float, jfloatArray)
+    CODAC_BULK_READ_FUNCTIONS(double, double, jdouble, Double, jdoubleArray)
+%}
+
+%typemap(jni) jobject dst_buffer "jobject"
+%typemap(jtype) jobject dst_buffer "java.nio.ByteBuffer"
+%typemap(jstype) jobject dst_buffer "java.nio.ByteBuffer"
+%typemap(javain) jobject dst_buffer "$javainput"
+
+%define CODAC_BULK_READ(TYPE, JARRAYTYPE)
+%native(cursor_read_##TYPE##_array_direct) void cursor_read_##TYPE##_array_direct(JNIEnv *jenv, jclass jcls,
+    jlong cursor, jobject dst_buffer, jint array_ordering);
+%native(cursor_read_##TYPE##_array_region) void cursor_read_##TYPE##_array_region(JNIEnv *jenv, jclass jcls,
+    jlong cursor, JARRAYTYPE dst, jint array_ordering);
+%native(cursor_read_##TYPE##_field_array_direct) void cursor_read_##TYPE##_field_array_direct(JNIEnv *jenv,
+    jclass jcls, jlong cursor, jstring path, jobject dst_buffer);
+%native(cursor_read_##TYPE##_field_array_region) void cursor_read_##TYPE##_field_array_region(JNIEnv *jenv,
+    jclass jcls, jlong cursor, jstring path, JARRAYTYPE dst);
+%ignore coda_cursor_read_##TYPE##_field_array;
+%enddef
+
+CODAC_BULK_READ(int8, jbyteArray)
+CODAC_BULK_READ(uint8, jbyteArray)
+CODAC_BULK_READ(int16, jshortArray)
+CODAC_BULK_READ(uint16, jshortArray)
+CODAC_BULK_READ(int32, jintArray)
+CODAC_BULK_READ(uint32, jintArray)
+CODAC_BULK_READ(int64, jlongArray)
+CODAC_BULK_READ(uint64, jlongArray)
+CODAC_BULK_READ(float, jfloatArray)
+CODAC_BULK_READ(double, jdoubleArray)
+
+/*
+  Direct access to memory mapped data is not exposed, since Java
+  has no way to keep the product open while the data is in use.
+*/
+%ignore coda_cursor_get_array_data_pointer;
     
 
 /*
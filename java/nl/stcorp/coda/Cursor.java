@@ -855,11 +855,52 @@ public class Cursor
     public byte[] readInt8Array(ArrayOrderingEnum array_ordering) throws CodaException
     {
         byte dst[] = new byte[this.getNumElements()];
-        codac.cursor_read_int8_array(this.cursor, dst, array_ordering);
+        this.readInt8Array(dst, array_ordering);
         return dst;
     }
 
 
+    /**
+     * Retrieve a data array as type \c int8 from the product file into an
+     * existing Java array.
+     * 
+     * The array should have at least as many elements as the CODA array.
+     * 
+     * @param dst
+     *            The array that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt8Array(byte[] dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_int8_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
+    /**
+     * Retrieve a data array as type \c int8 from the product file into a
+     * direct buffer.
+     * 
+     * The values are stored in native byte order starting at the beginning of
+     * the buffer (the position and limit of the buffer are not used or
+     * modified). The capacity of the buffer should be large enough to hold all
+     * elements of the CODA array.
+     * 
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt8Array(java.nio.ByteBuffer dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_int8_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
     /**
      * Retrieve a data array as type \c uint8 from the product file.
      * 
@@ -871,11 +912,52 @@ public class Cursor
     public byte[] readUint8Array(ArrayOrderingEnum array_ordering) throws CodaException
     {
         byte dst[] = new byte[this.getNumElements()];
-        codac.cursor_read_uint8_array(this.cursor, dst, array_ordering);
+        this.readUint8Array(dst, array_ordering);
         return dst;
     }
 
 
+    /**
+     * Retrieve a data array as type \c uint8 from the product file into an
+     * existing Java array.
+     * 
+     * The array should have at least as many elements as the CODA array.
+     * 
+     * @param dst
+     *            The array that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint8Array(byte[] dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_uint8_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
+    /**
+     * Retrieve a data array as type \c uint8 from the product file into a
+     * direct buffer.
+     * 
+     * The values are stored in native byte order starting at the beginning of
+     * the buffer (the position and limit of the buffer are not used or
+     * modified). The capacity of the buffer should be large enough to hold all
+     * elements of the CODA array.
+     * 
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint8Array(java.nio.ByteBuffer dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_uint8_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
     /**
      * Retrieve a data array as type \c int16 from the product file.
      * 
@@ -887,11 +969,52 @@ public class Cursor
     public short[] readInt16Array(ArrayOrderingEnum array_ordering) throws CodaException
     {
         short dst[] = new short[this.getNumElements()];
-        codac.cursor_read_int16_array(this.cursor, dst, array_ordering);
+        this.readInt16Array(dst, array_ordering);
         return dst;
     }
 
 
+    /**
+     * Retrieve a data array as type \c int16 from the product file into an
+     * existing Java array.
+     * 
+     * The array should have at least as many elements as the CODA array.
+     * 
+     * @param dst
+     *            The array that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt16Array(short[] dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_int16_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
+    /**
+     * Retrieve a data array as type \c int16 from the product file into a
+     * direct buffer.
+     * 
+     * The values are stored in native byte order starting at the beginning of
+     * the buffer (the position and limit of the buffer are not used or
+     * modified). The capacity of the buffer should be large enough to hold all
+     * elements of the CODA array.
+     * 
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt16Array(java.nio.ByteBuffer dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_int16_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
     /**
      * Retrieve a data array as type \c uint16 from the product file.
      * 
@@ -903,11 +1026,52 @@ public class Cursor
     public short[] readUint16Array(ArrayOrderingEnum array_ordering) throws CodaException
     {
         short dst[] = new short[this.getNumElements()];
-        codac.cursor_read_uint16_array(this.cursor, dst, array_ordering);
+        this.readUint16Array(dst, array_ordering);
         return dst;
     }
 
 
+    /**
+     * Retrieve a data array as type \c uint16 from the product file into an
+     * existing Java array.
+     * 
+     * The array should have at least as many elements as the CODA array.
+     * 
+     * @param dst
+     *            The array that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint16Array(short[] dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_uint16_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
+    /**
+     * Retrieve a data array as type \c uint16 from the product file into a
+     * direct buffer.
+     * 
+     * The values are stored in native byte order starting at the beginning of
+     * the buffer (the position and limit of the buffer are not used or
+     * modified). The capacity of the buffer should be large enough to hold all
+     * elements of the CODA array.
+     * 
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint16Array(java.nio.ByteBuffer dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_uint16_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
     /**
      * Retrieve a data array as type \c int32 from the product file.
      * 
@@ -919,11 +1083,52 @@ public class Cursor
     public int[] readInt32Array(ArrayOrderingEnum array_ordering) throws CodaException
     {
         int dst[] = new int[this.getNumElements()];
-        codac.cursor_read_int32_array(this.cursor, dst, array_ordering);
+        this.readInt32Array(dst, array_ordering);
         return dst;
     }
 
 
+    /**
+     * Retrieve a data array as type \c int32 from the product file into an
+     * existing Java array.
+     * 
+     * The array should have at least as many elements as the CODA array.
+     * 
+     * @param dst
+     *            The array that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt32Array(int[] dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_int32_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
+    /**
+     * Retrieve a data array as type \c int32 from the product file into a
+     * direct buffer.
+     * 
+     * The values are stored in native byte order starting at the beginning of
+     * the buffer (the position and limit of the buffer are not used or
+     * modified). The capacity of the buffer should be large enough to hold all
+     * elements of the CODA array.
+     * 
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt32Array(java.nio.ByteBuffer dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_int32_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
     /**
      * Retrieve a data array as type \c uint32 from the product file.
      * 
@@ -935,11 +1140,52 @@ public class Cursor
     public int[] readUint32Array(ArrayOrderingEnum array_ordering) throws CodaException
     {
         int dst[] = new int[this.getNumElements()];
-        codac.cursor_read_uint32_array(this.cursor, dst, array_ordering);
+        this.readUint32Array(dst, array_ordering);
         return dst;
     }
 
 
+    /**
+     * Retrieve a data array as type \c uint32 from the product file into an
+     * existing Java array.
+     * 
+     * The array should have at least as many elements as the CODA array.
+     * 
+     * @param dst
+     *            The array that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint32Array(int[] dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_uint32_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
+    /**
+     * Retrieve a data array as type \c uint32 from the product file into a
+     * direct buffer.
+     * 
+     * The values are stored in native byte order starting at the beginning of
+     * the buffer (the position and limit of the buffer are not used or
+     * modified). The capacity of the buffer should be large enough to hold all
+     * elements of the CODA array.
+     * 
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint32Array(java.nio.ByteBuffer dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_uint32_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
     /**
      * Retrieve a data array as type \c int64 from the product file.
      * 
@@ -951,11 +1197,52 @@ public class Cursor
     public long[] readInt64Array(ArrayOrderingEnum array_ordering) throws CodaException
     {
         long dst[] = new long[this.getNumElements()];
-        codac.cursor_read_int64_array(this.cursor, dst, array_ordering);
+        this.readInt64Array(dst, array_ordering);
         return dst;
     }
 
 
+    /**
+     * Retrieve a data array as type \c int64 from the product file into an
+     * existing Java array.
+     * 
+     * The array should have at least as many elements as the CODA array.
+     * 
+     * @param dst
+     *            The array that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt64Array(long[] dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_int64_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
+    /**
+     * Retrieve a data array as type \c int64 from the product file into a
+     * direct buffer.
+     * 
+     * The values are stored in native byte order starting at the beginning of
+     * the buffer (the position and limit of the buffer are not used or
+     * modified). The capacity of the buffer should be large enough to hold all
+     * elements of the CODA array.
+     * 
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt64Array(java.nio.ByteBuffer dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_int64_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
     /**
      * Retrieve a data array as type \c uint64 from the product file.
      * 
@@ -967,11 +1254,52 @@ public class Cursor
     public long[] readUint64Array(ArrayOrderingEnum array_ordering) throws CodaException
     {
         long dst[] = new long[this.getNumElements()];
-        codac.cursor_read_uint64_array(this.cursor, dst, array_ordering);
+        this.readUint64Array(dst, array_ordering);
         return dst;
     }
 
 
+    /**
+     * Retrieve a data array as type \c uint64 from the product file into an
+     * existing Java array.
+     * 
+     * The array should have at least as many elements as the CODA array.
+     * 
+     * @param dst
+     *            The array that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint64Array(long[] dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_uint64_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
+    /**
+     * Retrieve a data array as type \c uint64 from the product file into a
+     * direct buffer.
+     * 
+     * The values are stored in native byte order starting at the beginning of
+     * the buffer (the position and limit of the buffer are not used or
+     * modified). The capacity of the buffer should be large enough to hold all
+     * elements of the CODA array.
+     * 
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint64Array(java.nio.ByteBuffer dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_uint64_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
     /**
      * Retrieve a data array as type \c float from the product file.
      * 
@@ -983,11 +1311,52 @@ public class Cursor
     public float[] readFloatArray(ArrayOrderingEnum array_ordering) throws CodaException
     {
         float dst[] = new float[this.getNumElements()];
-        codac.cursor_read_float_array(this.cursor, dst, array_ordering);
+        this.readFloatArray(dst, array_ordering);
         return dst;
     }
 
 
+    /**
+     * Retrieve a data array as type \c float from the product file into an
+     * existing Java array.
+     * 
+     * The array should have at least as many elements as the CODA array.
+     * 
+     * @param dst
+     *            The array that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readFloatArray(float[] dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_float_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
+    /**
+     * Retrieve a data array as type \c float from the product file into a
+     * direct buffer.
+     * 
+     * The values are stored in native byte order starting at the beginning of
+     * the buffer (the position and limit of the buffer are not used or
+     * modified). The capacity of the buffer should be large enough to hold all
+     * elements of the CODA array.
+     * 
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readFloatArray(java.nio.ByteBuffer dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_float_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
     /**
      * Retrieve a data array as type \c double from the product file.
      * 
@@ -999,11 +1368,52 @@ public class Cursor
     public double[] readDoubleArray(ArrayOrderingEnum array_ordering) throws CodaException
     {
         double dst[] = new double[this.getNumElements()];
-        codac.cursor_read_double_array(this.cursor, dst, array_ordering);
+        this.readDoubleArray(dst, array_ordering);
         return dst;
     }
 
 
+    /**
+     * Retrieve a data array as type \c double from the product file into an
+     * existing Java array.
+     * 
+     * The array should have at least as many elements as the CODA array.
+     * 
+     * @param dst
+     *            The array that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readDoubleArray(double[] dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_double_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
+    /**
+     * Retrieve a data array as type \c double from the product file into a
+     * direct buffer.
+     * 
+     * The values are stored in native byte order starting at the beginning of
+     * the buffer (the position and limit of the buffer are not used or
+     * modified). The capacity of the buffer should be large enough to hold all
+     * elements of the CODA array.
+     * 
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @param array_ordering
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readDoubleArray(java.nio.ByteBuffer dst, ArrayOrderingEnum array_ordering) throws CodaException
+    {
+        codac.cursor_read_double_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), dst,
+                array_ordering.swigValue());
+    }
+
+
     /**
      * Retrieve a data array as type \c char from the product file.
      * 
@@ -1024,6 +1434,566 @@ public class Cursor
     }
 
 
+    /**
+     * Retrieve a field of all records in an array of records as type \c int8
+     * from the product file.
+     * 
+     * The cursor should point to an array of records and the path is a path
+     * (as used by gotoPath()) relative to a record element. The values are
+     * returned in the order of the array elements (C ordering).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @return The values read from the product.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public byte[] readInt8FieldArray(String path) throws CodaException
+    {
+        byte dst[] = new byte[this.getNumElements()];
+        this.readInt8FieldArray(path, dst);
+        return dst;
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c int8
+     * from the product file into an existing Java array.
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            The array that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt8FieldArray(String path, byte[] dst) throws CodaException
+    {
+        codac.cursor_read_int8_field_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c int8
+     * from the product file into a direct buffer (using native byte order).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt8FieldArray(String path, java.nio.ByteBuffer dst) throws CodaException
+    {
+        codac.cursor_read_int8_field_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c uint8
+     * from the product file.
+     * 
+     * The cursor should point to an array of records and the path is a path
+     * (as used by gotoPath()) relative to a record element. The values are
+     * returned in the order of the array elements (C ordering).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @return The values read from the product.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public byte[] readUint8FieldArray(String path) throws CodaException
+    {
+        byte dst[] = new byte[this.getNumElements()];
+        this.readUint8FieldArray(path, dst);
+        return dst;
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c uint8
+     * from the product file into an existing Java array.
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            The array that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint8FieldArray(String path, byte[] dst) throws CodaException
+    {
+        codac.cursor_read_uint8_field_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c uint8
+     * from the product file into a direct buffer (using native byte order).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint8FieldArray(String path, java.nio.ByteBuffer dst) throws CodaException
+    {
+        codac.cursor_read_uint8_field_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c int16
+     * from the product file.
+     * 
+     * The cursor should point to an array of records and the path is a path
+     * (as used by gotoPath()) relative to a record element. The values are
+     * returned in the order of the array elements (C ordering).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @return The values read from the product.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public short[] readInt16FieldArray(String path) throws CodaException
+    {
+        short dst[] = new short[this.getNumElements()];
+        this.readInt16FieldArray(path, dst);
+        return dst;
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c int16
+     * from the product file into an existing Java array.
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            The array that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt16FieldArray(String path, short[] dst) throws CodaException
+    {
+        codac.cursor_read_int16_field_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c int16
+     * from the product file into a direct buffer (using native byte order).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt16FieldArray(String path, java.nio.ByteBuffer dst) throws CodaException
+    {
+        codac.cursor_read_int16_field_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c uint16
+     * from the product file.
+     * 
+     * The cursor should point to an array of records and the path is a path
+     * (as used by gotoPath()) relative to a record element. The values are
+     * returned in the order of the array elements (C ordering).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @return The values read from the product.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public short[] readUint16FieldArray(String path) throws CodaException
+    {
+        short dst[] = new short[this.getNumElements()];
+        this.readUint16FieldArray(path, dst);
+        return dst;
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c uint16
+     * from the product file into an existing Java array.
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            The array that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint16FieldArray(String path, short[] dst) throws CodaException
+    {
+        codac.cursor_read_uint16_field_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c uint16
+     * from the product file into a direct buffer (using native byte order).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint16FieldArray(String path, java.nio.ByteBuffer dst) throws CodaException
+    {
+        codac.cursor_read_uint16_field_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c int32
+     * from the product file.
+     * 
+     * The cursor should point to an array of records and the path is a path
+     * (as used by gotoPath()) relative to a record element. The values are
+     * returned in the order of the array elements (C ordering).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @return The values read from the product.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public int[] readInt32FieldArray(String path) throws CodaException
+    {
+        int dst[] = new int[this.getNumElements()];
+        this.readInt32FieldArray(path, dst);
+        return dst;
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c int32
+     * from the product file into an existing Java array.
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            The array that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt32FieldArray(String path, int[] dst) throws CodaException
+    {
+        codac.cursor_read_int32_field_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c int32
+     * from the product file into a direct buffer (using native byte order).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt32FieldArray(String path, java.nio.ByteBuffer dst) throws CodaException
+    {
+        codac.cursor_read_int32_field_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c uint32
+     * from the product file.
+     * 
+     * The cursor should point to an array of records and the path is a path
+     * (as used by gotoPath()) relative to a record element. The values are
+     * returned in the order of the array elements (C ordering).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @return The values read from the product.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public int[] readUint32FieldArray(String path) throws CodaException
+    {
+        int dst[] = new int[this.getNumElements()];
+        this.readUint32FieldArray(path, dst);
+        return dst;
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c uint32
+     * from the product file into an existing Java array.
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            The array that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint32FieldArray(String path, int[] dst) throws CodaException
+    {
+        codac.cursor_read_uint32_field_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c uint32
+     * from the product file into a direct buffer (using native byte order).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint32FieldArray(String path, java.nio.ByteBuffer dst) throws CodaException
+    {
+        codac.cursor_read_uint32_field_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c int64
+     * from the product file.
+     * 
+     * The cursor should point to an array of records and the path is a path
+     * (as used by gotoPath()) relative to a record element. The values are
+     * returned in the order of the array elements (C ordering).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @return The values read from the product.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public long[] readInt64FieldArray(String path) throws CodaException
+    {
+        long dst[] = new long[this.getNumElements()];
+        this.readInt64FieldArray(path, dst);
+        return dst;
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c int64
+     * from the product file into an existing Java array.
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            The array that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt64FieldArray(String path, long[] dst) throws CodaException
+    {
+        codac.cursor_read_int64_field_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c int64
+     * from the product file into a direct buffer (using native byte order).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readInt64FieldArray(String path, java.nio.ByteBuffer dst) throws CodaException
+    {
+        codac.cursor_read_int64_field_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c uint64
+     * from the product file.
+     * 
+     * The cursor should point to an array of records and the path is a path
+     * (as used by gotoPath()) relative to a record element. The values are
+     * returned in the order of the array elements (C ordering).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @return The values read from the product.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public long[] readUint64FieldArray(String path) throws CodaException
+    {
+        long dst[] = new long[this.getNumElements()];
+        this.readUint64FieldArray(path, dst);
+        return dst;
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c uint64
+     * from the product file into an existing Java array.
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            The array that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint64FieldArray(String path, long[] dst) throws CodaException
+    {
+        codac.cursor_read_uint64_field_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c uint64
+     * from the product file into a direct buffer (using native byte order).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readUint64FieldArray(String path, java.nio.ByteBuffer dst) throws CodaException
+    {
+        codac.cursor_read_uint64_field_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c float
+     * from the product file.
+     * 
+     * The cursor should point to an array of records and the path is a path
+     * (as used by gotoPath()) relative to a record element. The values are
+     * returned in the order of the array elements (C ordering).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @return The values read from the product.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public float[] readFloatFieldArray(String path) throws CodaException
+    {
+        float dst[] = new float[this.getNumElements()];
+        this.readFloatFieldArray(path, dst);
+        return dst;
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c float
+     * from the product file into an existing Java array.
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            The array that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readFloatFieldArray(String path, float[] dst) throws CodaException
+    {
+        codac.cursor_read_float_field_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c float
+     * from the product file into a direct buffer (using native byte order).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readFloatFieldArray(String path, java.nio.ByteBuffer dst) throws CodaException
+    {
+        codac.cursor_read_float_field_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c double
+     * from the product file.
+     * 
+     * The cursor should point to an array of records and the path is a path
+     * (as used by gotoPath()) relative to a record element. The values are
+     * returned in the order of the array elements (C ordering).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @return The values read from the product.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public double[] readDoubleFieldArray(String path) throws CodaException
+    {
+        double dst[] = new double[this.getNumElements()];
+        this.readDoubleFieldArray(path, dst);
+        return dst;
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c double
+     * from the product file into an existing Java array.
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            The array that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readDoubleFieldArray(String path, double[] dst) throws CodaException
+    {
+        codac.cursor_read_double_field_array_region(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
+    /**
+     * Retrieve a field of all records in an array of records as type \c double
+     * from the product file into a direct buffer (using native byte order).
+     * 
+     * @param path
+     *            The path to the field within each record.
+     * @param dst
+     *            A direct buffer that will receive the values.
+     * @throws CodaException
+     *             If an error occurred.
+     */
+    public void readDoubleFieldArray(String path, java.nio.ByteBuffer dst) throws CodaException
+    {
+        codac.cursor_read_double_field_array_direct(SWIGTYPE_p_coda_cursor_struct.getCPtr(this.cursor), path, dst);
+    }
+
+
     /**
      * Retrieve a partial data array as type \c int8 from the product file.
      * 
@@ -51,6 +51,166 @@ public class codac implements codacConstants {
     return codacJNI.helper_coda_time_to_utcstring(datetime);
   }
 
+  public static void cursor_read_int8_array_direct(long cursor, java.nio.ByteBuffer dst_buffer, int array_ordering) {
+    codacJNI.cursor_read_int8_array_direct(cursor, dst_buffer, array_ordering);
+  }
+
+  public static void cursor_read_int8_array_region(long cursor, byte[] dst, int array_ordering) {
+    codacJNI.cursor_read_int8_array_region(cursor, dst, array_ordering);
+  }
+
+  public static void cursor_read_int8_field_array_direct(long cursor, String path, java.nio.ByteBuffer dst_buffer) {
+    codacJNI.cursor_read_int8_field_array_direct(cursor, path, dst_buffer);
+  }
+
+  public static void cursor_read_int8_field_array_region(long cursor, String path, byte[] dst) {
+    codacJNI.cursor_read_int8_field_array_region(cursor, path, dst);
+  }
+
+  public static void cursor_read_uint8_array_direct(long cursor, java.nio.ByteBuffer dst_buffer, int array_ordering) {
+    codacJNI.cursor_read_uint8_array_direct(cursor, dst_buffer, array_ordering);
+  }
+
+  public static void cursor_read_uint8_array_region(long cursor, byte[] dst, int array_ordering) {
+    codacJNI.cursor_read_uint8_array_region(cursor, dst, array_ordering);
+  }
+
+  public static void cursor_read_uint8_field_array_direct(long cursor, String path, java.nio.ByteBuffer dst_buffer) {
+    codacJNI.cursor_read_uint8_field_array_direct(cursor, path, dst_buffer);
+  }
+
+  public static void cursor_read_uint8_field_array_region(long cursor, String path, byte[] dst) {
+    codacJNI.cursor_read_uint8_field_array_region(cursor, path, dst);
+  }
+
+  public static void cursor_read_int16_array_direct(long cursor, java.nio.ByteBuffer dst_buffer, int array_ordering) {
+    codacJNI.cursor_read_int16_array_direct(cursor, dst_buffer, array_ordering);
+  }
+
+  public static void cursor_read_int16_array_region(long cursor, short[] dst, int array_ordering) {
+    codacJNI.cursor_read_int16_array_region(cursor, dst, array_ordering);
+  }
+
+  public static void cursor_read_int16_field_array_direct(long cursor, String path, java.nio.ByteBuffer dst_buffer) {
+    codacJNI.cursor_read_int16_field_array_direct(cursor, path, dst_buffer);
+  }
+
+  public static void cursor_read_int16_field_array_region(long cursor, String path, short[] dst) {
+    codacJNI.cursor_read_int16_field_array_region(cursor, path, dst);
+  }
+
+  public static void cursor_read_uint16_array_direct(long cursor, java.nio.ByteBuffer dst_buffer, int array_ordering) {
+    codacJNI.cursor_read_uint16_array_direct(cursor, dst_buffer, array_ordering);
+  }
+
+  public static void cursor_read_uint16_array_region(long cursor, short[] dst, int array_ordering) {
+    codacJNI.cursor_read_uint16_array_region(cursor, dst, array_ordering);
+  }
+
+  public static void cursor_read_uint16_field_array_direct(long cursor, String path, java.nio.ByteBuffer dst_buffer) {
+    codacJNI.cursor_read_uint16_field_array_direct(cursor, path, dst_buffer);
+  }
+
+  public static void cursor_read_uint16_field_array_region(long cursor, String path, short[] dst) {
+    codacJNI.cursor_read_uint16_field_array_region(cursor, path, dst);
+  }
+
+  public static void cursor_read_int32_array_direct(long cursor, java.nio.ByteBuffer dst_buffer, int array_ordering) {
+    codacJNI.cursor_read_int32_array_direct(cursor, dst_buffer, array_ordering);
+  }
+
+  public static void cursor_read_int32_array_region(long cursor, int[] dst, int array_ordering) {
+    codacJNI.cursor_read_int32_array_region(cursor, dst, array_ordering);
+  }
+
+  public static void cursor_read_int32_field_array_direct(long cursor, String path, java.nio.ByteBuffer dst_buffer) {
+    codacJNI.cursor_read_int32_field_array_direct(cursor, path, dst_buffer);
+  }
+
+  public static void cursor_read_int32_field_array_region(long cursor, String path, int[] dst) {
+    codacJNI.cursor_read_int32_field_array_region(cursor, path, dst);
+  }
+
+  public static void cursor_read_uint32_array_direct(long cursor, java.nio.ByteBuffer dst_buffer, int array_ordering) {
+    codacJNI.cursor_read_uint32_array_direct(cursor, dst_buffer, array_ordering);
+  }
+
+  public static void cursor_read_uint32_array_region(long cursor, int[] dst, int array_ordering) {
+    codacJNI.cursor_read_uint32_array_region(cursor, dst, array_ordering);
+  }
+
+  public static void cursor_read_uint32_field_array_direct(long cursor, String path, java.nio.ByteBuffer dst_buffer) {
+    codacJNI.cursor_read_uint32_field_array_direct(cursor, path, dst_buffer);
+  }
+
+  public static void cursor_read_uint32_field_array_region(long cursor, String path, int[] dst) {
+    codacJNI.cursor_read_uint32_field_array_region(cursor, path, dst);
+  }
+
+  public static void cursor_read_int64_array_direct(long cursor, java.nio.ByteBuffer dst_buffer, int array_ordering) {
+    codacJNI.cursor_read_int64_array_direct(cursor, dst_buffer, array_ordering);
+  }
+
+  public static void cursor_read_int64_array_region(long cursor, long[] dst, int array_ordering) {
+    codacJNI.cursor_read_int64_array_region(cursor, dst, array_ordering);
+  }
+
+  public static void cursor_read_int64_field_array_direct(long cursor, String path, java.nio.ByteBuffer dst_buffer) {
+    codacJNI.cursor_read_int64_field_array_direct(cursor, path, dst_buffer);
+  }
+
+  public static void cursor_read_int64_field_array_region(long cursor, String path, long[] dst) {
+    codacJNI.cursor_read_int64_field_array_region(cursor, path, dst);
+  }
+
+  public static void cursor_read_uint64_array_direct(long cursor, java.nio.ByteBuffer dst_buffer, int array_ordering) {
+    codacJNI.cursor_read_uint64_array_direct(cursor, dst_buffer, array_ordering);
+  }
+
+  public static void cursor_read_uint64_array_region(long cursor, long[] dst, int array_ordering) {
+    codacJNI.cursor_read_uint64_array_region(cursor, dst, array_ordering);
+  }
+
+  public static void cursor_read_uint64_field_array_direct(long cursor, String path, java.nio.ByteBuffer dst_buffer) {
+    codacJNI.cursor_read_uint64_field_array_direct(cursor, path, dst_buffer);
+  }
+
+  public static void cursor_read_uint64_field_array_region(long cursor, String path, long[] dst) {
+    codacJNI.cursor_read_uint64_field_array_region(cursor, path, dst);
+  }
+
+  public static void cursor_read_float_array_direct(long cursor, java.nio.ByteBuffer dst_buffer, int array_ordering) {
+    codacJNI.cursor_read_float_array_direct(cursor, dst_buffer, array_ordering);
+  }
+
+  public static void cursor_read_float_array_region(long cursor, float[] dst, int array_ordering) {
+    codacJNI.cursor_read_float_array_region(cursor, dst, array_ordering);
+  }
+
+  public static void cursor_read_float_field_array_direct(long cursor, String path, java.nio.ByteBuffer dst_buffer) {
+    codacJNI.cursor_read_float_field_array_direct(cursor, path, dst_buffer);
+  }
+
+  public static void cursor_read_float_field_array_region(long cursor, String path, float[] dst) {
+    codacJNI.cursor_read_float_field_array_region(cursor, path, dst);
+  }
+
+  public static void cursor_read_double_array_direct(long cursor, java.nio.ByteBuffer dst_buffer, int array_ordering) {
+    codacJNI.cursor_read_double_array_direct(cursor, dst_buffer, array_ordering);
+  }
+
+  public static void cursor_read_double_array_region(long cursor, double[] dst, int array_ordering) {
+    codacJNI.cursor_read_double_array_region(cursor, dst, array_ordering);
+  }
+
+  public static void cursor_read_double_field_array_direct(long cursor, String path, java.nio.ByteBuffer dst_buffer) {
+    codacJNI.cursor_read_double_field_array_direct(cursor, path, dst_buffer);
+  }
+
+  public static void cursor_read_double_field_array_region(long cursor, String path, double[] dst) {
+    codacJNI.cursor_read_double_field_array_region(cursor, path, dst);
+  }
+
   public static void done() {
     codacJNI.done();
   }
@@ -19,6 +19,46 @@ public class codacJNI {
   public final static native String helper_coda_time_double_to_string_utc(double jarg1, String jarg2);
   public final static native String helper_coda_time_to_string(double jarg1);
   public final static native String helper_coda_time_to_utcstring(double jarg1);
+  public final static native void cursor_read_int8_array_direct(long jarg1, java.nio.ByteBuffer jarg2, int jarg3);
+  public final static native void cursor_read_int8_array_region(long jarg1, byte[] jarg2, int jarg3);
+  public final static native void cursor_read_int8_field_array_direct(long jarg1, String jarg2, java.nio.ByteBuffer jarg3);
+  public final static native void cursor_read_int8_field_array_region(long jarg1, String jarg2, byte[] jarg3);
+  public final static native void cursor_read_uint8_array_direct(long jarg1, java.nio.ByteBuffer jarg2, int jarg3);
+  public final static native void cursor_read_uint8_array_region(long jarg1, byte[] jarg2, int jarg3);
+  public final static native void cursor_read_uint8_field_array_direct(long jarg1, String jarg2, java.nio.ByteBuffer jarg3);
+  public final static native void cursor_read_uint8_field_array_region(long jarg1, String jarg2, byte[] jarg3);
+  public final static native void cursor_read_int16_array_direct(long jarg1, java.nio.ByteBuffer jarg2, int jarg3);
+  public final static native void cursor_read_int16_array_region(long jarg1, short[] jarg2, int jarg3);
+  public final static native void cursor_read_int16_field_array_direct(long jarg1, String jarg2, java.nio.ByteBuffer jarg3);
+  public final static native void cursor_read_int16_field_array_region(long jarg1, String jarg2, short[] jarg3);
+  public final static native void cursor_read_uint16_array_direct(long jarg1, java.nio.ByteBuffer jarg2, int jarg3);
+  public final static native void cursor_read_uint16_array_region(long jarg1, short[] jarg2, int jarg3);
+  public final static native void cursor_read_uint16_field_array_direct(long jarg1, String jarg2, java.nio.ByteBuffer jarg3);
+  public final static native void cursor_read_uint16_field_array_region(long jarg1, String jarg2, short[] jarg3);
+  public final static native void cursor_read_int32_array_direct(long jarg1, java.nio.ByteBuffer jarg2, int jarg3);
+  public final static native void cursor_read_int32_array_region(long jarg1, int[] jarg2, int jarg3);
+  public final static native void cursor_read_int32_field_array_direct(long jarg1, String jarg2, java.nio.ByteBuffer jarg3);
+  public final static native void cursor_read_int32_field_array_region(long jarg1, String jarg2, int[] jarg3);
+  public final static native void cursor_read_uint32_array_direct(long jarg1, java.nio.ByteBuffer jarg2, int jarg3);
+  public final static native void cursor_read_uint32_array_region(long jarg1, int[] jarg2, int jarg3);
+  public final static native void cursor_read_uint32_field_array_direct(long jarg1, String jarg2, java.nio.ByteBuffer jarg3);
+  public final static native void cursor_read_uint32_field_array_region(long jarg1, String jarg2, int[] jarg3);
+  public final static native void cursor_read_int64_array_direct(long jarg1, java.nio.ByteBuffer jarg2, int jarg3);
+  public final static native void cursor_read_int64_array_region(long jarg1, long[] jarg2, int jarg3);
+  public final static native void cursor_read_int64_field_array_direct(long jarg1, String jarg2, java.nio.ByteBuffer jarg3);
+  public final static native void cursor_read_int64_field_array_region(long jarg1, String jarg2, long[] jarg3);
+  public final static native void cursor_read_uint64_array_direct(long jarg1, java.nio.ByteBuffer jarg2, int jarg3);
+  public final static native void cursor_read_uint64_array_region(long jarg1, long[] jarg2, int jarg3);
+  public final static native void cursor_read_uint64_field_array_direct(long jarg1, String jarg2, java.nio.ByteBuffer jarg3);
+  public final static native void cursor_read_uint64_field_array_region(long jarg1, String jarg2, long[] jarg3);
+  public final static native void cursor_read_float_array_direct(long jarg1, java.nio.ByteBuffer jarg2, int jarg3);
+  public final static native void cursor_read_float_array_region(long jarg1, float[] jarg2, int jarg3);
+  public final static native void cursor_read_float_field_array_direct(long jarg1, String jarg2, java.nio.ByteBuffer jarg3);
+  public final static native void cursor_read_float_field_array_region(long jarg1, String jarg2, float[] jarg3);
+  public final static native void cursor_read_double_array_direct(long jarg1, java.nio.ByteBuffer jarg2, int jarg3);
+  public final static native void cursor_read_double_array_region(long jarg1, double[] jarg2, int jarg3);
+  public final static native void cursor_read_double_field_array_direct(long jarg1, String jarg2, java.nio.ByteBuffer jarg3);
+  public final static native void cursor_read_double_field_array_region(long jarg1, String jarg2, double[] jarg3);
   public final static native void done();
   public final static native double NaN();
   public final static native double PlusInf();
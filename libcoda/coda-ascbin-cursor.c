@@ -48,7 +48,7 @@ static int get_relative_field_bit_offset_by_index(const coda_cursor *cursor, lon
     long index;
     long i;
 
-    record = (coda_type_record *)cursor->stack[cursor->n - 1].type;
+    record = (coda_type_record *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
     field = record->field[field_index];
 
     if (field->bit_offset >= 0)
@@ -156,7 +156,7 @@ static int get_next_relative_field_bit_offset(const coda_cursor *cursor, int64_t
     int64_t bit_size;
     int field_index;
 
-    record = (coda_type_record *)cursor->stack[cursor->n - 2].type;
+    record = (coda_type_record *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 2].type);
     field_index = cursor->stack[cursor->n - 1].index + 1;
     assert(field_index < record->num_fields);
     field = record->field[field_index];
@@ -478,7 +478,7 @@ int coda_ascbin_cursor_goto_array_element(coda_cursor *cursor, int num_subs, con
     return 0;
 }
 
-int coda_ascbin_cursor_goto_array_element_by_index(coda_cursor *cursor, long index)
+int coda_ascbin_cursor_goto_array_element_by_index(coda_cursor *cursor, long index, int perform_boundary_checks)
 {
     coda_type_array *array;
     long i;
@@ -486,7 +486,7 @@ int coda_ascbin_cursor_goto_array_element_by_index(coda_cursor *cursor, long ind
     array = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     /* check the range for index */
-    if (coda_option_perform_boundary_checks)
+    if (perform_boundary_checks)
     {
         long num_elements;
 
@@ -532,7 +532,7 @@ int coda_ascbin_cursor_goto_array_element_by_index(coda_cursor *cursor, long ind
     return 0;
 }
 
-int coda_ascbin_cursor_goto_next_array_element(coda_cursor *cursor)
+int coda_ascbin_cursor_goto_next_array_element(coda_cursor *cursor, int perform_boundary_checks)
 {
     coda_type_array *array;
     int64_t bit_size;
@@ -541,7 +541,7 @@ int coda_ascbin_cursor_goto_next_array_element(coda_cursor *cursor)
     array = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 2].type);
     index = cursor->stack[cursor->n - 1].index + 1;
 
-    if (coda_option_perform_boundary_checks)
+    if (perform_boundary_checks)
     {
         long num_elements;
 
@@ -610,7 +610,7 @@ int coda_ascbin_cursor_get_bit_size(const coda_cursor *cursor, int64_t *bit_size
                 {
                     coda_type_record *record = (coda_type_record *)type;
 
-                    if (coda_option_use_fast_size_expressions && record->size_expr != NULL)
+                    if (coda_cursor_use_fast_size_expressions() && record->size_expr != NULL)
                     {
                         if (coda_expression_eval_integer(record->size_expr, cursor, bit_size) != 0)
                         {
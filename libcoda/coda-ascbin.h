@@ -39,8 +39,8 @@ int coda_ascbin_cursor_goto_record_field_by_index(coda_cursor *cursor, long inde
 int coda_ascbin_cursor_goto_next_record_field(coda_cursor *cursor);
 int coda_ascbin_cursor_goto_available_union_field(coda_cursor *cursor);
 int coda_ascbin_cursor_goto_array_element(coda_cursor *cursor, int num_subs, const long subs[]);
-int coda_ascbin_cursor_goto_array_element_by_index(coda_cursor *cursor, long index);
-int coda_ascbin_cursor_goto_next_array_element(coda_cursor *cursor);
+int coda_ascbin_cursor_goto_array_element_by_index(coda_cursor *cursor, long index, int perform_boundary_checks);
+int coda_ascbin_cursor_goto_next_array_element(coda_cursor *cursor, int perform_boundary_checks);
 int coda_ascbin_cursor_goto_attributes(coda_cursor *cursor);
 int coda_ascbin_cursor_use_base_type_of_special_type(coda_cursor *cursor);
 int coda_ascbin_cursor_get_bit_size(const coda_cursor *cursor, int64_t *bit_size);
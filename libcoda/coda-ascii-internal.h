@@ -58,6 +58,11 @@ struct coda_ascii_product_struct
     /* fields shared with 'bin' product */
     int use_mmap;       /* indicates whether to use mem_ptr (or the file descriptor 'fd') */
     int fd;     /* file handle when not using mem_ptr */
+    struct coda_bin_read_cache_struct *read_cache;      /* block cache for reading from 'fd' (NULL if not used) */
+    int is_compressed;  /* is the file compressed (mem_ptr then holds a malloc()ed copy of the decompressed data) */
+    struct coda_gzip_index_struct *gzip_index;  /* index for reading from a compressed 'fd' (NULL if not used) */
+    int is_memory_buffer;       /* is mem_ptr a buffer that is owned by the user (see coda_open_from_memory()) */
+    int64_t file_offset;        /* offset of the product data in the file (non-zero for an entry of a zip file) */
 #ifdef WIN32
     HANDLE file;
     HANDLE file_mapping;
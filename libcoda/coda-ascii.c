@@ -76,6 +76,15 @@ int coda_ascii_reopen_with_definition(coda_product **product, const coda_product
     product_file->use_mmap = (*(coda_bin_product **)product)->use_mmap;
     product_file->fd = (*(coda_bin_product **)product)->fd;
     (*(coda_bin_product **)product)->fd = -1;
+    product_file->read_cache = (*(coda_bin_product **)product)->read_cache;
+    (*(coda_bin_product **)product)->read_cache = NULL;
+    product_file->is_compressed = (*(coda_bin_product **)product)->is_compressed;
+    (*(coda_bin_product **)product)->is_compressed = 0;
+    product_file->gzip_index = (*(coda_bin_product **)product)->gzip_index;
+    (*(coda_bin_product **)product)->gzip_index = NULL;
+    product_file->is_memory_buffer = (*(coda_bin_product **)product)->is_memory_buffer;
+    (*(coda_bin_product **)product)->is_memory_buffer = 0;
+    product_file->file_offset = (*(coda_bin_product **)product)->file_offset;
 
 #ifdef WIN32
     product_file->file = (*(coda_bin_product **)product)->file;
@@ -894,10 +894,45 @@ int coda_bin_cursor_read_bytes(const coda_cursor *cursor, uint8_t *dst, int64_t
     return read_bytes(cursor->product, (cursor->stack[cursor->n - 1].bit_offset >> 3) + offset, length, dst);
 }
 
+/* for large arrays, tell the operating system in advance that the full byte range of the array is going to be read */
+static void prefetch_array(const coda_cursor *cursor, const coda_type_array *type)
+{
+    int64_t bit_size = type->bit_size;
+
+    if (cursor->product->format != coda_format_binary && cursor->product->format != coda_format_ascii)
+    {
+        /* data is not read via a 'bin' product */
+        return;
+    }
+    if (bit_size < 0)
+    {
+        long num_elements;
+
+        if (type->base_type->bit_size < 0)
+        {
+            /* we don't want to traverse all array elements just to determine the size */
+            return;
+        }
+        if (coda_ascbin_cursor_get_num_elements(cursor, &num_elements) != 0)
+        {
+            /* the error will be raised again when reading the array */
+            return;
+        }
+        bit_size = num_elements * type->base_type->bit_size;
+    }
+    if ((bit_size >> 3) >= CODA_BIN_PREFETCH_MIN_SIZE)
+    {
+        coda_bin_product_prefetch((coda_bin_product *)cursor->product, cursor->stack[cursor->n - 1].bit_offset >> 3,
+                                  ((cursor->stack[cursor->n - 1].bit_offset + bit_size + 7) >> 3) -
+                                  (cursor->stack[cursor->n - 1].bit_offset >> 3));
+    }
+}
+
 int coda_bin_cursor_read_int8_array(const coda_cursor *cursor, int8_t *dst, coda_array_ordering array_ordering)
 {
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
+    prefetch_array(cursor, type);
     if (type->base_type->format == coda_format_binary)
     {
         return read_array(cursor, (read_function)&coda_bin_cursor_read_int8, (uint8_t *)dst, sizeof(int8_t),
@@ -924,6 +959,7 @@ int coda_bin_cursor_read_uint8_array(const coda_cursor *cursor, uint8_t *dst, co
 {
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
+    prefetch_array(cursor, type);
     if (type->base_type->format == coda_format_binary)
     {
         return read_array(cursor, (read_function)&coda_bin_cursor_read_uint8, (uint8_t *)dst, sizeof(uint8_t),
@@ -950,6 +986,7 @@ int coda_bin_cursor_read_int16_array(const coda_cursor *cursor, int16_t *dst, co
 {
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
+    prefetch_array(cursor, type);
     if (type->base_type->format == coda_format_binary)
     {
         return read_array(cursor, (read_function)&coda_bin_cursor_read_int16, (uint8_t *)dst, sizeof(int16_t),
@@ -976,6 +1013,7 @@ int coda_bin_cursor_read_uint16_array(const coda_cursor *cursor, uint16_t *dst,
 {
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
+    prefetch_array(cursor, type);
     if (type->base_type->format == coda_format_binary)
     {
         return read_array(cursor, (read_function)&coda_bin_cursor_read_uint16, (uint8_t *)dst, sizeof(uint16_t),
@@ -1002,6 +1040,7 @@ int coda_bin_cursor_read_int32_array(const coda_cursor *cursor, int32_t *dst, co
 {
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
+    prefetch_array(cursor, type);
     if (type->base_type->format == coda_format_binary)
     {
         return read_array(cursor, (read_function)&coda_bin_cursor_read_int32, (uint8_t *)dst, sizeof(int32_t),
@@ -1028,6 +1067,7 @@ int coda_bin_cursor_read_uint32_array(const coda_cursor *cursor, uint32_t *dst,
 {
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
+    prefetch_array(cursor, type);
     if (type->base_type->format == coda_format_binary)
     {
         return read_array(cursor, (read_function)&coda_bin_cursor_read_uint32, (uint8_t *)dst, sizeof(uint32_t),
@@ -1054,6 +1094,7 @@ int coda_bin_cursor_read_int64_array(const coda_cursor *cursor, int64_t *dst, co
 {
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
+    prefetch_array(cursor, type);
     if (type->base_type->format == coda_format_binary)
     {
         return read_array(cursor, (read_function)&coda_bin_cursor_read_int64, (uint8_t *)dst, sizeof(int64_t),
@@ -1080,6 +1121,7 @@ int coda_bin_cursor_read_uint64_array(const coda_cursor *cursor, uint64_t *dst,
 {
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
+    prefetch_array(cursor, type);
     if (type->base_type->format == coda_format_binary)
     {
         return read_array(cursor, (read_function)&coda_bin_cursor_read_uint64, (uint8_t *)dst, sizeof(uint64_t),
@@ -1106,6 +1148,7 @@ int coda_bin_cursor_read_float_array(const coda_cursor *cursor, float *dst, coda
 {
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
+    prefetch_array(cursor, type);
     if (type->base_type->format == coda_format_binary)
     {
         return read_array(cursor, (read_function)&coda_bin_cursor_read_float, (uint8_t *)dst, sizeof(float),
@@ -1132,6 +1175,7 @@ int coda_bin_cursor_read_double_array(const coda_cursor *cursor, double *dst, co
 {
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
+    prefetch_array(cursor, type);
     if (type->base_type->format == coda_format_binary)
     {
         return read_array(cursor, (read_function)&coda_bin_cursor_read_double, (uint8_t *)dst, sizeof(double),
@@ -1158,6 +1202,7 @@ int coda_bin_cursor_read_char_array(const coda_cursor *cursor, char *dst, coda_a
 {
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
+    prefetch_array(cursor, type);
     if (type->base_type->format == coda_format_binary)
     {
         return read_array(cursor, (read_function)&coda_bin_cursor_read_char, (uint8_t *)dst, sizeof(char),
@@ -34,6 +34,29 @@
 
 #include "coda-bin.h"
 
+/* block cache for reading data from file when mmap() is not used */
+typedef struct coda_bin_read_cache_slot_struct
+{
+    int64_t block_index;        /* file offset of the block divided by the block size (-1 if slot is empty) */
+    int64_t length;     /* number of valid bytes in the block (smaller than block size at end of file) */
+    uint64_t last_access;       /* value of 'access_counter' at last use of the slot (for LRU eviction) */
+} coda_bin_read_cache_slot;
+
+typedef struct coda_bin_read_cache_struct
+{
+    int64_t block_size;
+    int num_slots;
+    uint8_t *buffer;    /* data of all slots (slot i is stored at buffer[i * block_size]) followed by a staging area for
+                         * read-ahead (allocated on first use) */
+    coda_bin_read_cache_slot *slot;
+    uint64_t access_counter;
+    int last_slot;      /* slot that was used for the last read (used to detect sequential access) */
+    coda_access_pattern access_pattern; /* determines when blocks are read ahead */
+    int64_t num_hits;
+    int64_t num_misses;
+    int64_t num_read_ahead;
+} coda_bin_read_cache;
+
 struct coda_bin_product_struct
 {
     /* general fields (shared between all supported product types) */
@@ -50,6 +73,11 @@ struct coda_bin_product_struct
     /* 'bin' product specific fields */
     int use_mmap;       /* indicates whether to use mem_ptr (or the file descriptor 'fd') */
     int fd;     /* file handle when not using mem_ptr */
+    coda_bin_read_cache *read_cache;    /* block cache for reading from 'fd' (NULL if not used) */
+    int is_compressed;  /* is the file compressed (mem_ptr then holds a malloc()ed copy of the decompressed data) */
+    struct coda_gzip_index_struct *gzip_index;  /* index for reading from a compressed 'fd' (NULL if not used) */
+    int is_memory_buffer;       /* is mem_ptr a buffer that is owned by the user (see coda_open_from_memory()) */
+    int64_t file_offset;        /* offset of the product data in the file (non-zero for an entry of a zip file) */
 #ifdef WIN32
     HANDLE file;
     HANDLE file_mapping;
@@ -57,7 +85,26 @@ struct coda_bin_product_struct
 };
 typedef struct coda_bin_product_struct coda_bin_product;
 
+/* minimum size in bytes of an array before a bulk read of the array gets announced to the operating system */
+#define CODA_BIN_PREFETCH_MIN_SIZE 65536
+
+/* byte ranges of a batched read that are at most this many bytes apart get announced as a single range */
+#define CODA_BIN_PREFETCH_MAX_GAP 65536
+
+/* byte range of a batched read */
+typedef struct coda_bin_byte_range_struct
+{
+    int64_t offset;
+    int64_t length;
+    long index; /* position of the range in the batch */
+} coda_bin_byte_range;
+
 int coda_bin_product_open(coda_bin_product *product);
+int coda_bin_product_open_handle(const coda_bin_product *product, coda_bin_product *handle);
 int coda_bin_product_close(coda_bin_product *product);
+int coda_bin_product_read(coda_bin_product *product, int64_t byte_offset, int64_t length, void *dst);
+int coda_bin_product_set_access_pattern(coda_bin_product *product, coda_access_pattern access_pattern);
+int coda_bin_product_prefetch(coda_bin_product *product, int64_t byte_offset, int64_t length);
+int coda_bin_product_prefetch_ranges(coda_bin_product *product, long num_ranges, coda_bin_byte_range *range);
 
 #endif
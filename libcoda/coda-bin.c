@@ -31,6 +31,8 @@
 
 #include "coda-bin-internal.h"
 #include "coda-definition.h"
+#include "coda-gzip.h"
+#include "ziparchive.h"
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -49,10 +51,575 @@
 #endif
 
 
+static coda_bin_read_cache *read_cache_new(int64_t block_size, int num_slots)
+{
+    coda_bin_read_cache *cache;
+    int i;
+
+    cache = malloc(sizeof(coda_bin_read_cache));
+    if (cache == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       sizeof(coda_bin_read_cache), __FILE__, __LINE__);
+        return NULL;
+    }
+    cache->block_size = block_size;
+    cache->num_slots = num_slots;
+    cache->buffer = NULL;
+    cache->access_counter = 0;
+    cache->last_slot = 0;
+    cache->access_pattern = coda_access_pattern_normal;
+    cache->num_hits = 0;
+    cache->num_misses = 0;
+    cache->num_read_ahead = 0;
+    cache->slot = malloc(num_slots * sizeof(coda_bin_read_cache_slot));
+    if (cache->slot == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       num_slots * sizeof(coda_bin_read_cache_slot), __FILE__, __LINE__);
+        free(cache);
+        return NULL;
+    }
+    for (i = 0; i < num_slots; i++)
+    {
+        cache->slot[i].block_index = -1;
+        cache->slot[i].length = 0;
+        cache->slot[i].last_access = 0;
+    }
+
+    return cache;
+}
+
+static void read_cache_delete(coda_bin_read_cache *cache)
+{
+    if (cache->buffer != NULL)
+    {
+        free(cache->buffer);
+    }
+    free(cache->slot);
+    free(cache);
+}
+
+static int read_from_file(coda_bin_product *product, int64_t byte_offset, int64_t length, uint8_t *dst)
+{
+    if (product->gzip_index != NULL)
+    {
+        return coda_gzip_read(product->gzip_index, product->fd, byte_offset, length, dst);
+    }
+    while (length > 0)
+    {
+        int64_t result;
+
+#if HAVE_PREAD
+        result = (int64_t)pread(product->fd, dst, (size_t)length, (off_t)(product->file_offset + byte_offset));
+#else
+        if (lseek(product->fd, (off_t)(product->file_offset + byte_offset), SEEK_SET) < 0)
+        {
+            char byte_offset_str[21];
+
+            coda_str64(byte_offset, byte_offset_str);
+            coda_set_error(CODA_ERROR_FILE_READ, "could not move to byte position %s (%s)", byte_offset_str,
+                           strerror(errno));
+            return -1;
+        }
+        result = (int64_t)read(product->fd, dst, (size_t)length);
+#endif
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            coda_set_error(CODA_ERROR_FILE_READ, "could not read from file (%s)", strerror(errno));
+            return -1;
+        }
+        if (result == 0)
+        {
+            coda_set_error(CODA_ERROR_FILE_READ, "could not read from file (unexpected end of file)");
+            return -1;
+        }
+        byte_offset += result;
+        length -= result;
+        dst += result;
+    }
+
+    return 0;
+}
+
+static int read_cache_has_block(const coda_bin_read_cache *cache, int64_t block_index)
+{
+    int i;
+
+    for (i = 0; i < cache->num_slots; i++)
+    {
+        if (cache->slot[i].block_index == block_index)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* maximum number of blocks that are read at once for sequential access (less than half the cache) */
+static int read_cache_max_read_blocks(const coda_bin_read_cache *cache)
+{
+    return cache->num_slots / 2 > 1 ? cache->num_slots / 2 - 1 : 1;
+}
+
+/* return the least recently used slot of the cache */
+static int read_cache_lru_slot(const coda_bin_read_cache *cache)
+{
+    int index = 0;
+    int i;
+
+    for (i = 1; i < cache->num_slots; i++)
+    {
+        if (cache->slot[i].last_access < cache->slot[index].last_access)
+        {
+            index = i;
+        }
+    }
+
+    return index;
+}
+
+/* store a block that was read into the staging area in the least recently used slot of the cache */
+static int read_cache_store_block(coda_bin_read_cache *cache, int64_t block_index, const uint8_t *data, int64_t length)
+{
+    int index;
+
+    index = read_cache_lru_slot(cache);
+    memcpy(&cache->buffer[index * cache->block_size], data, (size_t)length);
+    cache->slot[index].block_index = block_index;
+    cache->slot[index].length = length;
+    cache->slot[index].last_access = cache->access_counter;
+
+    return index;
+}
+
+/* find (or load) the cache slot containing block 'block_index' of the file */
+static int read_cache_get_slot(coda_bin_product *product, int64_t block_index, int *slot_index)
+{
+    coda_bin_read_cache *cache = product->read_cache;
+    uint8_t *staging_buffer;
+    int64_t num_file_blocks;
+    int64_t length;
+    int num_blocks;
+    int index;
+    int i;
+
+    cache->access_counter++;
+    if (cache->slot[cache->last_slot].block_index == block_index)
+    {
+        cache->slot[cache->last_slot].last_access = cache->access_counter;
+        cache->num_hits++;
+        *slot_index = cache->last_slot;
+        return 0;
+    }
+    for (i = 0; i < cache->num_slots; i++)
+    {
+        if (cache->slot[i].block_index == block_index)
+        {
+            cache->slot[i].last_access = cache->access_counter;
+            cache->last_slot = i;
+            cache->num_hits++;
+            *slot_index = i;
+            return 0;
+        }
+    }
+
+    /* cache miss */
+    num_blocks = 1;
+    if (cache->access_pattern == coda_access_pattern_sequential ||
+        (cache->access_pattern == coda_access_pattern_normal && block_index > 0 &&
+         cache->slot[cache->last_slot].block_index == block_index - 1))
+    {
+        /* sequential access -> also read the blocks that follow */
+        num_file_blocks = (product->file_size + cache->block_size - 1) / cache->block_size;
+        while (num_blocks < read_cache_max_read_blocks(cache) && block_index + num_blocks < num_file_blocks &&
+               !read_cache_has_block(cache, block_index + num_blocks))
+        {
+            num_blocks++;
+        }
+    }
+    length = num_blocks * cache->block_size;
+    if (block_index * cache->block_size + length > product->file_size)
+    {
+        length = product->file_size - block_index * cache->block_size;
+    }
+
+    if (num_blocks == 1)
+    {
+        /* read the block directly into the least recently used slot */
+        index = read_cache_lru_slot(cache);
+        cache->slot[index].block_index = -1;
+        if (read_from_file(product, block_index * cache->block_size, length, &cache->buffer[index * cache->block_size])
+            != 0)
+        {
+            return -1;
+        }
+        cache->slot[index].block_index = block_index;
+        cache->slot[index].length = length;
+        cache->slot[index].last_access = cache->access_counter;
+    }
+    else
+    {
+        /* read all blocks with a single read into the staging area (which follows the slots in the buffer) and then
+         * give each block its own least recently used slot, such that the read-ahead does not evict blocks that were
+         * used recently */
+        staging_buffer = &cache->buffer[cache->num_slots * cache->block_size];
+        if (read_from_file(product, block_index * cache->block_size, length, staging_buffer) != 0)
+        {
+            return -1;
+        }
+        index = read_cache_store_block(cache, block_index, staging_buffer, cache->block_size);
+        for (i = 1; i < num_blocks; i++)
+        {
+            int64_t block_length = length - i * cache->block_size;
+
+            if (block_length > cache->block_size)
+            {
+                block_length = cache->block_size;
+            }
+            read_cache_store_block(cache, block_index + i, &staging_buffer[i * cache->block_size], block_length);
+        }
+    }
+    cache->last_slot = index;
+    cache->num_misses++;
+    cache->num_read_ahead += num_blocks - 1;
+    *slot_index = index;
+
+    return 0;
+}
+
+/* read data from a product that is not accessed via mem_ptr
+ * small reads are served from a block cache (if enabled) such that e.g. reading all individual values of a record
+ * does not result in a system call per value.
+ */
+int coda_bin_product_read(coda_bin_product *product, int64_t byte_offset, int64_t length, void *dst)
+{
+    coda_bin_read_cache *cache = product->read_cache;
+    uint8_t *buffer = (uint8_t *)dst;
+
+    if (cache == NULL || length > cache->block_size)
+    {
+        return read_from_file(product, byte_offset, length, buffer);
+    }
+
+    if (cache->buffer == NULL)
+    {
+        /* the buffer holds the slots followed by a staging area for read-ahead */
+        cache->buffer = malloc((size_t)((cache->num_slots + read_cache_max_read_blocks(cache)) * cache->block_size));
+        if (cache->buffer == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)((cache->num_slots + read_cache_max_read_blocks(cache)) * cache->block_size),
+                           __FILE__, __LINE__);
+            return -1;
+        }
+    }
+
+    while (length > 0)
+    {
+        int64_t block_index;
+        int64_t block_offset;
+        int64_t block_length;
+        int slot_index;
+
+        block_index = byte_offset / cache->block_size;
+        if (read_cache_get_slot(product, block_index, &slot_index) != 0)
+        {
+            return -1;
+        }
+        block_offset = byte_offset - block_index * cache->block_size;
+        block_length = cache->slot[slot_index].length - block_offset;
+        if (block_length <= 0)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_BOUNDS_READ, "trying to read beyond the end of the file");
+            return -1;
+        }
+        if (block_length > length)
+        {
+            block_length = length;
+        }
+        memcpy(buffer, &cache->buffer[slot_index * cache->block_size + block_offset], (size_t)block_length);
+        buffer += block_length;
+        byte_offset += block_length;
+        length -= block_length;
+    }
+
+    return 0;
+}
+
+#ifndef WIN32
+/* offset of mem_ptr with regard to the start of the memory mapping of the file
+ * this is only non-zero for a product inside an archive file, since a mapping has to start at a page boundary
+ */
+static int64_t get_mapping_offset(const coda_bin_product *product)
+{
+    int64_t page_size;
+
+    if (product->file_offset == 0)
+    {
+        return 0;
+    }
+    page_size = (int64_t)sysconf(_SC_PAGESIZE);
+
+    return page_size > 0 ? product->file_offset % page_size : 0;
+}
+#endif
+
+/* pass a hint to the operating system on how the data of the product will be accessed
+ * this only affects performance (failures of the underlying system calls are therefore ignored)
+ */
+int coda_bin_product_set_access_pattern(coda_bin_product *product, coda_access_pattern access_pattern)
+{
+    if (product->is_compressed || product->is_memory_buffer)
+    {
+        /* the data is not backed by the file */
+        if (product->read_cache != NULL)
+        {
+            product->read_cache->access_pattern = access_pattern;
+        }
+        return 0;
+    }
+    if (product->use_mmap)
+    {
+#if defined(HAVE_POSIX_MADVISE) && !defined(WIN32)
+        int advice = POSIX_MADV_NORMAL;
+
+        switch (access_pattern)
+        {
+            case coda_access_pattern_normal:
+                advice = POSIX_MADV_NORMAL;
+                break;
+            case coda_access_pattern_sequential:
+                advice = POSIX_MADV_SEQUENTIAL;
+                break;
+            case coda_access_pattern_random:
+                advice = POSIX_MADV_RANDOM;
+                break;
+        }
+        posix_madvise((void *)(product->mem_ptr - get_mapping_offset(product)),
+                      (size_t)(product->mem_size + get_mapping_offset(product)), advice);
+#endif
+    }
+    else if (product->fd >= 0)
+    {
+#ifdef HAVE_POSIX_FADVISE
+        int advice = POSIX_FADV_NORMAL;
+
+        switch (access_pattern)
+        {
+            case coda_access_pattern_normal:
+                advice = POSIX_FADV_NORMAL;
+                break;
+            case coda_access_pattern_sequential:
+                advice = POSIX_FADV_SEQUENTIAL;
+                break;
+            case coda_access_pattern_random:
+                advice = POSIX_FADV_RANDOM;
+                break;
+        }
+        posix_fadvise(product->fd, (off_t)product->file_offset, 0, advice);
+#endif
+        if (product->read_cache != NULL)
+        {
+            product->read_cache->access_pattern = access_pattern;
+        }
+    }
+
+    return 0;
+}
+
+/* tell the operating system that the given byte range of the product will be read soon
+ * the operating system can then start loading the data in the background
+ */
+int coda_bin_product_prefetch(coda_bin_product *product, int64_t byte_offset, int64_t length)
+{
+    if (byte_offset < 0 || length <= 0 || byte_offset >= product->file_size)
+    {
+        return 0;
+    }
+    if (byte_offset + length > product->file_size)
+    {
+        length = product->file_size - byte_offset;
+    }
+
+    if (product->is_compressed || product->is_memory_buffer)
+    {
+        /* the data is not backed by the file (or offsets do not map to offsets in the file) */
+        return 0;
+    }
+    if (product->use_mmap)
+    {
+#if defined(HAVE_POSIX_MADVISE) && !defined(WIN32)
+        int64_t page_size = (int64_t)sysconf(_SC_PAGESIZE);
+
+        if (page_size > 0)
+        {
+            int64_t page_offset = byte_offset - (product->file_offset + byte_offset) % page_size;
+
+            /* the address passed to posix_madvise() needs to be page aligned */
+            posix_madvise((void *)(product->mem_ptr + page_offset), (size_t)(length + byte_offset - page_offset),
+                          POSIX_MADV_WILLNEED);
+        }
+#endif
+    }
+    else if (product->fd >= 0)
+    {
+#ifdef HAVE_POSIX_FADVISE
+        posix_fadvise(product->fd, (off_t)(product->file_offset + byte_offset), (off_t)length, POSIX_FADV_WILLNEED);
+#endif
+    }
+
+    return 0;
+}
+
+static int compare_byte_ranges(const void *a, const void *b)
+{
+    const coda_bin_byte_range *range_a = (const coda_bin_byte_range *)a;
+    const coda_bin_byte_range *range_b = (const coda_bin_byte_range *)b;
+
+    if (range_a->offset != range_b->offset)
+    {
+        return (range_a->offset < range_b->offset) ? -1 : 1;
+    }
+    if (range_a->index != range_b->index)
+    {
+        return (range_a->index < range_b->index) ? -1 : 1;
+    }
+    return 0;
+}
+
+/* sort the byte ranges of a batched read on file offset and tell the operating system that all ranges will be needed
+ * this allows the operating system to load the data of all ranges concurrently instead of one range at a time when the
+ * ranges are read one by one. Ranges that are close together are announced as a single range.
+ * The caller should read the ranges in the (sorted) order in which they are returned.
+ */
+int coda_bin_product_prefetch_ranges(coda_bin_product *product, long num_ranges, coda_bin_byte_range *range)
+{
+    long i;
+
+    if (num_ranges <= 0)
+    {
+        return 0;
+    }
+    for (i = 1; i < num_ranges; i++)
+    {
+        if (compare_byte_ranges(&range[i - 1], &range[i]) > 0)
+        {
+            qsort(range, num_ranges, sizeof(coda_bin_byte_range), compare_byte_ranges);
+            break;
+        }
+    }
+
+    i = 0;
+    while (i < num_ranges)
+    {
+        int64_t start = range[i].offset;
+        int64_t end = range[i].offset + range[i].length;
+
+        i++;
+        while (i < num_ranges && range[i].offset <= end + CODA_BIN_PREFETCH_MAX_GAP)
+        {
+            if (range[i].offset + range[i].length > end)
+            {
+                end = range[i].offset + range[i].length;
+            }
+            i++;
+        }
+        if (!product->use_mmap && product->read_cache != NULL)
+        {
+            int64_t block_size = product->read_cache->block_size;
+
+            /* small reads will load full cache blocks, so make sure these are announced */
+            start -= start % block_size;
+            end += (block_size - end % block_size) % block_size;
+        }
+        if (coda_bin_product_prefetch(product, start, end - start) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* decompress the gzip file (or raw deflate stream at 'offset') for which 'fd' is the file descriptor
+ * small files are fully decompressed into memory (and accessed via mem_ptr); for large files a random access index is
+ * created and data is decompressed on demand from the file descriptor (ownership of 'fd' is passed to the product)
+ */
+static int decompress_file(coda_bin_product *product, int fd, int64_t offset, int raw_deflate)
+{
+    if (coda_gzip_decompress(fd, offset, raw_deflate, (uint8_t **)&product->mem_ptr, &product->gzip_index,
+                             &product->file_size) != 0)
+    {
+        coda_add_error_message(" for file %s", product->filename);
+        close(fd);
+        return -1;
+    }
+    product->is_compressed = 1;
+    if (product->mem_ptr != NULL)
+    {
+        product->use_mmap = 1;
+        product->mem_size = product->file_size;
+        close(fd);
+    }
+    else
+    {
+        product->fd = fd;
+        /* each read decompresses data, so always use a read cache */
+        product->read_cache = read_cache_new(coda_option_read_cache_block_size,
+                                             coda_option_read_cache_num_blocks > 0 ?
+                                             coda_option_read_cache_num_blocks : 1);
+        if (product->read_cache == NULL)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* check the 'magic' bytes at the start of the file to see whether the file is gzip compressed
+ * an error is returned for compression formats that are not supported
+ */
+static int check_compression(const coda_bin_product *product, const uint8_t *magic, int *is_gzip)
+{
+    *is_gzip = 0;
+    if (magic[0] == 'B' && magic[1] == 'Z' && magic[2] == 'h' && magic[3] >= '1' && magic[3] <= '9' &&
+        magic[4] == 0x31 && magic[5] == 0x41)
+    {
+        coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "bzip2 compressed files are not supported (%s)",
+                       product->filename);
+        return -1;
+    }
+    if (magic[0] == 0xFD && magic[1] == '7' && magic[2] == 'z' && magic[3] == 'X' && magic[4] == 'Z' && magic[5] == 0)
+    {
+        coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "xz compressed files are not supported (%s)",
+                       product->filename);
+        return -1;
+    }
+    if (magic[0] == 0x1F && magic[1] == 0x8B && magic[2] == 8)
+    {
+        *is_gzip = 1;
+    }
+
+    return 0;
+}
+
 int coda_bin_product_open(coda_bin_product *product)
 {
+    int is_gzip = 0;
+
     product->use_mmap = 0;
     product->fd = -1;
+    product->read_cache = NULL;
+    product->is_compressed = 0;
+    product->gzip_index = NULL;
+    product->is_memory_buffer = 0;
+    product->file_offset = 0;
 #ifdef WIN32
     product->file_mapping = INVALID_HANDLE_VALUE;
     product->file = INVALID_HANDLE_VALUE;
@@ -140,6 +707,26 @@ int coda_bin_product_open(coda_bin_product *product)
             }
             return -1;
         }
+
+        if (product->file_size >= 6 && check_compression(product, product->mem_ptr, &is_gzip) != 0)
+        {
+            return -1;
+        }
+        if (is_gzip)
+        {
+            int fd;
+
+            /* replace the file mapping by access to the decompressed data */
+            coda_bin_product_close(product);
+            fd = open(product->filename, _O_RDONLY | _O_BINARY);
+            if (fd < 0)
+            {
+                coda_set_error(CODA_ERROR_FILE_OPEN, "could not open file %s (%s)", product->filename,
+                               strerror(errno));
+                return -1;
+            }
+            return decompress_file(product, fd, 0, 0);
+        }
 #else
         int fd;
 
@@ -161,6 +748,18 @@ int coda_bin_product_open(coda_bin_product *product)
             return -1;
         }
 
+        if (product->file_size >= 6 && check_compression(product, product->mem_ptr, &is_gzip) != 0)
+        {
+            close(fd);
+            return -1;
+        }
+        if (is_gzip)
+        {
+            /* replace the memory mapping by access to the decompressed data */
+            coda_bin_product_close(product);
+            return decompress_file(product, fd, 0, 0);
+        }
+
         /* close file descriptor (the file handle is not needed anymore) */
         close(fd);
 #endif
@@ -184,6 +783,41 @@ int coda_bin_product_open(coda_bin_product *product)
             coda_set_error(CODA_ERROR_FILE_OPEN, "could not open file %s (%s)", product->filename, strerror(errno));
             return -1;
         }
+        if (coda_option_read_cache_num_blocks > 0)
+        {
+            product->read_cache = read_cache_new(coda_option_read_cache_block_size,
+                                                 coda_option_read_cache_num_blocks);
+            if (product->read_cache == NULL)
+            {
+                close(product->fd);
+                product->fd = -1;
+                return -1;
+            }
+        }
+        if (product->file_size >= 6)
+        {
+            uint8_t magic[6];
+
+            /* this read goes via the read cache (if enabled), so the block is reused by the format detection */
+            if (coda_bin_product_read(product, 0, 6, magic) != 0)
+            {
+                coda_add_error_message(" for file %s", product->filename);
+                return -1;
+            }
+            if (check_compression(product, magic, &is_gzip) != 0)
+            {
+                return -1;
+            }
+        }
+        if (is_gzip)
+        {
+            int fd = product->fd;
+
+            /* replace the file access by access to the decompressed data */
+            product->fd = -1;
+            coda_bin_product_close(product);
+            return decompress_file(product, fd, 0, 0);
+        }
     }
 
     return 0;
@@ -191,6 +825,29 @@ int coda_bin_product_open(coda_bin_product *product)
 
 int coda_bin_product_close(coda_bin_product *product)
 {
+    if (product->is_memory_buffer)
+    {
+        /* the buffer is owned by the user */
+        product->mem_ptr = NULL;
+        product->use_mmap = 0;
+        product->is_memory_buffer = 0;
+        return 0;
+    }
+    if (product->is_compressed)
+    {
+        if (product->mem_ptr != NULL)
+        {
+            free((void *)product->mem_ptr);
+            product->mem_ptr = NULL;
+        }
+        product->is_compressed = 0;
+    }
+    if (product->gzip_index != NULL)
+    {
+        /* this is either the index of our own compressed file or one shared with a cached product */
+        coda_gzip_index_delete(product->gzip_index);
+        product->gzip_index = NULL;
+    }
     if (product->use_mmap)
     {
 #ifdef WIN32
@@ -212,7 +869,8 @@ int coda_bin_product_close(coda_bin_product *product)
 #else
         if (product->mem_ptr != NULL)
         {
-            munmap((void *)product->mem_ptr, product->file_size);
+            munmap((void *)(product->mem_ptr - get_mapping_offset(product)),
+                   product->file_size + get_mapping_offset(product));
             product->mem_ptr = NULL;
         }
 #endif
@@ -225,12 +883,84 @@ int coda_bin_product_close(coda_bin_product *product)
             close(product->fd);
             product->fd = -1;
         }
+        if (product->read_cache != NULL)
+        {
+            read_cache_delete(product->read_cache);
+            product->read_cache = NULL;
+        }
     }
 
     return 0;
 }
 
-int coda_bin_open(const char *filename, int64_t file_size, coda_product **product)
+/* open the file access of 'handle' for the same file that 'product' has open (with the same access options)
+ * the decompressed data and gzip access points of a compressed 'product' are shared with 'handle' ('product' should
+ * therefore remain open until 'handle' is closed); all other file access state (file descriptor, memory mapping, read
+ * cache and access pattern) is owned by 'handle'
+ * the general fields of 'handle' (filename, file_size, etc.) should already be set
+ */
+int coda_bin_product_open_handle(const coda_bin_product *product, coda_bin_product *handle)
+{
+    int open_flags;
+
+    handle->mem_ptr = NULL;
+    handle->mem_size = 0;
+    if (!product->is_compressed)
+    {
+        return coda_bin_product_open(handle);
+    }
+
+    handle->use_mmap = 0;
+    handle->fd = -1;
+    handle->read_cache = NULL;
+    handle->is_compressed = 0;  /* the decompressed data is owned by 'product' */
+    handle->gzip_index = NULL;
+    handle->is_memory_buffer = 0;
+    handle->file_offset = product->file_offset;
+#ifdef WIN32
+    handle->file = INVALID_HANDLE_VALUE;
+    handle->file_mapping = INVALID_HANDLE_VALUE;
+#endif
+    if (product->gzip_index == NULL)
+    {
+        /* access the decompressed data of 'product' in the same way as a buffer that is owned by the user */
+        handle->use_mmap = 1;
+        handle->is_memory_buffer = 1;
+        handle->mem_ptr = product->mem_ptr;
+        handle->mem_size = product->mem_size;
+        return 0;
+    }
+
+    open_flags = O_RDONLY;
+#ifdef WIN32
+    open_flags |= _O_BINARY;
+#endif
+    handle->fd = open(handle->filename, open_flags);
+    if (handle->fd < 0)
+    {
+        coda_set_error(CODA_ERROR_FILE_OPEN, "could not open file %s (%s)", handle->filename, strerror(errno));
+        return -1;
+    }
+    handle->gzip_index = coda_gzip_index_share(product->gzip_index);
+    if (handle->gzip_index == NULL)
+    {
+        coda_bin_product_close(handle);
+        return -1;
+    }
+    if (product->read_cache != NULL)
+    {
+        handle->read_cache = read_cache_new(product->read_cache->block_size, product->read_cache->num_slots);
+        if (handle->read_cache == NULL)
+        {
+            coda_bin_product_close(handle);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int bin_product_new(const char *filename, int64_t file_size, coda_bin_product **product)
 {
     coda_bin_product *product_file;
 
@@ -253,6 +983,15 @@ int coda_bin_open(const char *filename, int64_t file_size, coda_product **produc
 
     product_file->use_mmap = 0;
     product_file->fd = -1;
+    product_file->read_cache = NULL;
+    product_file->is_compressed = 0;
+    product_file->gzip_index = NULL;
+    product_file->is_memory_buffer = 0;
+    product_file->file_offset = 0;
+#ifdef WIN32
+    product_file->file = INVALID_HANDLE_VALUE;
+    product_file->file_mapping = INVALID_HANDLE_VALUE;
+#endif
 
     product_file->root_type = (coda_dynamic_type *)coda_type_raw_file_singleton();
     if (product_file->root_type == NULL)
@@ -270,6 +1009,20 @@ int coda_bin_open(const char *filename, int64_t file_size, coda_product **produc
         return -1;
     }
 
+    *product = product_file;
+
+    return 0;
+}
+
+int coda_bin_open(const char *filename, int64_t file_size, coda_product **product)
+{
+    coda_bin_product *product_file;
+
+    if (bin_product_new(filename, file_size, &product_file) != 0)
+    {
+        return -1;
+    }
+
     if (coda_bin_product_open(product_file) != 0)
     {
         coda_bin_close((coda_product *)product_file);
@@ -281,6 +1034,152 @@ int coda_bin_open(const char *filename, int64_t file_size, coda_product **produc
     return 0;
 }
 
+/* open a raw product for data that is already in memory (the buffer remains owned by the caller)
+ * the buffer is accessed via mem_ptr in the same way as a memory mapped file
+ */
+int coda_bin_open_from_memory(const char *filename, const uint8_t *buffer, int64_t buffer_size,
+                              coda_product **product)
+{
+    coda_bin_product *product_file;
+
+    if (bin_product_new(filename, buffer_size, &product_file) != 0)
+    {
+        return -1;
+    }
+
+    product_file->use_mmap = 1;
+    product_file->is_memory_buffer = 1;
+    product_file->mem_ptr = buffer;
+    product_file->mem_size = buffer_size;
+
+    *product = (coda_product *)product_file;
+
+    return 0;
+}
+
+static void handle_ziparchive_error(const char *message, ...)
+{
+    va_list ap;
+
+    coda_set_error(CODA_ERROR_FILE_OPEN, NULL);
+    va_start(ap, message);
+    coda_add_error_message_vargs(message, ap);
+    va_end(ap);
+}
+
+/* open a raw product for an entry of a zip file
+ * stored entries are memory mapped (or read) directly from the zip file; compressed entries are decompressed in the
+ * same way as gzip compressed files
+ */
+int coda_bin_open_archive_entry(const char *filename, const char *archive_filename, const char *entry_name,
+                                coda_product **product)
+{
+    coda_bin_product *product_file;
+    za_file *zf;
+    za_entry *entry;
+    int64_t data_offset;
+    int64_t size;
+    int is_compressed;
+    int open_flags;
+    int fd;
+
+    zf = za_open(archive_filename, handle_ziparchive_error);
+    if (zf == NULL)
+    {
+        return -1;
+    }
+    entry = za_get_entry_by_name(zf, entry_name);
+    if (entry == NULL)
+    {
+        coda_set_error(CODA_ERROR_FILE_NOT_FOUND, "could not find %s in %s", entry_name, archive_filename);
+        za_close(zf);
+        return -1;
+    }
+    if (za_get_entry_data_offset(entry, &data_offset) != 0)
+    {
+        za_close(zf);
+        return -1;
+    }
+    size = za_get_entry_size(entry);
+    is_compressed = za_entry_is_compressed(entry);
+    za_close(zf);
+
+    if (bin_product_new(filename, size, &product_file) != 0)
+    {
+        return -1;
+    }
+    product_file->file_offset = data_offset;
+
+    open_flags = O_RDONLY;
+#ifdef WIN32
+    open_flags |= _O_BINARY;
+#endif
+    fd = open(archive_filename, open_flags);
+    if (fd < 0)
+    {
+        coda_set_error(CODA_ERROR_FILE_OPEN, "could not open file %s (%s)", archive_filename, strerror(errno));
+        coda_bin_close((coda_product *)product_file);
+        return -1;
+    }
+
+    if (is_compressed)
+    {
+        if (decompress_file(product_file, fd, data_offset, 1) != 0)
+        {
+            coda_bin_close((coda_product *)product_file);
+            return -1;
+        }
+        if (product_file->file_size != size)
+        {
+            coda_set_error(CODA_ERROR_FILE_READ, "could not decompress %s (size of decompressed data does not match "
+                           "size in zip file)", filename);
+            coda_bin_close((coda_product *)product_file);
+            return -1;
+        }
+    }
+#ifndef WIN32
+    else if (coda_option_use_mmap && size > 0)
+    {
+        int64_t mapping_offset = get_mapping_offset(product_file);
+        uint8_t *mapping;
+
+        /* the mapping has to start at a page boundary */
+        mapping = (uint8_t *)mmap(0, (size_t)(size + mapping_offset), PROT_READ, MAP_SHARED, fd,
+                                  (off_t)(data_offset - mapping_offset));
+        if (mapping == (uint8_t *)MAP_FAILED)
+        {
+            coda_set_error(CODA_ERROR_FILE_OPEN, "could not map file %s into memory (%s)", archive_filename,
+                           strerror(errno));
+            close(fd);
+            coda_bin_close((coda_product *)product_file);
+            return -1;
+        }
+        close(fd);
+        product_file->use_mmap = 1;
+        product_file->mem_ptr = mapping + mapping_offset;
+        product_file->mem_size = size;
+    }
+#endif
+    else
+    {
+        product_file->fd = fd;
+        if (coda_option_read_cache_num_blocks > 0)
+        {
+            product_file->read_cache = read_cache_new(coda_option_read_cache_block_size,
+                                                      coda_option_read_cache_num_blocks);
+            if (product_file->read_cache == NULL)
+            {
+                coda_bin_close((coda_product *)product_file);
+                return -1;
+            }
+        }
+    }
+
+    *product = (coda_product *)product_file;
+
+    return 0;
+}
+
 int coda_bin_reopen_with_definition(coda_product **product, const coda_product_definition *definition)
 {
     coda_bin_product *product_file = *(coda_bin_product **)product;
@@ -35,6 +35,10 @@
 #include "coda-internal.h"
 
 int coda_bin_open(const char *filename, int64_t file_size, coda_product **product);
+int coda_bin_open_from_memory(const char *filename, const uint8_t *buffer, int64_t buffer_size,
+                              coda_product **product);
+int coda_bin_open_archive_entry(const char *filename, const char *archive_filename, const char *entry_name,
+                                coda_product **product);
 int coda_bin_reopen_with_definition(coda_product **product, const coda_product_definition *definition);
 int coda_bin_close(coda_product *product);
 
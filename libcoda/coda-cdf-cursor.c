@@ -104,12 +104,12 @@ int coda_cdf_cursor_goto_array_element(coda_cursor *cursor, int num_subs, const
     return 0;
 }
 
-int coda_cdf_cursor_goto_array_element_by_index(coda_cursor *cursor, long index)
+int coda_cdf_cursor_goto_array_element_by_index(coda_cursor *cursor, long index, int perform_boundary_checks)
 {
     coda_dynamic_type *base_type;
 
     /* check the range for index */
-    if (coda_option_perform_boundary_checks)
+    if (perform_boundary_checks)
     {
         long num_elements;
 
@@ -132,9 +132,9 @@ int coda_cdf_cursor_goto_array_element_by_index(coda_cursor *cursor, long index)
     return 0;
 }
 
-int coda_cdf_cursor_goto_next_array_element(coda_cursor *cursor)
+int coda_cdf_cursor_goto_next_array_element(coda_cursor *cursor, int perform_boundary_checks)
 {
-    if (coda_option_perform_boundary_checks)
+    if (perform_boundary_checks)
     {
         long num_elements;
         long index;
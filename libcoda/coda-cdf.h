@@ -41,8 +41,8 @@ void coda_cdf_type_delete(coda_dynamic_type *type);
 
 int coda_cdf_cursor_set_product(coda_cursor *cursor, coda_product *product);
 int coda_cdf_cursor_goto_array_element(coda_cursor *cursor, int num_subs, const long subs[]);
-int coda_cdf_cursor_goto_array_element_by_index(coda_cursor *cursor, long index);
-int coda_cdf_cursor_goto_next_array_element(coda_cursor *cursor);
+int coda_cdf_cursor_goto_array_element_by_index(coda_cursor *cursor, long index, int perform_boundary_checks);
+int coda_cdf_cursor_goto_next_array_element(coda_cursor *cursor, int perform_boundary_checks);
 int coda_cdf_cursor_goto_attributes(coda_cursor *cursor);
 int coda_cdf_cursor_use_base_type_of_special_type(coda_cursor *cursor);
 int coda_cdf_cursor_get_string_length(const coda_cursor *cursor, long *length);
@@ -40,6 +40,119 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* maximum size of the blocks that are read at once when checking the data of an array of simple binary elements */
+#define CHECK_READ_BLOCK_SIZE (1024 * 1024)
+
+/* Returns whether a binary type has a fixed size and a content for which check_data() can never report an error.
+ * For arrays of such elements there is no need to traverse each element individually.
+ */
+static int is_simple_binary_type(const coda_type *type)
+{
+    if (type->format != coda_format_binary || type->bit_size < 0 || type->size_expr != NULL ||
+        type->attributes != NULL)
+    {
+        return 0;
+    }
+    switch (type->type_class)
+    {
+        case coda_array_class:
+            {
+                const coda_type_array *array = (const coda_type_array *)type;
+                int i;
+
+                for (i = 0; i < array->num_dims; i++)
+                {
+                    if (array->dim_expr[i] != NULL)
+                    {
+                        return 0;
+                    }
+                }
+                return is_simple_binary_type(array->base_type);
+            }
+        case coda_record_class:
+            {
+                const coda_type_record *record = (const coda_type_record *)type;
+                long i;
+
+                if (record->is_union || record->has_optional_fields)
+                {
+                    return 0;
+                }
+                for (i = 0; i < record->num_fields; i++)
+                {
+                    if (record->field[i]->bit_offset_expr != NULL || !is_simple_binary_type(record->field[i]->type))
+                    {
+                        return 0;
+                    }
+                }
+                return 1;
+            }
+        case coda_integer_class:
+        case coda_real_class:
+            return ((const coda_type_number *)type)->mappings == NULL;
+        case coda_text_class:
+            return ((const coda_type_text *)type)->fixed_value == NULL &&
+                ((const coda_type_text *)type)->special_text_type == ascii_text_default;
+        case coda_raw_class:
+            return ((const coda_type_raw *)type)->fixed_value == NULL;
+        case coda_special_class:
+            /* values of special types (such as time values) may fail to be interpreted */
+            return 0;
+    }
+
+    assert(0);
+    exit(1);
+}
+
+/* perform the check of an array of simple binary elements (see is_simple_binary_type()) as a whole */
+static int check_simple_binary_array(const coda_cursor *cursor, const coda_type_array *array, long num_elements,
+                                     int read_check, int size_check, int64_t *bit_size)
+{
+    int64_t array_bit_size = num_elements * array->base_type->bit_size;
+
+    if (size_check)
+    {
+        *bit_size += array_bit_size;
+    }
+    if (read_check && array_bit_size > 0)
+    {
+        uint8_t *buffer;
+        int64_t buffer_size;
+        int64_t bit_offset;
+
+        /* the elements can not contain invalid content, but we still read all data to verify that it is readable */
+        buffer_size = (array_bit_size + 7) >> 3;
+        if (buffer_size > CHECK_READ_BLOCK_SIZE)
+        {
+            buffer_size = CHECK_READ_BLOCK_SIZE;
+        }
+        buffer = (uint8_t *)malloc((size_t)buffer_size);
+        if (buffer == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)buffer_size, __FILE__, __LINE__);
+            return -1;
+        }
+        for (bit_offset = 0; bit_offset < array_bit_size; bit_offset += 8 * CHECK_READ_BLOCK_SIZE)
+        {
+            int64_t bit_length = array_bit_size - bit_offset;
+
+            if (bit_length > 8 * CHECK_READ_BLOCK_SIZE)
+            {
+                bit_length = 8 * CHECK_READ_BLOCK_SIZE;
+            }
+            if (coda_cursor_read_bits(cursor, buffer, bit_offset, bit_length) != 0)
+            {
+                free(buffer);
+                return -1;
+            }
+        }
+        free(buffer);
+    }
+
+    return 0;
+}
+
 static int check_definition(coda_cursor *cursor, coda_type **definition,
                             void (*callbackfunc) (coda_cursor *, const char *, void *), void *userdata)
 {
@@ -625,7 +738,17 @@ static int check_data(coda_cursor *cursor, coda_type **definition, int read_chec
                     {
                         return -1;
                     }
-                    if (num_elements > 0)
+                    if (num_elements > 0 && *definition == NULL &&
+                        cursor->stack[cursor->n - 1].type->backend == coda_backend_binary &&
+                        is_simple_binary_type(((coda_type_array *)type)->base_type))
+                    {
+                        if (check_simple_binary_array(cursor, (coda_type_array *)type, num_elements, read_check,
+                                                      size_check, bit_size) != 0)
+                        {
+                            return -1;
+                        }
+                    }
+                    else if (num_elements > 0)
                     {
                         if (coda_cursor_goto_first_array_element(cursor) != 0)
                         {
@@ -729,10 +852,8 @@ static int check_data(coda_cursor *cursor, coda_type **definition, int read_chec
                     if (size_check && ((coda_type_record *)type)->size_expr != NULL)
                     {
                         int64_t fast_size;
-                        int prev_option_value = coda_get_option_use_fast_size_expressions();
 
-                        coda_set_option_use_fast_size_expressions(1);
-                        if (coda_cursor_get_bit_size(cursor, &fast_size) != 0)
+                        if (coda_cursor_get_bit_size_with_fast_size_option(cursor, 1, &fast_size) != 0)
                         {
                             callbackfunc(cursor, coda_errno_to_string(coda_errno), userdata);
                             skip_mem_size_check = 1;
@@ -757,7 +878,6 @@ static int check_data(coda_cursor *cursor, coda_type **definition, int read_chec
                                     "does not match expression result %s)", s1, s2);
                             callbackfunc(cursor, error_message, userdata);
                         }
-                        coda_set_option_use_fast_size_expressions(prev_option_value);
                     }
                 }
                 break;
@@ -911,18 +1031,12 @@ LIBCODA_API int coda_product_check(coda_product *product, int full_read_check,
 
     if (size_check && !full_read_check)
     {
-        int prev_option_value;
-
         /* we explicitly disable the use of fast size expressions because we also want to verify the structural
          * integrity within each record. */
-        prev_option_value = coda_get_option_use_fast_size_expressions();
-        coda_set_option_use_fast_size_expressions(0);
-        if (coda_cursor_get_bit_size(&cursor, &calculated_file_size) != 0)
+        if (coda_cursor_get_bit_size_with_fast_size_option(&cursor, 0, &calculated_file_size) != 0)
         {
-            coda_set_option_use_fast_size_expressions(prev_option_value);
             return -1;
         }
-        coda_set_option_use_fast_size_expressions(prev_option_value);
     }
     else
     {
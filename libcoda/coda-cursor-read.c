@@ -43,7 +43,7 @@
 
 #include "coda-ascbin.h"
 #include "coda-ascii.h"
-#include "coda-bin.h"
+#include "coda-bin-internal.h"
 #include "coda-mem.h"
 #include "coda-cdf.h"
 #include "coda-netcdf.h"
@@ -2143,42 +2143,8 @@ LIBCODA_API int coda_cursor_read_uint32(const coda_cursor *cursor, uint32_t *dst
     return 0;
 }
 
-/** Retrieve data as type \c int64 from the product file. The value is stored in \a dst.
- * The cursor must point to data with one of the following read types to succeed:
- * - \c int8
- * - \c uint8
- * - \c int16
- * - \c uint16
- * - \c int32
- * - \c uint32
- * - \c int64
- *
- * For all other data types the function will return an error.
- * \param cursor Pointer to a CODA cursor.
- * \param dst Pointer to the variable where the value that was read from the product will be stored.
- * \return
- *   \arg \c 0, Success.
- *   \arg \c -1, Error occurred (check #coda_errno).
- */
-LIBCODA_API int coda_cursor_read_int64(const coda_cursor *cursor, int64_t *dst)
+static int read_int64_value(const coda_cursor *cursor, coda_native_type read_type, int64_t *dst)
 {
-    coda_native_type read_type;
-
-    if (cursor == NULL || cursor->n <= 0 || cursor->stack[cursor->n - 1].type == NULL)
-    {
-        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid cursor argument (%s:%u)", __FILE__, __LINE__);
-        return -1;
-    }
-    if (dst == NULL)
-    {
-        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "dst argument is NULL (%s:%u)", __FILE__, __LINE__);
-        return -1;
-    }
-
-    if (get_read_type(cursor, &read_type) != 0)
-    {
-        return -1;
-    }
     switch (read_type)
     {
         case coda_native_type_int8:
@@ -2262,6 +2228,46 @@ LIBCODA_API int coda_cursor_read_int64(const coda_cursor *cursor, int64_t *dst)
     return 0;
 }
 
+/** Retrieve data as type \c int64 from the product file. The value is stored in \a dst.
+ * The cursor must point to data with one of the following read types to succeed:
+ * - \c int8
+ * - \c uint8
+ * - \c int16
+ * - \c uint16
+ * - \c int32
+ * - \c uint32
+ * - \c int64
+ *
+ * For all other data types the function will return an error.
+ * \param cursor Pointer to a CODA cursor.
+ * \param dst Pointer to the variable where the value that was read from the product will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_read_int64(const coda_cursor *cursor, int64_t *dst)
+{
+    coda_native_type read_type;
+
+    if (cursor == NULL || cursor->n <= 0 || cursor->stack[cursor->n - 1].type == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid cursor argument (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (dst == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "dst argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    if (get_read_type(cursor, &read_type) != 0)
+    {
+        return -1;
+    }
+
+    return read_int64_value(cursor, read_type, dst);
+}
+
 /** Retrieve data as type \c uint64 from the product file. The value is stored in \a dst.
  * The cursor must point to data with one of the following read types to succeed:
  * - \c uint8
@@ -2513,46 +2519,8 @@ LIBCODA_API int coda_cursor_read_float(const coda_cursor *cursor, float *dst)
     return 0;
 }
 
-/** Retrieve data as type \c double from the product file. The value is stored in \a dst.
- * The cursor must point to data with one of the following read types to succeed:
- * - \c int8
- * - \c uint8
- * - \c int16
- * - \c uint16
- * - \c int32
- * - \c uint32
- * - \c int64
- * - \c uint64
- * - \c float
- * - \c double
- *
- * For all other data types the function will return an error.
- * \param cursor Pointer to a CODA cursor.
- * \param dst Pointer to the variable where the value that was read from the product will be stored.
- * \return
- *   \arg \c 0, Success.
- *   \arg \c -1, Error occurred (check #coda_errno).
- */
-LIBCODA_API int coda_cursor_read_double(const coda_cursor *cursor, double *dst)
+static int read_double_value(const coda_cursor *cursor, coda_native_type read_type, double *dst)
 {
-    coda_native_type read_type;
-    coda_conversion *conversion;
-
-    if (cursor == NULL || cursor->n <= 0 || cursor->stack[cursor->n - 1].type == NULL)
-    {
-        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid cursor argument (%s:%u)", __FILE__, __LINE__);
-        return -1;
-    }
-    if (dst == NULL)
-    {
-        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "dst argument is NULL (%s:%u)", __FILE__, __LINE__);
-        return -1;
-    }
-
-    if (get_unconverted_read_type(cursor, &read_type, &conversion) != 0)
-    {
-        return -1;
-    }
     switch (read_type)
     {
         case coda_native_type_int8:
@@ -2665,6 +2633,54 @@ LIBCODA_API int coda_cursor_read_double(const coda_cursor *cursor, double *dst)
                            coda_type_get_native_type_name(read_type));
             return -1;
     }
+
+    return 0;
+}
+
+/** Retrieve data as type \c double from the product file. The value is stored in \a dst.
+ * The cursor must point to data with one of the following read types to succeed:
+ * - \c int8
+ * - \c uint8
+ * - \c int16
+ * - \c uint16
+ * - \c int32
+ * - \c uint32
+ * - \c int64
+ * - \c uint64
+ * - \c float
+ * - \c double
+ *
+ * For all other data types the function will return an error.
+ * \param cursor Pointer to a CODA cursor.
+ * \param dst Pointer to the variable where the value that was read from the product will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_read_double(const coda_cursor *cursor, double *dst)
+{
+    coda_native_type read_type;
+    coda_conversion *conversion;
+
+    if (cursor == NULL || cursor->n <= 0 || cursor->stack[cursor->n - 1].type == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid cursor argument (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (dst == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "dst argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    if (get_unconverted_read_type(cursor, &read_type, &conversion) != 0)
+    {
+        return -1;
+    }
+    if (read_double_value(cursor, read_type, dst) != 0)
+    {
+        return -1;
+    }
     if (conversion != NULL)
     {
         if (*dst == conversion->invalid_value)
@@ -2680,6 +2696,355 @@ LIBCODA_API int coda_cursor_read_double(const coda_cursor *cursor, double *dst)
     return 0;
 }
 
+/* Read an integer value without applying a conversion, regardless of the coda_set_option_perform_conversions()
+ * setting. Data with read type uint64 is read as uint64 and cast to int64.
+ * This is used by the expression evaluator, which should not temporarily change the global option (since that is not
+ * thread-safe).
+ */
+int coda_cursor_read_unconverted_int64(const coda_cursor *cursor, int64_t *dst)
+{
+    coda_native_type read_type = coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type)->read_type;
+
+    if (read_type == coda_native_type_uint64)
+    {
+        uint64_t value;
+
+        if (read_uint64(cursor, &value) != 0)
+        {
+            return -1;
+        }
+        *dst = (int64_t)value;
+        return 0;
+    }
+
+    return read_int64_value(cursor, read_type, dst);
+}
+
+/* Read a floating point value without applying a conversion (see coda_cursor_read_unconverted_int64()) */
+int coda_cursor_read_unconverted_double(const coda_cursor *cursor, double *dst)
+{
+    return read_double_value(cursor, coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type)->read_type,
+                             dst);
+}
+
+/* read a value for a single element of a field array (see read_field_array()) */
+static int read_field_value(const coda_cursor *cursor, coda_native_type dst_type, void *dst, long index)
+{
+    switch (dst_type)
+    {
+        case coda_native_type_int8:
+            return coda_cursor_read_int8(cursor, &((int8_t *)dst)[index]);
+        case coda_native_type_uint8:
+            return coda_cursor_read_uint8(cursor, &((uint8_t *)dst)[index]);
+        case coda_native_type_int16:
+            return coda_cursor_read_int16(cursor, &((int16_t *)dst)[index]);
+        case coda_native_type_uint16:
+            return coda_cursor_read_uint16(cursor, &((uint16_t *)dst)[index]);
+        case coda_native_type_int32:
+            return coda_cursor_read_int32(cursor, &((int32_t *)dst)[index]);
+        case coda_native_type_uint32:
+            return coda_cursor_read_uint32(cursor, &((uint32_t *)dst)[index]);
+        case coda_native_type_int64:
+            return coda_cursor_read_int64(cursor, &((int64_t *)dst)[index]);
+        case coda_native_type_uint64:
+            return coda_cursor_read_uint64(cursor, &((uint64_t *)dst)[index]);
+        case coda_native_type_float:
+            return coda_cursor_read_float(cursor, &((float *)dst)[index]);
+        case coda_native_type_double:
+            return coda_cursor_read_double(cursor, &((double *)dst)[index]);
+        default:
+            break;
+    }
+
+    assert(0);
+    exit(1);
+}
+
+/* Read the data at 'path' (relative to an array element) for each element of the array that the cursor points to.
+ * The path is only resolved once (for the first element). If the data is binary and the data is at the same position
+ * within each element (i.e. each element has the same fixed size and the path does not go through a union or an
+ * optional field) the position of the data for each element is calculated directly. Otherwise the navigation to the
+ * data is repeated for each element using the record field and array element indices found for the first element.
+ */
+static int read_field_array(const coda_cursor *cursor, const char *path, coda_native_type dst_type, void *dst)
+{
+    coda_cursor element_cursor;
+    coda_cursor field_cursor;
+    coda_cursor resolved_cursor;
+    coda_type *type;
+    long num_elements;
+    int has_fixed_position;
+    int element_depth;
+    long i;
+    int k;
+
+    if (cursor == NULL || cursor->n <= 0 || cursor->stack[cursor->n - 1].type == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid cursor argument (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (path == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (dst == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "dst argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    type = coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
+    if (type->type_class != coda_array_class)
+    {
+        coda_set_error(CODA_ERROR_INVALID_TYPE, "cursor does not refer to an array (current type is %s)",
+                       coda_type_get_class_name(type->type_class));
+        return -1;
+    }
+    if (coda_cursor_get_num_elements(cursor, &num_elements) != 0)
+    {
+        return -1;
+    }
+    if (num_elements == 0)
+    {
+        return 0;
+    }
+
+    element_cursor = *cursor;
+    if (coda_cursor_goto_first_array_element(&element_cursor) != 0)
+    {
+        return -1;
+    }
+    element_depth = element_cursor.n;
+    resolved_cursor = element_cursor;
+    if (coda_cursor_goto(&resolved_cursor, path) != 0)
+    {
+        return -1;
+    }
+    if (resolved_cursor.n < element_depth)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path '%s' does not refer to data within an array element", path);
+        return -1;
+    }
+    for (k = 0; k < element_depth; k++)
+    {
+        if (resolved_cursor.stack[k].type != element_cursor.stack[k].type ||
+            resolved_cursor.stack[k].index != element_cursor.stack[k].index)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path '%s' does not refer to data within an array element",
+                           path);
+            return -1;
+        }
+    }
+
+    has_fixed_position = (cursor->stack[cursor->n - 1].type->backend == coda_backend_binary &&
+                          ((coda_type_array *)type)->base_type->bit_size >= 0);
+    for (k = element_depth; k < resolved_cursor.n && has_fixed_position; k++)
+    {
+        coda_type *parent_type = coda_get_type_for_dynamic_type(resolved_cursor.stack[k - 1].type);
+
+        if (resolved_cursor.stack[k].index < 0 || resolved_cursor.stack[k].bit_offset < 0)
+        {
+            /* attributes */
+            has_fixed_position = 0;
+        }
+        else if (parent_type->type_class == coda_record_class)
+        {
+            coda_type_record *record = (coda_type_record *)parent_type;
+            coda_type_record_field *field = record->field[resolved_cursor.stack[k].index];
+
+            if (record->is_union || field->optional || field->bit_offset_expr != NULL)
+            {
+                has_fixed_position = 0;
+            }
+        }
+        else if (parent_type->type_class != coda_array_class)
+        {
+            has_fixed_position = 0;
+        }
+    }
+
+    if (has_fixed_position)
+    {
+        int64_t stride = ((coda_type_array *)type)->base_type->bit_size;
+
+        /* all elements have the same layout, so we only need to shift the cursor by the element size */
+        field_cursor = resolved_cursor;
+        for (i = 0; i < num_elements; i++)
+        {
+            if (i > 0)
+            {
+                for (k = element_depth - 1; k < field_cursor.n; k++)
+                {
+                    field_cursor.stack[k].bit_offset += stride;
+                }
+                field_cursor.stack[element_depth - 1].index = i;
+            }
+            if (read_field_value(&field_cursor, dst_type, dst, i) != 0)
+            {
+                return -1;
+            }
+        }
+        return 0;
+    }
+
+    for (i = 0; i < num_elements; i++)
+    {
+        if (i == 0)
+        {
+            field_cursor = resolved_cursor;
+        }
+        else
+        {
+            if (coda_cursor_goto_next_array_element(&element_cursor) != 0)
+            {
+                return -1;
+            }
+            field_cursor = element_cursor;
+            for (k = element_depth; k < resolved_cursor.n; k++)
+            {
+                coda_type_class type_class;
+
+                if (resolved_cursor.stack[k].index < 0)
+                {
+                    if (coda_cursor_goto_attributes(&field_cursor) != 0)
+                    {
+                        return -1;
+                    }
+                    continue;
+                }
+                if (coda_cursor_get_type_class(&field_cursor, &type_class) != 0)
+                {
+                    return -1;
+                }
+                if (type_class == coda_record_class)
+                {
+                    if (coda_cursor_goto_record_field_by_index(&field_cursor, resolved_cursor.stack[k].index) != 0)
+                    {
+                        return -1;
+                    }
+                }
+                else
+                {
+                    if (coda_cursor_goto_array_element_by_index(&field_cursor, resolved_cursor.stack[k].index) != 0)
+                    {
+                        return -1;
+                    }
+                }
+            }
+        }
+        if (read_field_value(&field_cursor, dst_type, dst, i) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/** Retrieve data as type \c double for a batch of cursors. The value for \a cursor[i] is stored in \a dst[i].
+ * This function gives the same result as calling coda_cursor_read_double() for each of the \a num_cursors cursors,
+ * but is faster when reading many scattered values (such as a single field from each record of a large array of
+ * records) from storage with a high latency.
+ * For structured ascii and binary products the file locations of all values are first announced to the operating
+ * system (see coda_prefetch_product_data()) such that data that is not yet in memory can be loaded concurrently,
+ * after which the values are read in order of their position in the file.
+ * All cursors should point to data from the same product.
+ * \param cursor Array of \a num_cursors CODA cursors.
+ * \param num_cursors Number of cursors.
+ * \param dst Pointer to the array of \a num_cursors values where the values that were read will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_read_double_batch(const coda_cursor *cursor, long num_cursors, double *dst)
+{
+    coda_bin_byte_range *range;
+    coda_product *product;
+    long i;
+
+    if (num_cursors < 0)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "num_cursors argument is negative (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (num_cursors == 0)
+    {
+        return 0;
+    }
+    if (cursor == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "cursor argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (dst == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "dst argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    product = cursor[0].product;
+    if (product == NULL || (product->format != coda_format_ascii && product->format != coda_format_binary))
+    {
+        /* only data from ascii/binary products is read via the 'bin' backend */
+        for (i = 0; i < num_cursors; i++)
+        {
+            if (coda_cursor_read_double(&cursor[i], &dst[i]) != 0)
+            {
+                return -1;
+            }
+        }
+        return 0;
+    }
+
+    range = malloc(num_cursors * sizeof(coda_bin_byte_range));
+    if (range == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       num_cursors * sizeof(coda_bin_byte_range), __FILE__, __LINE__);
+        return -1;
+    }
+    for (i = 0; i < num_cursors; i++)
+    {
+        range[i].offset = 0;
+        range[i].length = 0;
+        range[i].index = i;
+        if (cursor[i].product != product)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "cursors in batch do not all point to the same product "
+                           "(%s:%u)", __FILE__, __LINE__);
+            free(range);
+            return -1;
+        }
+        if (cursor[i].n > 0 && cursor[i].stack[cursor[i].n - 1].type != NULL &&
+            cursor[i].stack[cursor[i].n - 1].bit_offset >= 0)
+        {
+            int64_t bit_size = coda_get_type_for_dynamic_type(cursor[i].stack[cursor[i].n - 1].type)->bit_size;
+
+            range[i].offset = cursor[i].stack[cursor[i].n - 1].bit_offset >> 3;
+            /* if the size is not fixed we just announce the first byte (which brings in the whole page) */
+            range[i].length = bit_size > 0 ? ((cursor[i].stack[cursor[i].n - 1].bit_offset + bit_size + 7) >> 3) -
+                range[i].offset : 1;
+        }
+    }
+    if (coda_bin_product_prefetch_ranges((coda_bin_product *)product, num_cursors, range) != 0)
+    {
+        free(range);
+        return -1;
+    }
+    for (i = 0; i < num_cursors; i++)
+    {
+        if (coda_cursor_read_double(&cursor[range[i].index], &dst[range[i].index]) != 0)
+        {
+            free(range);
+            return -1;
+        }
+    }
+    free(range);
+
+    return 0;
+}
+
 /** Retrieve data as type \c char from the product file. The value is stored in \a dst.
  * The cursor must point to data with read type \c char to succeed.
  * For all other data types the function will return an error.
@@ -5735,4 +6100,162 @@ LIBCODA_API int coda_cursor_read_complex_double_split_array(const coda_cursor *c
                             sizeof(double), array_ordering);
 }
 
+/** Retrieve a field from each element of an array as type \c int8. The values are stored in \a dst.
+ * This function is the same as coda_cursor_read_double_field_array() except that the values are read using
+ * coda_cursor_read_int8().
+ * \param cursor Pointer to a CODA cursor.
+ * \param path Path to the data within an array element.
+ * \param dst Pointer to the variable where the values read from the product will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_read_int8_field_array(const coda_cursor *cursor, const char *path, int8_t *dst)
+{
+    return read_field_array(cursor, path, coda_native_type_int8, dst);
+}
+
+/** Retrieve a field from each element of an array as type \c uint8. The values are stored in \a dst.
+ * This function is the same as coda_cursor_read_double_field_array() except that the values are read using
+ * coda_cursor_read_uint8().
+ * \param cursor Pointer to a CODA cursor.
+ * \param path Path to the data within an array element.
+ * \param dst Pointer to the variable where the values read from the product will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_read_uint8_field_array(const coda_cursor *cursor, const char *path, uint8_t *dst)
+{
+    return read_field_array(cursor, path, coda_native_type_uint8, dst);
+}
+
+/** Retrieve a field from each element of an array as type \c int16. The values are stored in \a dst.
+ * This function is the same as coda_cursor_read_double_field_array() except that the values are read using
+ * coda_cursor_read_int16().
+ * \param cursor Pointer to a CODA cursor.
+ * \param path Path to the data within an array element.
+ * \param dst Pointer to the variable where the values read from the product will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_read_int16_field_array(const coda_cursor *cursor, const char *path, int16_t *dst)
+{
+    return read_field_array(cursor, path, coda_native_type_int16, dst);
+}
+
+/** Retrieve a field from each element of an array as type \c uint16. The values are stored in \a dst.
+ * This function is the same as coda_cursor_read_double_field_array() except that the values are read using
+ * coda_cursor_read_uint16().
+ * \param cursor Pointer to a CODA cursor.
+ * \param path Path to the data within an array element.
+ * \param dst Pointer to the variable where the values read from the product will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_read_uint16_field_array(const coda_cursor *cursor, const char *path, uint16_t *dst)
+{
+    return read_field_array(cursor, path, coda_native_type_uint16, dst);
+}
+
+/** Retrieve a field from each element of an array as type \c int32. The values are stored in \a dst.
+ * This function is the same as coda_cursor_read_double_field_array() except that the values are read using
+ * coda_cursor_read_int32().
+ * \param cursor Pointer to a CODA cursor.
+ * \param path Path to the data within an array element.
+ * \param dst Pointer to the variable where the values read from the product will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_read_int32_field_array(const coda_cursor *cursor, const char *path, int32_t *dst)
+{
+    return read_field_array(cursor, path, coda_native_type_int32, dst);
+}
+
+/** Retrieve a field from each element of an array as type \c uint32. The values are stored in \a dst.
+ * This function is the same as coda_cursor_read_double_field_array() except that the values are read using
+ * coda_cursor_read_uint32().
+ * \param cursor Pointer to a CODA cursor.
+ * \param path Path to the data within an array element.
+ * \param dst Pointer to the variable where the values read from the product will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_read_uint32_field_array(const coda_cursor *cursor, const char *path, uint32_t *dst)
+{
+    return read_field_array(cursor, path, coda_native_type_uint32, dst);
+}
+
+/** Retrieve a field from each element of an array as type \c int64. The values are stored in \a dst.
+ * This function is the same as coda_cursor_read_double_field_array() except that the values are read using
+ * coda_cursor_read_int64().
+ * \param cursor Pointer to a CODA cursor.
+ * \param path Path to the data within an array element.
+ * \param dst Pointer to the variable where the values read from the product will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_read_int64_field_array(const coda_cursor *cursor, const char *path, int64_t *dst)
+{
+    return read_field_array(cursor, path, coda_native_type_int64, dst);
+}
+
+/** Retrieve a field from each element of an array as type \c uint64. The values are stored in \a dst.
+ * This function is the same as coda_cursor_read_double_field_array() except that the values are read using
+ * coda_cursor_read_uint64().
+ * \param cursor Pointer to a CODA cursor.
+ * \param path Path to the data within an array element.
+ * \param dst Pointer to the variable where the values read from the product will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_read_uint64_field_array(const coda_cursor *cursor, const char *path, uint64_t *dst)
+{
+    return read_field_array(cursor, path, coda_native_type_uint64, dst);
+}
+
+/** Retrieve a field from each element of an array as type \c float. The values are stored in \a dst.
+ * This function is the same as coda_cursor_read_double_field_array() except that the values are read using
+ * coda_cursor_read_float().
+ * \param cursor Pointer to a CODA cursor.
+ * \param path Path to the data within an array element.
+ * \param dst Pointer to the variable where the values read from the product will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_read_float_field_array(const coda_cursor *cursor, const char *path, float *dst)
+{
+    return read_field_array(cursor, path, coda_native_type_float, dst);
+}
+
+/** Retrieve a field from each element of an array as type \c double. The values are stored in \a dst.
+ * The cursor must point to an array (typically an array of records) and \a path must refer to data within an element
+ * of that array (e.g. "geolocation/latitude"). The value at \a path is read for each element of the array and stored in
+ * \a dst, which must have room for as many values as there are elements in the array (in C array ordering).
+ * This gives the same result as navigating to \a path for each array element and calling coda_cursor_read_double(),
+ * but the path is only resolved once. For binary data where the array elements have a fixed size and \a path does not
+ * go through a union or an optional field, the position of the value in each element is calculated directly without
+ * any navigation of the cursor. In all other cases the cursor navigation for the first element is repeated (using the
+ * same field and array indices) for each next element.
+ * The \a path should be a relative path (see coda_cursor_goto()) and should refer to data that can be read using
+ * coda_cursor_read_double().
+ * \param cursor Pointer to a CODA cursor.
+ * \param path Path to the data within an array element.
+ * \param dst Pointer to the variable where the values read from the product will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_read_double_field_array(const coda_cursor *cursor, const char *path, double *dst)
+{
+    return read_field_array(cursor, path, coda_native_type_double, dst);
+}
+
 /** @} */
@@ -980,26 +980,7 @@ LIBCODA_API int coda_cursor_goto_array_element(coda_cursor *cursor, int num_subs
     return 0;
 }
 
-/** Moves the cursor to point to an array element via an index.
- * This function treats all multidimensional arrays as a one dimensional array (with the same number of elements).
- * The ordering in such a one dimensional array is by definition chosen to be equal to the way the array elements
- * are stored as a sequence in the product file.
- * The mapping of a one dimensional index for each multidimensional data array to an array of subscripts (and vice
- * versa) is defined in such a way that the last element of a subscript array is the one that is the fastest running
- * index (i.e. C array ordering). All multidimensional arrays have their dimensions defined using C array ordering in
- * CODA.<br>
- * For example if we have a two dimensional array with dimensions (2,4) then the index 0 would map
- * to the subscript array (0, 0). 1 would map to (0, 1), 4 would map to (1, 0) and 7 would map to (1, 3).
- * <br>
- * If the data array is one dimensional then this function will have the same result as calling
- * coda_cursor_goto_array_element() with \a num_subs = 1 and \a subs[0] = \a index.
- * \param cursor Pointer to a CODA cursor that references an array.
- * \param index Index of the array element (0 <= \a index < number of elements)
- * \return
- *   \arg \c 0, Success.
- *   \arg \c -1, Error occurred (check #coda_errno).
- */
-LIBCODA_API int coda_cursor_goto_array_element_by_index(coda_cursor *cursor, long index)
+static int goto_array_element_by_index(coda_cursor *cursor, long index, int perform_boundary_checks)
 {
     coda_type *type;
 
@@ -1028,20 +1009,20 @@ LIBCODA_API int coda_cursor_goto_array_element_by_index(coda_cursor *cursor, lon
     {
         case coda_backend_ascii:
         case coda_backend_binary:
-            if (coda_ascbin_cursor_goto_array_element_by_index(cursor, index) != 0)
+            if (coda_ascbin_cursor_goto_array_element_by_index(cursor, index, perform_boundary_checks) != 0)
             {
                 return -1;
             }
             break;
         case coda_backend_memory:
-            if (coda_mem_cursor_goto_array_element_by_index(cursor, index) != 0)
+            if (coda_mem_cursor_goto_array_element_by_index(cursor, index, perform_boundary_checks) != 0)
             {
                 return -1;
             }
             break;
         case coda_backend_hdf4:
 #ifdef HAVE_HDF4
-            if (coda_hdf4_cursor_goto_array_element_by_index(cursor, index) != 0)
+            if (coda_hdf4_cursor_goto_array_element_by_index(cursor, index, perform_boundary_checks) != 0)
             {
                 return -1;
             }
@@ -1052,7 +1033,7 @@ LIBCODA_API int coda_cursor_goto_array_element_by_index(coda_cursor *cursor, lon
 #endif
         case coda_backend_hdf5:
 #ifdef HAVE_HDF5
-            if (coda_hdf5_cursor_goto_array_element_by_index(cursor, index) != 0)
+            if (coda_hdf5_cursor_goto_array_element_by_index(cursor, index, perform_boundary_checks) != 0)
             {
                 return -1;
             }
@@ -1062,19 +1043,19 @@ LIBCODA_API int coda_cursor_goto_array_element_by_index(coda_cursor *cursor, lon
             return -1;
 #endif
         case coda_backend_cdf:
-            if (coda_cdf_cursor_goto_array_element_by_index(cursor, index) != 0)
+            if (coda_cdf_cursor_goto_array_element_by_index(cursor, index, perform_boundary_checks) != 0)
             {
                 return -1;
             }
             break;
         case coda_backend_netcdf:
-            if (coda_netcdf_cursor_goto_array_element_by_index(cursor, index) != 0)
+            if (coda_netcdf_cursor_goto_array_element_by_index(cursor, index, perform_boundary_checks) != 0)
             {
                 return -1;
             }
             break;
         case coda_backend_grib:
-            if (coda_grib_cursor_goto_array_element_by_index(cursor, index) != 0)
+            if (coda_grib_cursor_goto_array_element_by_index(cursor, index, perform_boundary_checks) != 0)
             {
                 return -1;
             }
@@ -1098,34 +1079,31 @@ LIBCODA_API int coda_cursor_goto_array_element_by_index(coda_cursor *cursor, lon
     return 0;
 }
 
-/** Moves the cursor to point to the next element of an array.
- * This function treats all multidimensional arrays as a one dimensional array in the same way as
- * coda_cursor_goto_array_element_by_index() does. It will move the cursor to the array element with \a index =
- * \a current_index + 1.
- * \warning If the cursor already points to the last element of an array the function will return an error. So if you
- * want to enumerate all elements of an array (as a one dimensional sequence) use something like
- * \code{.c}
- * coda_cursor_get_num_elements(cursor, &num_elements);
- * if (num_elements > 0)
- * {
- *     coda_cursor_goto_first_array_element(cursor);
- *     for (i = 0; i < num_elements; i++)
- *     {
- *         ...
- *         if (i < num_elements - 1)
- *         {
- *             coda_cursor_goto_next_array_element(cursor);
- *         }
- *     }
- *     coda_cursor_goto_parent(cursor);
- * }
- * \endcode
+/** Moves the cursor to point to an array element via an index.
+ * This function treats all multidimensional arrays as a one dimensional array (with the same number of elements).
+ * The ordering in such a one dimensional array is by definition chosen to be equal to the way the array elements
+ * are stored as a sequence in the product file.
+ * The mapping of a one dimensional index for each multidimensional data array to an array of subscripts (and vice
+ * versa) is defined in such a way that the last element of a subscript array is the one that is the fastest running
+ * index (i.e. C array ordering). All multidimensional arrays have their dimensions defined using C array ordering in
+ * CODA.<br>
+ * For example if we have a two dimensional array with dimensions (2,4) then the index 0 would map
+ * to the subscript array (0, 0). 1 would map to (0, 1), 4 would map to (1, 0) and 7 would map to (1, 3).
+ * <br>
+ * If the data array is one dimensional then this function will have the same result as calling
+ * coda_cursor_goto_array_element() with \a num_subs = 1 and \a subs[0] = \a index.
  * \param cursor Pointer to a CODA cursor that references an array.
+ * \param index Index of the array element (0 <= \a index < number of elements)
  * \return
  *   \arg \c 0, Success.
  *   \arg \c -1, Error occurred (check #coda_errno).
  */
-LIBCODA_API int coda_cursor_goto_next_array_element(coda_cursor *cursor)
+LIBCODA_API int coda_cursor_goto_array_element_by_index(coda_cursor *cursor, long index)
+{
+    return goto_array_element_by_index(cursor, index, coda_option_perform_boundary_checks);
+}
+
+static int goto_next_array_element(coda_cursor *cursor, int perform_boundary_checks)
 {
     coda_type *type;
 
@@ -1155,20 +1133,20 @@ LIBCODA_API int coda_cursor_goto_next_array_element(coda_cursor *cursor)
     {
         case coda_backend_ascii:
         case coda_backend_binary:
-            if (coda_ascbin_cursor_goto_next_array_element(cursor) != 0)
+            if (coda_ascbin_cursor_goto_next_array_element(cursor, perform_boundary_checks) != 0)
             {
                 return -1;
             }
             break;
         case coda_backend_memory:
-            if (coda_mem_cursor_goto_next_array_element(cursor) != 0)
+            if (coda_mem_cursor_goto_next_array_element(cursor, perform_boundary_checks) != 0)
             {
                 return -1;
             }
             break;
         case coda_backend_hdf4:
 #ifdef HAVE_HDF4
-            if (coda_hdf4_cursor_goto_next_array_element(cursor) != 0)
+            if (coda_hdf4_cursor_goto_next_array_element(cursor, perform_boundary_checks) != 0)
             {
                 return -1;
             }
@@ -1179,7 +1157,7 @@ LIBCODA_API int coda_cursor_goto_next_array_element(coda_cursor *cursor)
 #endif
         case coda_backend_hdf5:
 #ifdef HAVE_HDF5
-            if (coda_hdf5_cursor_goto_next_array_element(cursor) != 0)
+            if (coda_hdf5_cursor_goto_next_array_element(cursor, perform_boundary_checks) != 0)
             {
                 return -1;
             }
@@ -1189,19 +1167,19 @@ LIBCODA_API int coda_cursor_goto_next_array_element(coda_cursor *cursor)
             return -1;
 #endif
         case coda_backend_cdf:
-            if (coda_cdf_cursor_goto_next_array_element(cursor) != 0)
+            if (coda_cdf_cursor_goto_next_array_element(cursor, perform_boundary_checks) != 0)
             {
                 return -1;
             }
             break;
         case coda_backend_netcdf:
-            if (coda_netcdf_cursor_goto_next_array_element(cursor) != 0)
+            if (coda_netcdf_cursor_goto_next_array_element(cursor, perform_boundary_checks) != 0)
             {
                 return -1;
             }
             break;
         case coda_backend_grib:
-            if (coda_grib_cursor_goto_next_array_element(cursor) != 0)
+            if (coda_grib_cursor_goto_next_array_element(cursor, perform_boundary_checks) != 0)
             {
                 return -1;
             }
@@ -1225,6 +1203,54 @@ LIBCODA_API int coda_cursor_goto_next_array_element(coda_cursor *cursor)
     return 0;
 }
 
+/** Moves the cursor to point to the next element of an array.
+ * This function treats all multidimensional arrays as a one dimensional array in the same way as
+ * coda_cursor_goto_array_element_by_index() does. It will move the cursor to the array element with \a index =
+ * \a current_index + 1.
+ * \warning If the cursor already points to the last element of an array the function will return an error. So if you
+ * want to enumerate all elements of an array (as a one dimensional sequence) use something like
+ * \code{.c}
+ * coda_cursor_get_num_elements(cursor, &num_elements);
+ * if (num_elements > 0)
+ * {
+ *     coda_cursor_goto_first_array_element(cursor);
+ *     for (i = 0; i < num_elements; i++)
+ *     {
+ *         ...
+ *         if (i < num_elements - 1)
+ *         {
+ *             coda_cursor_goto_next_array_element(cursor);
+ *         }
+ *     }
+ *     coda_cursor_goto_parent(cursor);
+ * }
+ * \endcode
+ * \param cursor Pointer to a CODA cursor that references an array.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_goto_next_array_element(coda_cursor *cursor)
+{
+    return goto_next_array_element(cursor, coda_option_perform_boundary_checks);
+}
+
+/* Move the cursor to the first element of an array (coda_cursor_goto_first_array_element()) or to the next element
+ * (coda_cursor_goto_next_array_element()) without checking the index against the number of elements, regardless of the
+ * coda_set_option_perform_boundary_checks() setting.
+ * This is used by the expression evaluator, which should not temporarily change the global option (since that is not
+ * thread-safe).
+ */
+int coda_cursor_goto_first_array_element_unchecked(coda_cursor *cursor)
+{
+    return goto_array_element_by_index(cursor, 0, 0);
+}
+
+int coda_cursor_goto_next_array_element_unchecked(coda_cursor *cursor)
+{
+    return goto_next_array_element(cursor, 0);
+}
+
 /** Moves the cursor to point to a (virtual) record containing the attributes of the current data element.
  * This function will move the cursor to a record containing all attributes of the data element that the cursor was
  * previously pointing to.
@@ -1651,6 +1677,39 @@ LIBCODA_API int coda_cursor_get_bit_size(const coda_cursor *cursor, int64_t *bit
     return 0;
 }
 
+/* Per-thread override of the coda_set_option_use_fast_size_expressions() setting (-1 if the option applies).
+ * The override is active for the duration of a coda_cursor_get_bit_size_with_fast_size_option() call.
+ */
+static THREAD_LOCAL int use_fast_size_expressions_override = -1;
+
+/* Returns whether record size expressions should be used for the bit size calculation in the current thread */
+int coda_cursor_use_fast_size_expressions(void)
+{
+    if (use_fast_size_expressions_override >= 0)
+    {
+        return use_fast_size_expressions_override;
+    }
+    return coda_option_use_fast_size_expressions;
+}
+
+/* Same as coda_cursor_get_bit_size(), but with the use of fast size expressions explicitly enabled/disabled for the
+ * full calculation (including the sizes of all sub elements) instead of using the global option.
+ * This is used by the expression evaluator and the product check, which should not temporarily change the global
+ * option (since that is not thread-safe).
+ */
+int coda_cursor_get_bit_size_with_fast_size_option(const coda_cursor *cursor, int use_fast_size_expressions,
+                                                   int64_t *bit_size)
+{
+    int prev_override = use_fast_size_expressions_override;
+    int result;
+
+    use_fast_size_expressions_override = (use_fast_size_expressions != 0);
+    result = coda_cursor_get_bit_size(cursor, bit_size);
+    use_fast_size_expressions_override = prev_override;
+
+    return result;
+}
+
 /** Get the byte size for the data at the current cursor position.
  * This function will retrieve the bit_size using coda_cursor_get_bit_size(), convert it to a byte size by rounding
  * it up to the nearest byte, and return this byte size.
@@ -2244,4 +2303,130 @@ LIBCODA_API int coda_cursor_get_array_dim(const coda_cursor *cursor, int *num_di
     exit(1);
 }
 
+/** Retrieve a pointer to the data of an array of numbers as it is stored in memory.
+ * This function allows direct (read-only) access to array data without copying it. This is only possible for data in
+ * binary format from a product that is held in memory (i.e. the file was memory mapped (see
+ * coda_set_option_use_mmap()), was decompressed into memory, or was opened with coda_open_from_memory()). In addition,
+ * the array elements need to be numbers that are stored byte aligned, with a bit size that matches their read type,
+ * in the native byte order of the machine, and that need no conversion.
+ * If all these conditions hold, \a data will point to the first element of the array and the array consists of
+ * coda_cursor_get_num_elements() contiguous values of the read type of the array base type (in C array ordering).
+ * Otherwise, \a data will be set to NULL (this is not considered an error) and you will have to use one of the
+ * coda_cursor_read_<type>_array() functions to read the data.
+ * The memory that \a data points to is owned by the product, should never be modified, and is only valid until the
+ * product is closed. Note that \a data is not necessarily aligned to the size of the read type.
+ * \param cursor Pointer to a CODA cursor.
+ * \param data Pointer to the variable where the pointer to the array data (or NULL) will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_get_array_data_pointer(const coda_cursor *cursor, const void **data)
+{
+    coda_type_number *base_type;
+    coda_type *type;
+    int64_t bit_offset;
+    long num_elements;
+
+    if (cursor == NULL || cursor->n <= 0 || cursor->stack[cursor->n - 1].type == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid cursor argument (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (data == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "data argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    type = coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
+    if (type->type_class != coda_array_class)
+    {
+        coda_set_error(CODA_ERROR_INVALID_TYPE, "cursor does not refer to an array (current type is %s)",
+                       coda_type_get_class_name(type->type_class));
+        return -1;
+    }
+
+    *data = NULL;
+
+    if (cursor->stack[cursor->n - 1].type->backend != coda_backend_binary || cursor->product->mem_ptr == NULL)
+    {
+        return 0;
+    }
+    base_type = (coda_type_number *)((coda_type_array *)type)->base_type;
+    if (base_type->format != coda_format_binary ||
+        (base_type->type_class != coda_integer_class && base_type->type_class != coda_real_class))
+    {
+        return 0;
+    }
+    if (base_type->mappings != NULL || (base_type->conversion != NULL && coda_option_perform_conversions))
+    {
+        return 0;
+    }
+    switch (base_type->read_type)
+    {
+        case coda_native_type_int8:
+        case coda_native_type_uint8:
+            if (base_type->bit_size != 8)
+            {
+                return 0;
+            }
+            break;
+        case coda_native_type_int16:
+        case coda_native_type_uint16:
+            if (base_type->bit_size != 16)
+            {
+                return 0;
+            }
+            break;
+        case coda_native_type_int32:
+        case coda_native_type_uint32:
+        case coda_native_type_float:
+            if (base_type->bit_size != 32)
+            {
+                return 0;
+            }
+            break;
+        case coda_native_type_int64:
+        case coda_native_type_uint64:
+        case coda_native_type_double:
+            if (base_type->bit_size != 64)
+            {
+                return 0;
+            }
+            break;
+        default:
+            return 0;
+    }
+    if (base_type->bit_size > 8 &&
+#ifdef WORDS_BIGENDIAN
+        base_type->endianness != coda_big_endian
+#else
+        base_type->endianness != coda_little_endian
+#endif
+        )
+    {
+        return 0;
+    }
+
+    bit_offset = cursor->stack[cursor->n - 1].bit_offset;
+    if (bit_offset < 0 || (bit_offset & 0x7) != 0)
+    {
+        return 0;
+    }
+    if (coda_cursor_get_num_elements(cursor, &num_elements) != 0)
+    {
+        return -1;
+    }
+    if ((bit_offset >> 3) + num_elements * (base_type->bit_size >> 3) > cursor->product->mem_size)
+    {
+        /* leave it to the regular read functions to report the out of bounds read */
+        return 0;
+    }
+
+    *data = cursor->product->mem_ptr + (bit_offset >> 3);
+
+    return 0;
+}
+
 /** @} */
@@ -0,0 +1,895 @@
+/*
+ * Copyright (C) 2007-2017 S[&]T, The Netherlands.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coda-internal.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef WIN32
+#include <process.h>
+#define getpid _getpid
+#endif
+
+#include "coda-definition.h"
+#include "coda-expr.h"
+
+/* A definition cache file contains a binary image of the index of a .codadef file (i.e. the product class with its
+ * product types, product definitions and detection rules). The product and type definitions themselves are not part
+ * of the cache; these are still read (lazily) from the .codadef file.
+ * All values are stored in native byte order. A cache file is only accepted if the byte order mark, the cache format
+ * version, the CODA version, and the key (based on the checksums of the index and VERSION entries of the .codadef
+ * file) all match.
+ */
+
+#define CACHE_MAGIC "CODADEFC"
+#define CACHE_FORMAT_VERSION 1
+#define CACHE_BYTE_ORDER_MARK 0x01020304
+
+typedef struct cache_writer_struct
+{
+    FILE *f;
+    int error;
+} cache_writer;
+
+typedef struct cache_reader_struct
+{
+    const uint8_t *buffer;
+    long size;
+    long offset;
+} cache_reader;
+
+typedef struct pending_rule_struct
+{
+    coda_product_definition *product_definition;
+    coda_detection_rule *detection_rule;
+} pending_rule;
+
+static void write_data(cache_writer *writer, const void *data, size_t size)
+{
+    if (!writer->error && size > 0 && fwrite(data, size, 1, writer->f) != 1)
+    {
+        writer->error = 1;
+    }
+}
+
+static void write_int32(cache_writer *writer, int32_t value)
+{
+    write_data(writer, &value, sizeof(int32_t));
+}
+
+static void write_int64(cache_writer *writer, int64_t value)
+{
+    write_data(writer, &value, sizeof(int64_t));
+}
+
+static void write_double(cache_writer *writer, double value)
+{
+    write_data(writer, &value, sizeof(double));
+}
+
+static void write_string(cache_writer *writer, const char *str)
+{
+    if (str == NULL)
+    {
+        write_int32(writer, -1);
+        return;
+    }
+    write_int32(writer, (int32_t)strlen(str));
+    write_data(writer, str, strlen(str));
+}
+
+static void write_expression(cache_writer *writer, const coda_expression *expr)
+{
+    if (expr == NULL)
+    {
+        write_int32(writer, -1);
+        return;
+    }
+    write_int32(writer, expr->tag);
+    write_int32(writer, expr->result_type);
+    write_int32(writer, expr->is_constant);
+    switch (expr->tag)
+    {
+        case expr_constant_boolean:
+            write_int32(writer, ((coda_expression_bool_constant *)expr)->value);
+            break;
+        case expr_constant_float:
+            write_double(writer, ((coda_expression_float_constant *)expr)->value);
+            break;
+        case expr_constant_integer:
+            write_int64(writer, ((coda_expression_integer_constant *)expr)->value);
+            break;
+        case expr_constant_rawstring:
+        case expr_constant_string:
+            /* the value is already decoded and may contain '\0' characters */
+            write_int64(writer, ((coda_expression_string_constant *)expr)->length);
+            write_data(writer, ((coda_expression_string_constant *)expr)->value,
+                       ((coda_expression_string_constant *)expr)->length);
+            break;
+        default:
+            {
+                const coda_expression_operation *opexpr = (const coda_expression_operation *)expr;
+                int i;
+
+                write_string(writer, opexpr->identifier);
+                for (i = 0; i < 4; i++)
+                {
+                    write_expression(writer, opexpr->operand[i]);
+                }
+            }
+            break;
+    }
+}
+
+static void write_product_class(cache_writer *writer, const coda_product_class *product_class)
+{
+    int i, j, k, l;
+
+    write_string(writer, product_class->name);
+    write_int32(writer, product_class->revision);
+    write_string(writer, product_class->description);
+    write_int32(writer, product_class->num_product_types);
+    for (i = 0; i < product_class->num_product_types; i++)
+    {
+        coda_product_type *product_type = product_class->product_type[i];
+
+        write_string(writer, product_type->name);
+        write_string(writer, product_type->description);
+        write_int32(writer, product_type->num_product_definitions);
+        for (j = 0; j < product_type->num_product_definitions; j++)
+        {
+            coda_product_definition *product_definition = product_type->product_definition[j];
+
+            write_string(writer, product_definition->name);
+            write_int32(writer, product_definition->format);
+            write_int32(writer, product_definition->version);
+            write_string(writer, product_definition->description);
+            write_int32(writer, product_definition->num_detection_rules);
+            for (k = 0; k < product_definition->num_detection_rules; k++)
+            {
+                coda_detection_rule *detection_rule = product_definition->detection_rule[k];
+
+                write_int32(writer, detection_rule->num_entries);
+                for (l = 0; l < detection_rule->num_entries; l++)
+                {
+                    write_string(writer, detection_rule->entry[l]->path);
+                    write_expression(writer, detection_rule->entry[l]->expression);
+                }
+            }
+        }
+    }
+}
+
+/* Write the index part of product class 'product_class' to the cache file 'cache_file'.
+ * The file is written to a temporary file first and then renamed, so concurrent readers will never see a partially
+ * written cache file.
+ */
+int coda_definition_cache_write(const char *cache_file, const uint32_t *key, const coda_product_class *product_class)
+{
+    cache_writer writer;
+    char *tmp_file;
+
+    tmp_file = malloc(strlen(cache_file) + 25);
+    if (tmp_file == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)strlen(cache_file) + 25, __FILE__, __LINE__);
+        return -1;
+    }
+    sprintf(tmp_file, "%s.%ld", cache_file, (long)getpid());
+
+    writer.f = fopen(tmp_file, "wb");
+    if (writer.f == NULL)
+    {
+        coda_set_error(CODA_ERROR_FILE_OPEN, "could not create definition cache file %s (%s)", tmp_file,
+                       strerror(errno));
+        free(tmp_file);
+        return -1;
+    }
+    writer.error = 0;
+
+    write_data(&writer, CACHE_MAGIC, 8);
+    write_int32(&writer, CACHE_FORMAT_VERSION);
+    write_int32(&writer, CACHE_BYTE_ORDER_MARK);
+    write_data(&writer, key, 4 * sizeof(uint32_t));
+    write_string(&writer, libcoda_version);
+    write_product_class(&writer, product_class);
+
+    if (fclose(writer.f) != 0)
+    {
+        writer.error = 1;
+    }
+    if (writer.error || rename(tmp_file, cache_file) != 0)
+    {
+        coda_set_error(CODA_ERROR_FILE_WRITE, "could not write definition cache file %s", cache_file);
+        remove(tmp_file);
+        free(tmp_file);
+        return -1;
+    }
+    free(tmp_file);
+
+    return 0;
+}
+
+/* delete the detection rules from index 'first' onwards and free the list itself */
+static void delete_pending_rules(pending_rule *pending, int first, int num_pending)
+{
+    int i;
+
+    for (i = first; i < num_pending; i++)
+    {
+        coda_detection_rule_delete(pending[i].detection_rule);
+    }
+    if (pending != NULL)
+    {
+        free(pending);
+    }
+}
+
+static int read_data(cache_reader *reader, void *data, long size)
+{
+    if (size < 0 || reader->offset + size > reader->size)
+    {
+        return -1;
+    }
+    memcpy(data, &reader->buffer[reader->offset], size);
+    reader->offset += size;
+
+    return 0;
+}
+
+static int read_int32(cache_reader *reader, int32_t *value)
+{
+    return read_data(reader, value, sizeof(int32_t));
+}
+
+static int read_string(cache_reader *reader, char **str)
+{
+    int32_t length;
+
+    *str = NULL;
+    if (read_int32(reader, &length) != 0)
+    {
+        return -1;
+    }
+    if (length == -1)
+    {
+        return 0;
+    }
+    if (length < 0 || reader->offset + length > reader->size)
+    {
+        return -1;
+    }
+    *str = malloc(length + 1);
+    if (*str == NULL)
+    {
+        return -1;
+    }
+    memcpy(*str, &reader->buffer[reader->offset], length);
+    (*str)[length] = '\0';
+    reader->offset += length;
+
+    return 0;
+}
+
+/* compare a stored string with 'str' without copying it */
+static int match_string(cache_reader *reader, const char *str)
+{
+    int32_t length;
+
+    if (read_int32(reader, &length) != 0)
+    {
+        return 0;
+    }
+    if (length != (int32_t)strlen(str) || reader->offset + length > reader->size)
+    {
+        return 0;
+    }
+    if (memcmp(&reader->buffer[reader->offset], str, length) != 0)
+    {
+        return 0;
+    }
+    reader->offset += length;
+
+    return 1;
+}
+
+static int read_expression(cache_reader *reader, coda_expression **expr)
+{
+    int32_t tag;
+    int32_t result_type;
+    int32_t is_constant;
+
+    *expr = NULL;
+    if (read_int32(reader, &tag) != 0)
+    {
+        return -1;
+    }
+    if (tag == -1)
+    {
+        return 0;
+    }
+    if (tag < 0 || tag > expr_with)
+    {
+        return -1;
+    }
+    if (read_int32(reader, &result_type) != 0 || read_int32(reader, &is_constant) != 0)
+    {
+        return -1;
+    }
+
+    switch (tag)
+    {
+        case expr_constant_boolean:
+            {
+                coda_expression_bool_constant *bool_expr;
+                int32_t value;
+
+                if (read_int32(reader, &value) != 0)
+                {
+                    return -1;
+                }
+                bool_expr = malloc(sizeof(coda_expression_bool_constant));
+                if (bool_expr == NULL)
+                {
+                    return -1;
+                }
+                bool_expr->value = value;
+                *expr = (coda_expression *)bool_expr;
+            }
+            break;
+        case expr_constant_float:
+            {
+                coda_expression_float_constant *float_expr;
+                double value;
+
+                if (read_data(reader, &value, sizeof(double)) != 0)
+                {
+                    return -1;
+                }
+                float_expr = malloc(sizeof(coda_expression_float_constant));
+                if (float_expr == NULL)
+                {
+                    return -1;
+                }
+                float_expr->value = value;
+                *expr = (coda_expression *)float_expr;
+            }
+            break;
+        case expr_constant_integer:
+            {
+                coda_expression_integer_constant *integer_expr;
+                int64_t value;
+
+                if (read_data(reader, &value, sizeof(int64_t)) != 0)
+                {
+                    return -1;
+                }
+                integer_expr = malloc(sizeof(coda_expression_integer_constant));
+                if (integer_expr == NULL)
+                {
+                    return -1;
+                }
+                integer_expr->value = value;
+                *expr = (coda_expression *)integer_expr;
+            }
+            break;
+        case expr_constant_rawstring:
+        case expr_constant_string:
+            {
+                coda_expression_string_constant *string_expr;
+                int64_t length;
+
+                if (read_data(reader, &length, sizeof(int64_t)) != 0)
+                {
+                    return -1;
+                }
+                if (length < 0 || reader->offset + length > reader->size)
+                {
+                    return -1;
+                }
+                string_expr = malloc(sizeof(coda_expression_string_constant));
+                if (string_expr == NULL)
+                {
+                    return -1;
+                }
+                string_expr->value = malloc((size_t)length + 1);
+                if (string_expr->value == NULL)
+                {
+                    free(string_expr);
+                    return -1;
+                }
+                memcpy(string_expr->value, &reader->buffer[reader->offset], (size_t)length);
+                string_expr->value[length] = '\0';
+                string_expr->length = (long)length;
+                reader->offset += (long)length;
+                *expr = (coda_expression *)string_expr;
+            }
+            break;
+        default:
+            {
+                coda_expression_operation *opexpr;
+                int i;
+
+                opexpr = malloc(sizeof(coda_expression_operation));
+                if (opexpr == NULL)
+                {
+                    return -1;
+                }
+                opexpr->tag = tag;
+                opexpr->identifier = NULL;
+                for (i = 0; i < 4; i++)
+                {
+                    opexpr->operand[i] = NULL;
+                }
+                if (read_string(reader, &opexpr->identifier) != 0)
+                {
+                    coda_expression_delete((coda_expression *)opexpr);
+                    return -1;
+                }
+                for (i = 0; i < 4; i++)
+                {
+                    if (read_expression(reader, &opexpr->operand[i]) != 0)
+                    {
+                        coda_expression_delete((coda_expression *)opexpr);
+                        return -1;
+                    }
+                }
+                *expr = (coda_expression *)opexpr;
+            }
+            break;
+    }
+    (*expr)->tag = tag;
+    (*expr)->result_type = result_type;
+    (*expr)->is_constant = is_constant;
+
+    return 0;
+}
+
+static int read_detection_rule(cache_reader *reader, coda_detection_rule **detection_rule)
+{
+    coda_detection_rule *rule;
+    int32_t num_entries;
+    int i;
+
+    if (read_int32(reader, &num_entries) != 0 || num_entries <= 0)
+    {
+        return -1;
+    }
+    rule = coda_detection_rule_new();
+    if (rule == NULL)
+    {
+        return -1;
+    }
+    for (i = 0; i < num_entries; i++)
+    {
+        coda_detection_rule_entry *entry;
+        coda_expression *expr;
+        char *path;
+
+        if (read_string(reader, &path) != 0)
+        {
+            coda_detection_rule_delete(rule);
+            return -1;
+        }
+        entry = coda_detection_rule_entry_new(path);
+        if (path != NULL)
+        {
+            free(path);
+        }
+        if (entry == NULL)
+        {
+            coda_detection_rule_delete(rule);
+            return -1;
+        }
+        if (read_expression(reader, &expr) != 0)
+        {
+            coda_detection_rule_entry_delete(entry);
+            coda_detection_rule_delete(rule);
+            return -1;
+        }
+        entry->expression = expr;
+        if (coda_detection_rule_add_entry(rule, entry) != 0)
+        {
+            coda_detection_rule_entry_delete(entry);
+            coda_detection_rule_delete(rule);
+            return -1;
+        }
+    }
+    *detection_rule = rule;
+
+    return 0;
+}
+
+static int read_product_definition(cache_reader *reader, coda_product_definition **product_definition,
+                                   pending_rule **pending, int *num_pending)
+{
+    coda_product_definition *definition;
+    int32_t format;
+    int32_t version;
+    int32_t num_detection_rules;
+    char *str;
+    int i;
+
+    if (read_string(reader, &str) != 0 || str == NULL)
+    {
+        return -1;
+    }
+    if (read_int32(reader, &format) != 0 || format < 0 || format >= CODA_NUM_FORMATS ||
+        read_int32(reader, &version) != 0)
+    {
+        free(str);
+        return -1;
+    }
+    definition = coda_product_definition_new(str, (coda_format)format, version);
+    free(str);
+    if (definition == NULL)
+    {
+        return -1;
+    }
+    if (read_string(reader, &str) != 0)
+    {
+        coda_product_definition_delete(definition);
+        return -1;
+    }
+    if (str != NULL)
+    {
+        if (coda_product_definition_set_description(definition, str) != 0)
+        {
+            free(str);
+            coda_product_definition_delete(definition);
+            return -1;
+        }
+        free(str);
+    }
+    if (read_int32(reader, &num_detection_rules) != 0 || num_detection_rules < 0)
+    {
+        coda_product_definition_delete(definition);
+        return -1;
+    }
+    for (i = 0; i < num_detection_rules; i++)
+    {
+        pending_rule *new_pending;
+        coda_detection_rule *detection_rule;
+
+        if (read_detection_rule(reader, &detection_rule) != 0)
+        {
+            coda_product_definition_delete(definition);
+            return -1;
+        }
+        new_pending = realloc(*pending, (*num_pending + 1) * sizeof(pending_rule));
+        if (new_pending == NULL)
+        {
+            coda_detection_rule_delete(detection_rule);
+            coda_product_definition_delete(definition);
+            return -1;
+        }
+        *pending = new_pending;
+        (*pending)[*num_pending].product_definition = definition;
+        (*pending)[*num_pending].detection_rule = detection_rule;
+        (*num_pending)++;
+    }
+    *product_definition = definition;
+
+    return 0;
+}
+
+static int read_product_type(cache_reader *reader, coda_product_type **product_type, pending_rule **pending,
+                             int *num_pending)
+{
+    coda_product_type *type;
+    int32_t num_product_definitions;
+    char *str;
+    int i;
+
+    if (read_string(reader, &str) != 0 || str == NULL)
+    {
+        return -1;
+    }
+    type = coda_product_type_new(str);
+    free(str);
+    if (type == NULL)
+    {
+        return -1;
+    }
+    if (read_string(reader, &str) != 0)
+    {
+        coda_product_type_delete(type);
+        return -1;
+    }
+    if (str != NULL)
+    {
+        if (coda_product_type_set_description(type, str) != 0)
+        {
+            free(str);
+            coda_product_type_delete(type);
+            return -1;
+        }
+        free(str);
+    }
+    if (read_int32(reader, &num_product_definitions) != 0 || num_product_definitions < 0)
+    {
+        coda_product_type_delete(type);
+        return -1;
+    }
+    for (i = 0; i < num_product_definitions; i++)
+    {
+        coda_product_definition *product_definition;
+        int first_pending = *num_pending;
+
+        if (read_product_definition(reader, &product_definition, pending, num_pending) != 0)
+        {
+            coda_product_type_delete(type);
+            return -1;
+        }
+        if (coda_product_type_add_product_definition(type, product_definition) != 0)
+        {
+            /* detection rules of this definition are not owned by anyone yet */
+            while (*num_pending > first_pending)
+            {
+                (*num_pending)--;
+                coda_detection_rule_delete((*pending)[*num_pending].detection_rule);
+            }
+            coda_product_definition_delete(product_definition);
+            coda_product_type_delete(type);
+            return -1;
+        }
+    }
+    *product_type = type;
+
+    return 0;
+}
+
+static int read_product_class(cache_reader *reader, const char *definition_file, coda_product_class **product_class,
+                              pending_rule **pending, int *num_pending)
+{
+    coda_product_class *new_product_class;
+    int32_t revision;
+    int32_t num_product_types;
+    char *str;
+    int i;
+
+    if (read_string(reader, &str) != 0 || str == NULL)
+    {
+        return -1;
+    }
+    new_product_class = coda_product_class_new(str);
+    free(str);
+    if (new_product_class == NULL)
+    {
+        return -1;
+    }
+    if (coda_product_class_set_definition_file(new_product_class, definition_file) != 0)
+    {
+        coda_product_class_delete(new_product_class);
+        return -1;
+    }
+    if (read_int32(reader, &revision) != 0 || coda_product_class_set_revision(new_product_class, revision) != 0)
+    {
+        coda_product_class_delete(new_product_class);
+        return -1;
+    }
+    if (read_string(reader, &str) != 0)
+    {
+        coda_product_class_delete(new_product_class);
+        return -1;
+    }
+    if (str != NULL)
+    {
+        if (coda_product_class_set_description(new_product_class, str) != 0)
+        {
+            free(str);
+            coda_product_class_delete(new_product_class);
+            return -1;
+        }
+        free(str);
+    }
+    if (read_int32(reader, &num_product_types) != 0 || num_product_types < 0)
+    {
+        coda_product_class_delete(new_product_class);
+        return -1;
+    }
+    for (i = 0; i < num_product_types; i++)
+    {
+        coda_product_type *product_type;
+
+        if (read_product_type(reader, &product_type, pending, num_pending) != 0)
+        {
+            coda_product_class_delete(new_product_class);
+            return -1;
+        }
+        if (coda_product_class_add_product_type(new_product_class, product_type) != 0)
+        {
+            coda_product_type_delete(product_type);
+            coda_product_class_delete(new_product_class);
+            return -1;
+        }
+    }
+    *product_class = new_product_class;
+
+    return 0;
+}
+
+static int read_cache_file(const char *cache_file, uint8_t **buffer, long *size)
+{
+    FILE *f;
+    long filesize;
+
+    f = fopen(cache_file, "rb");
+    if (f == NULL)
+    {
+        return -1;
+    }
+    if (fseek(f, 0, SEEK_END) != 0 || (filesize = ftell(f)) <= 0 || fseek(f, 0, SEEK_SET) != 0)
+    {
+        fclose(f);
+        return -1;
+    }
+    *buffer = malloc(filesize);
+    if (*buffer == NULL)
+    {
+        fclose(f);
+        return -1;
+    }
+    if (fread(*buffer, filesize, 1, f) != 1)
+    {
+        free(*buffer);
+        fclose(f);
+        return -1;
+    }
+    fclose(f);
+    *size = filesize;
+
+    return 0;
+}
+
+/* Add the product class from the cache file 'cache_file' to the data dictionary.
+ * If the cache file does not exist, is invalid, or was created for a different key then '*found' will be set to 0 and
+ * the caller should fall back to parsing the .codadef file itself.
+ * The handling of an already existing product class with the same name is identical to that of the xml parser.
+ */
+int coda_definition_cache_read(const char *cache_file, const uint32_t *key, const char *definition_file, int *found)
+{
+    coda_product_class *product_class = NULL;
+    pending_rule *pending = NULL;
+    int num_pending = 0;
+    cache_reader reader;
+    uint8_t *buffer;
+    int32_t value;
+    uint32_t file_key[4];
+    int i;
+
+    *found = 0;
+
+    if (read_cache_file(cache_file, &buffer, &reader.size) != 0)
+    {
+        return 0;
+    }
+    reader.buffer = buffer;
+    reader.offset = 0;
+
+    if (reader.size < 8 || memcmp(buffer, CACHE_MAGIC, 8) != 0)
+    {
+        free(buffer);
+        return 0;
+    }
+    reader.offset = 8;
+    if (read_int32(&reader, &value) != 0 || value != CACHE_FORMAT_VERSION)
+    {
+        free(buffer);
+        return 0;
+    }
+    if (read_int32(&reader, &value) != 0 || value != CACHE_BYTE_ORDER_MARK)
+    {
+        free(buffer);
+        return 0;
+    }
+    if (read_data(&reader, file_key, 4 * sizeof(uint32_t)) != 0 || memcmp(file_key, key, 4 * sizeof(uint32_t)) != 0)
+    {
+        free(buffer);
+        return 0;
+    }
+    if (!match_string(&reader, libcoda_version))
+    {
+        free(buffer);
+        return 0;
+    }
+    if (read_product_class(&reader, definition_file, &product_class, &pending, &num_pending) != 0 ||
+        reader.offset != reader.size)
+    {
+        if (product_class != NULL)
+        {
+            coda_product_class_delete(product_class);
+        }
+        delete_pending_rules(pending, 0, num_pending);
+        free(buffer);
+        return 0;
+    }
+    free(buffer);
+
+    *found = 1;
+
+    /* see if there is already a version of this product class in the data dictionary */
+    if (coda_data_dictionary_has_product_class(product_class->name))
+    {
+        coda_product_class *existing_product_class;
+
+        existing_product_class = coda_data_dictionary_get_product_class(product_class->name);
+        if (existing_product_class == NULL)
+        {
+            delete_pending_rules(pending, 0, num_pending);
+            coda_product_class_delete(product_class);
+            return -1;
+        }
+        if (product_class->revision <= coda_product_class_get_revision(existing_product_class))
+        {
+            /* the current available product class is as new or newer -> ignore this product new_product_class */
+            delete_pending_rules(pending, 0, num_pending);
+            coda_product_class_delete(product_class);
+            return 0;
+        }
+        /* the current available product class is older -> remove it */
+        if (coda_data_dictionary_remove_product_class(existing_product_class) != 0)
+        {
+            delete_pending_rules(pending, 0, num_pending);
+            coda_product_class_delete(product_class);
+            return -1;
+        }
+    }
+
+    /* only now that the product class is known to be used, add the detection rules to the detection tree */
+    for (i = 0; i < num_pending; i++)
+    {
+        if (coda_product_definition_add_detection_rule(pending[i].product_definition, pending[i].detection_rule) != 0)
+        {
+            delete_pending_rules(pending, i, num_pending);
+            coda_product_class_delete(product_class);
+            return -1;
+        }
+    }
+    if (pending != NULL)
+    {
+        free(pending);
+    }
+
+    if (coda_data_dictionary_add_product_class(product_class) != 0)
+    {
+        coda_product_class_delete(product_class);
+        return -1;
+    }
+
+    return 0;
+}
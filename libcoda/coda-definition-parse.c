@@ -4240,9 +4240,93 @@ static int parse_entry(za_file *zf, zip_entry_type type, const char *name, coda_
     return 0;
 }
 
+/* Determine the location of the definition cache file for a .codadef file and the key that the cache should match.
+ * The key consists of the checksums and sizes of the index and VERSION entries of the .codadef file.
+ * '*cache_file' will be set to NULL if the definition cache is not enabled (via the CODA_DEFINITION_CACHE environment
+ * variable) or if it can not be used.
+ */
+static int get_definition_cache_file(za_file *zf, char **cache_file, uint32_t *key)
+{
+    const char *cache_directory;
+    const char *filename;
+    const char *basename;
+    za_entry *entry;
+    long length;
+
+    *cache_file = NULL;
+
+    cache_directory = getenv("CODA_DEFINITION_CACHE");
+    if (cache_directory == NULL || *cache_directory == '\0' || coda_option_read_all_definitions)
+    {
+        /* the cache only contains the index, so there is no benefit if all definitions are read anyway */
+        return 0;
+    }
+
+    entry = za_get_entry_by_name(zf, "index.xml");
+    if (entry == NULL)
+    {
+        /* let parse_entry() report the error */
+        return 0;
+    }
+    key[0] = (uint32_t)za_get_entry_crc(entry);
+    key[1] = (uint32_t)za_get_entry_size(entry);
+    key[2] = 0;
+    key[3] = 0;
+    entry = za_get_entry_by_name(zf, "VERSION");
+    if (entry != NULL)
+    {
+        key[2] = (uint32_t)za_get_entry_crc(entry);
+        key[3] = (uint32_t)za_get_entry_size(entry);
+    }
+
+    filename = za_get_filename(zf);
+    basename = filename + strlen(filename);
+    while (basename > filename && basename[-1] != '/' && basename[-1] != '\\')
+    {
+        basename--;
+    }
+    length = (long)strlen(basename);
+    if (length > 8 && strcmp(&basename[length - 8], ".codadef") == 0)
+    {
+        length -= 8;
+    }
+
+    /* <cache_directory>/<basename>-<index crc><VERSION crc>.cache */
+    *cache_file = malloc(strlen(cache_directory) + 1 + length + 23 + 1);
+    if (*cache_file == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)strlen(cache_directory) + 1 + length + 23 + 1, __FILE__, __LINE__);
+        return -1;
+    }
+    sprintf(*cache_file, "%s/%.*s-%08lx%08lx.cache", cache_directory, (int)length, basename, (unsigned long)key[0],
+            (unsigned long)key[2]);
+
+    return 0;
+}
+
+static coda_product_class *get_product_class_for_definition_file(const char *filename)
+{
+    int i;
+
+    for (i = 0; i < coda_global_data_dictionary->num_product_classes; i++)
+    {
+        coda_product_class *product_class = coda_global_data_dictionary->product_class[i];
+
+        if (product_class->definition_file != NULL && strcmp(product_class->definition_file, filename) == 0)
+        {
+            return product_class;
+        }
+    }
+
+    return NULL;
+}
+
 static int read_definition_file(const char *filename)
 {
     za_file *zf;
+    char *cache_file;
+    uint32_t key[4];
 
     zf = za_open(filename, handle_ziparchive_error);
     if (zf == NULL)
@@ -4250,12 +4334,57 @@ static int read_definition_file(const char *filename)
         return -1;
     }
 
+    if (get_definition_cache_file(zf, &cache_file, key) != 0)
+    {
+        za_close(zf);
+        return -1;
+    }
+    if (cache_file != NULL)
+    {
+        int found;
+
+        if (coda_definition_cache_read(cache_file, key, za_get_filename(zf), &found) != 0)
+        {
+            free(cache_file);
+            za_close(zf);
+            return -1;
+        }
+        if (found)
+        {
+            free(cache_file);
+            za_close(zf);
+            return 0;
+        }
+    }
+
     if (parse_entry(zf, ze_index, NULL, NULL, NULL) != 0)
     {
+        if (cache_file != NULL)
+        {
+            free(cache_file);
+        }
         za_close(zf);
         return -1;
     }
 
+    if (cache_file != NULL)
+    {
+        coda_product_class *product_class;
+
+        /* the product class will not be in the data dictionary if a newer revision was already available */
+        product_class = get_product_class_for_definition_file(za_get_filename(zf));
+        if (product_class != NULL)
+        {
+            /* a cache that can not be written is not an error; the next run will just parse the xml again */
+            if (coda_definition_cache_write(cache_file, key, product_class) != 0)
+            {
+                /* don't leave the error of the cache write behind for the caller */
+                coda_errno = 0;
+            }
+        }
+        free(cache_file);
+    }
+
     za_close(zf);
 
     return 0;
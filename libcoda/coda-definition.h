@@ -112,6 +112,15 @@ struct coda_product_class_struct
 };
 typedef struct coda_product_class_struct coda_product_class;
 
+/* simple detection expressions for which we can perform the check directly (without the expression evaluator) */
+typedef enum coda_detection_check_enum
+{
+    detection_check_none,       /* 'expression' needs to be evaluated using the expression evaluator */
+    detection_check_data,       /* bytes(/, offset, length) == "value" */
+    detection_check_filename,   /* substr(offset, length, filename()) == "value" */
+    detection_check_size        /* filesize() == size */
+} coda_detection_check;
+
 struct coda_detection_node_struct
 {
     /* relative path to reach this node from the parent node
@@ -123,6 +132,17 @@ struct coda_detection_node_struct
     /* detection expression; will be NULL for root node */
     const coda_expression *expression;
 
+    /* precompiled version of 'expression' (if 'expression' is one of the simple checks) */
+    coda_detection_check check;
+    int64_t check_offset;       /* byte offset into the file (data) or filename (filename) */
+    int64_t check_length;       /* length of the substring to compare (filename) */
+    int64_t check_size;         /* file size to compare against (size) */
+    const char *check_value;    /* string to compare against (data/filename) */
+    long check_value_length;
+
+    /* number of leading bytes of a file needed to perform all data checks in this (sub)tree */
+    int64_t prefix_size;
+
     coda_detection_rule *rule;  /* the matching rule when 'expression' or 'path' matches and none of the subnodes match */
 
     /* sub nodes of this node */
@@ -202,4 +222,7 @@ coda_detection_node *coda_data_dictionary_get_detection_tree(coda_format format)
 int coda_data_dictionary_find_definition_for_product(coda_product *product, coda_product_definition **definition);
 void coda_data_dictionary_done(void);
 
+int coda_definition_cache_read(const char *cache_file, const uint32_t *key, const char *definition_file, int *found);
+int coda_definition_cache_write(const char *cache_file, const uint32_t *key, const coda_product_class *product_class);
+
 #endif
@@ -36,6 +36,18 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* maximum number of leading bytes of a file that will be used for precompiled MatchData checks */
+#define MAX_DETECTION_PREFIX_SIZE 4096
+
+typedef struct detection_info_struct
+{
+    const uint8_t *prefix;      /* leading bytes of the file (NULL if not available) */
+    int64_t prefix_size;
+    int64_t file_size;
+    const char *filename;       /* filename without directory component */
+    int64_t filename_length;
+} detection_info;
+
 void coda_detection_rule_entry_delete(coda_detection_rule_entry *entry)
 {
     if (entry->path != NULL)
@@ -204,6 +216,13 @@ static coda_detection_node *detection_node_new(void)
     }
     node->path = NULL;
     node->expression = NULL;
+    node->check = detection_check_none;
+    node->check_offset = 0;
+    node->check_length = 0;
+    node->check_size = 0;
+    node->check_value = NULL;
+    node->check_value_length = 0;
+    node->prefix_size = 0;
     node->rule = NULL;
     node->num_subnodes = 0;
     node->subnode = NULL;
@@ -246,6 +265,89 @@ static int detection_node_add_node(coda_detection_node *node, coda_detection_nod
     return 0;
 }
 
+static int get_constant_integer(const coda_expression *expr, int64_t *value)
+{
+    if (expr == NULL || expr->tag != expr_constant_integer)
+    {
+        return 0;
+    }
+    *value = ((coda_expression_integer_constant *)expr)->value;
+    return 1;
+}
+
+/* see if the detection expression is one of the simple forms that are generated for MatchData (with offset),
+ * MatchFilename, and MatchSize elements, and if so, store the parameters of the check in the node
+ */
+static void compile_detection_check(coda_detection_node *node)
+{
+    const coda_expression_operation *opexpr;
+    const coda_expression *expr;
+    const coda_expression *value_expr;
+
+    node->check = detection_check_none;
+    if (node->expression == NULL || node->expression->tag != expr_equal)
+    {
+        return;
+    }
+    opexpr = (const coda_expression_operation *)node->expression;
+    expr = opexpr->operand[0];
+    value_expr = opexpr->operand[1];
+    if (expr->tag == expr_constant_string || expr->tag == expr_constant_integer)
+    {
+        expr = opexpr->operand[1];
+        value_expr = opexpr->operand[0];
+    }
+
+    if (expr->tag == expr_file_size)
+    {
+        if (get_constant_integer(value_expr, &node->check_size))
+        {
+            node->check = detection_check_size;
+        }
+        return;
+    }
+
+    if (value_expr->tag != expr_constant_string)
+    {
+        return;
+    }
+    node->check_value = ((coda_expression_string_constant *)value_expr)->value;
+    node->check_value_length = ((coda_expression_string_constant *)value_expr)->length;
+
+    opexpr = (const coda_expression_operation *)expr;
+    if (expr->tag == expr_bytes)
+    {
+        /* bytes(/, offset, length) */
+        if (opexpr->operand[0] == NULL || opexpr->operand[0]->tag != expr_goto_root ||
+            !get_constant_integer(opexpr->operand[1], &node->check_offset) ||
+            !get_constant_integer(opexpr->operand[2], &node->check_length))
+        {
+            return;
+        }
+        if (node->check_offset < 0 || node->check_length <= 0 ||
+            node->check_offset + node->check_length > MAX_DETECTION_PREFIX_SIZE)
+        {
+            return;
+        }
+        node->check = detection_check_data;
+    }
+    else if (expr->tag == expr_substr)
+    {
+        /* substr(offset, length, filename()) */
+        if (!get_constant_integer(opexpr->operand[0], &node->check_offset) ||
+            !get_constant_integer(opexpr->operand[1], &node->check_length) || opexpr->operand[2] == NULL ||
+            opexpr->operand[2]->tag != expr_filename)
+        {
+            return;
+        }
+        if (node->check_offset < 0 || node->check_length < 0)
+        {
+            return;
+        }
+        node->check = detection_check_filename;
+    }
+}
+
 /* returns 0 when equal, and 1 when not equal
  * pos = -1 if one of path1/path2 is NULL, otherwise pos is the position at which the first difference is found
  */
@@ -387,6 +489,7 @@ static coda_detection_node *get_node_for_entry(coda_detection_node *node, char *
     else
     {
         new_node->expression = entry->expression;
+        compile_detection_check(new_node);
     }
     if (detection_node_add_node(node, new_node) != 0)
     {
@@ -409,6 +512,7 @@ void coda_detection_tree_delete(void *detection_tree)
 
 int coda_detection_tree_add_rule(void *detection_tree, coda_detection_rule *detection_rule)
 {
+    coda_detection_node *root;
     coda_detection_node *node;
     int i;
 
@@ -429,6 +533,7 @@ int coda_detection_tree_add_rule(void *detection_tree, coda_detection_rule *dete
         }
         *(coda_detection_node **)detection_tree = node;
     }
+    root = node;
     for (i = 0; i < detection_rule->num_entries; i++)
     {
         node = get_node_for_entry(node, detection_rule->entry[i]->path, detection_rule->entry[i]);
@@ -436,6 +541,10 @@ int coda_detection_tree_add_rule(void *detection_tree, coda_detection_rule *dete
         {
             return -1;
         }
+        if (node->check == detection_check_data && node->check_offset + node->check_length > root->prefix_size)
+        {
+            root->prefix_size = node->check_offset + node->check_length;
+        }
     }
     if (node->rule != NULL)
     {
@@ -448,16 +557,58 @@ int coda_detection_tree_add_rule(void *detection_tree, coda_detection_rule *dete
     return 0;
 }
 
-int coda_evaluate_detection_node(coda_detection_node *node, coda_cursor *cursor, coda_product_definition **definition)
+/* returns 1 if the check matches, 0 if it does not match, and -1 if the expression evaluator should be used */
+static int perform_detection_check(const coda_detection_node *node, const detection_info *info)
+{
+    switch (node->check)
+    {
+        case detection_check_none:
+            break;
+        case detection_check_data:
+            if (info->prefix == NULL || node->check_offset + node->check_length > info->prefix_size)
+            {
+                /* let the expression evaluator deal with this (e.g. the file may be too small) */
+                break;
+            }
+            if (node->check_length != node->check_value_length)
+            {
+                return 0;
+            }
+            return memcmp(&info->prefix[node->check_offset], node->check_value, node->check_value_length) == 0;
+        case detection_check_filename:
+            {
+                int64_t length;
+
+                /* mimic the behaviour of substr() for out of range values */
+                length = 0;
+                if (node->check_offset < info->filename_length)
+                {
+                    length = info->filename_length - node->check_offset;
+                    if (node->check_length < length)
+                    {
+                        length = node->check_length;
+                    }
+                }
+                if (length != node->check_value_length)
+                {
+                    return 0;
+                }
+                return length == 0 ||
+                    memcmp(&info->filename[node->check_offset], node->check_value, node->check_value_length) == 0;
+            }
+        case detection_check_size:
+            return info->file_size == node->check_size;
+    }
+
+    return -1;
+}
+
+static int evaluate_detection_node(coda_detection_node *node, coda_cursor *cursor, const detection_info *info,
+                                   coda_product_definition **definition)
 {
     coda_cursor subcursor = *cursor;
     int i;
 
-    *definition = NULL;
-    if (node == NULL)
-    {
-        return 0;
-    }
     if (node->path != NULL)
     {
         if (coda_cursor_goto(&subcursor, node->path) != 0)
@@ -471,11 +622,15 @@ int coda_evaluate_detection_node(coda_detection_node *node, coda_cursor *cursor,
     {
         int result;
 
-        if (coda_expression_eval_bool(node->expression, &subcursor, &result) != 0)
+        result = perform_detection_check(node, info);
+        if (result == -1)
         {
-            /* treat failures as 'mismatches' */
-            coda_errno = 0;
-            return 0;
+            if (coda_expression_eval_bool(node->expression, &subcursor, &result) != 0)
+            {
+                /* treat failures as 'mismatches' */
+                coda_errno = 0;
+                return 0;
+            }
         }
         if (result == 0)
         {
@@ -485,7 +640,7 @@ int coda_evaluate_detection_node(coda_detection_node *node, coda_cursor *cursor,
 
     for (i = 0; i < node->num_subnodes; i++)
     {
-        if (coda_evaluate_detection_node(node->subnode[i], &subcursor, definition) != 0)
+        if (evaluate_detection_node(node->subnode[i], &subcursor, info, definition) != 0)
         {
             return -1;
         }
@@ -502,3 +657,51 @@ int coda_evaluate_detection_node(coda_detection_node *node, coda_cursor *cursor,
 
     return 0;
 }
+
+int coda_evaluate_detection_node(coda_detection_node *node, coda_cursor *cursor, coda_product_definition **definition)
+{
+    uint8_t prefix[MAX_DETECTION_PREFIX_SIZE];
+    detection_info info;
+    const char *filepath;
+    int result;
+
+    *definition = NULL;
+    if (node == NULL)
+    {
+        return 0;
+    }
+
+    /* gather the information needed for the precompiled detection checks */
+    info.prefix = NULL;
+    info.prefix_size = 0;
+    if (coda_get_product_file_size(cursor->product, &info.file_size) != 0 ||
+        coda_get_product_filename(cursor->product, &filepath) != 0)
+    {
+        return -1;
+    }
+    info.filename = coda_get_base_filename(filepath);
+    info.filename_length = strlen(info.filename);
+    if (node->prefix_size > 0 &&
+        (cursor->product->format == coda_format_ascii || cursor->product->format == coda_format_binary))
+    {
+        coda_cursor root_cursor = *cursor;
+
+        /* read the leading bytes of the file once so data checks don't need to go through the cursor */
+        info.prefix_size = node->prefix_size < info.file_size ? node->prefix_size : info.file_size;
+        if (info.prefix_size > 0 && coda_cursor_goto_root(&root_cursor) == 0 &&
+            coda_cursor_read_bits(&root_cursor, prefix, 0, info.prefix_size * 8) == 0)
+        {
+            info.prefix = prefix;
+        }
+        else
+        {
+            /* fall back to using the expression evaluator */
+            coda_errno = 0;
+            info.prefix_size = 0;
+        }
+    }
+
+    result = evaluate_detection_node(node, cursor, &info, definition);
+
+    return result;
+}
@@ -43,12 +43,14 @@
 
 #define MAX_ERROR_INFO_LENGTH	4096
 
-static char coda_error_message_buffer[MAX_ERROR_INFO_LENGTH + 1];
+/* the error state is kept per thread, so errors of one thread do not affect the error state of another thread */
+static THREAD_LOCAL int coda_errno_value = CODA_SUCCESS;
+static THREAD_LOCAL char coda_error_message_buffer[MAX_ERROR_INFO_LENGTH + 1];
 
 /** \defgroup coda_error CODA Error
  * With a few exceptions almost all CODA functions return an integer that indicate whether the function was able to
  * perform its operations successfully. The return value will be 0 on success and -1 otherwise. In case you get a -1
- * you can look at the global variable #coda_errno for a precise error code. Each error code and its meaning is
+ * you can look at the variable #coda_errno for a precise error code. Each error code and its meaning is
  * described in this section. You will also be able to retrieve a character string with an error description via
  * the coda_errno_to_string() function. This function will return either the default error message for the error
  * code, or a custom error message. A custom error message will only be returned if the error code you pass to
@@ -152,37 +154,49 @@ static char coda_error_message_buffer[MAX_ERROR_INFO_LENGTH + 1];
 
 /** @} */
 
-/** Variable that contains the error type.
+/** \def coda_errno
+ * Variable that contains the error type.
  * If no error has occurred the variable contains #CODA_SUCCESS (0).
- * \hideinitializer
+ * Each thread has its own error state, so #coda_errno (and the error message returned by coda_errno_to_string())
+ * always reflects the last error that occurred in the calling thread.
+ * #coda_errno is a macro that refers to the error variable of the calling thread (see coda_get_errno()). It can be
+ * read and assigned to as a normal variable.
  */
-LIBCODA_API int coda_errno = CODA_SUCCESS;
+
+/** Get a pointer to the error variable of the calling thread.
+ * You will normally not need to call this function yourself but just use #coda_errno.
+ * \return Pointer to the error variable of the calling thread.
+ */
+LIBCODA_API int *coda_get_errno(void)
+{
+    return &coda_errno_value;
+}
 
 void coda_add_error_message_vargs(const char *message, va_list ap)
 {
     char message_buffer[MAX_ERROR_INFO_LENGTH + 1];
-    int current_length;
+    size_t current_length;
 
     if (message == NULL)
     {
         return;
     }
 
-    current_length = strlen(coda_error_message_buffer);
-    if (current_length >= MAX_ERROR_INFO_LENGTH)
+    /* write to local buffer first in order to allow using the result of coda_errno_to_string inside the va_list */
+    vsnprintf(message_buffer, MAX_ERROR_INFO_LENGTH + 1, message, ap);
+    message_buffer[MAX_ERROR_INFO_LENGTH] = '\0';
+
+    if (coda_error_message_buffer[0] == '\0')
     {
-        return;
+        /* populate the error message buffer with the default error message */
+        strncpy(coda_error_message_buffer, coda_errno_to_string(coda_errno), MAX_ERROR_INFO_LENGTH);
+        coda_error_message_buffer[MAX_ERROR_INFO_LENGTH] = '\0';
     }
-    if (current_length == 0)
+    current_length = strlen(coda_error_message_buffer);
+    if (current_length < MAX_ERROR_INFO_LENGTH)
     {
-        /* populate the message buffer with the default error message */
-        strcpy(message_buffer, coda_errno_to_string(coda_errno));
-        current_length = strlen(message_buffer);
+        strncat(coda_error_message_buffer, message_buffer, MAX_ERROR_INFO_LENGTH - current_length);
     }
-    /* write to local buffer in order to allow using the result of coda_errno_to_string inside the va_list */
-    vsnprintf(message_buffer, MAX_ERROR_INFO_LENGTH - current_length, message, ap);
-    message_buffer[MAX_ERROR_INFO_LENGTH - current_length] = '\0';
-    strcat(coda_error_message_buffer, message_buffer);
 }
 
 void coda_add_error_message(const char *message, ...)
@@ -1438,7 +1438,6 @@ static int eval_float(eval_info *info, const coda_expression *expr, double *valu
             if (opexpr->operand[0]->result_type == coda_expression_node)
             {
                 coda_cursor prev_cursor;
-                int perform_conversions;
 
                 assert(info->orig_cursor != NULL);
                 prev_cursor = info->cursor;
@@ -1446,14 +1445,10 @@ static int eval_float(eval_info *info, const coda_expression *expr, double *valu
                 {
                     return -1;
                 }
-                perform_conversions = coda_get_option_perform_conversions();
-                coda_set_option_perform_conversions(0);
-                if (coda_cursor_read_double(&info->cursor, value) != 0)
+                if (coda_cursor_read_unconverted_double(&info->cursor, value) != 0)
                 {
-                    coda_set_option_perform_conversions(perform_conversions);
                     return -1;
                 }
-                coda_set_option_perform_conversions(perform_conversions);
                 info->cursor = prev_cursor;
             }
             else if (opexpr->operand[0]->result_type == coda_expression_string)
@@ -1859,8 +1854,6 @@ static int eval_integer(eval_info *info, const coda_expression *expr, int64_t *v
             if (opexpr->operand[0]->result_type == coda_expression_node)
             {
                 coda_cursor prev_cursor;
-                coda_native_type read_type;
-                int perform_conversions;
 
                 assert(info->orig_cursor != NULL);
                 prev_cursor = info->cursor;
@@ -1868,34 +1861,10 @@ static int eval_integer(eval_info *info, const coda_expression *expr, int64_t *v
                 {
                     return -1;
                 }
-                perform_conversions = coda_get_option_perform_conversions();
-                coda_set_option_perform_conversions(0);
-                if (coda_cursor_get_read_type(&info->cursor, &read_type) != 0)
+                if (coda_cursor_read_unconverted_int64(&info->cursor, value) != 0)
                 {
-                    coda_set_option_perform_conversions(perform_conversions);
                     return -1;
                 }
-                if (read_type == coda_native_type_uint64)
-                {
-                    uint64_t uvalue;
-
-                    /* read it as an uint64 and then cast it to a int64 */
-                    if (coda_cursor_read_uint64(&info->cursor, &uvalue) != 0)
-                    {
-                        coda_set_option_perform_conversions(perform_conversions);
-                        return -1;
-                    }
-                    *value = (int64_t)uvalue;
-                }
-                else
-                {
-                    if (coda_cursor_read_int64(&info->cursor, value) != 0)
-                    {
-                        coda_set_option_perform_conversions(perform_conversions);
-                        return -1;
-                    }
-                }
-                coda_set_option_perform_conversions(perform_conversions);
                 info->cursor = prev_cursor;
             }
             else if (opexpr->operand[0]->result_type == coda_expression_boolean)
@@ -2262,7 +2231,6 @@ static int eval_integer(eval_info *info, const coda_expression *expr, int64_t *v
         case expr_unbound_array_index:
             {
                 coda_cursor prev_cursor;
-                int prev_option;
                 int condition = 0;
 
                 assert(info->orig_cursor != NULL);
@@ -2271,11 +2239,9 @@ static int eval_integer(eval_info *info, const coda_expression *expr, int64_t *v
                 {
                     return -1;
                 }
-                prev_option = coda_option_perform_boundary_checks;
-                coda_option_perform_boundary_checks = 0;
-                if (coda_cursor_goto_first_array_element(&info->cursor) != 0)
+                /* the number of elements is unknown, so move through the array without boundary checks */
+                if (coda_cursor_goto_first_array_element_unchecked(&info->cursor) != 0)
                 {
-                    coda_option_perform_boundary_checks = prev_option;
                     return -1;
                 }
                 *value = 0;
@@ -2285,7 +2251,6 @@ static int eval_integer(eval_info *info, const coda_expression *expr, int64_t *v
                     {
                         if (eval_boolean(info, opexpr->operand[1], &condition) != 0)
                         {
-                            coda_option_perform_boundary_checks = prev_option;
                             return -1;
                         }
                     }
@@ -2297,21 +2262,18 @@ static int eval_integer(eval_info *info, const coda_expression *expr, int64_t *v
                     {
                         if (eval_boolean(info, opexpr->operand[1], &condition) != 0)
                         {
-                            coda_option_perform_boundary_checks = prev_option;
                             return -1;
                         }
                         if (!condition)
                         {
                             (*value)++;
-                            if (coda_cursor_goto_next_array_element(&info->cursor) != 0)
+                            if (coda_cursor_goto_next_array_element_unchecked(&info->cursor) != 0)
                             {
-                                coda_option_perform_boundary_checks = prev_option;
                                 return -1;
                             }
                         }
                     }
                 }
-                coda_option_perform_boundary_checks = prev_option;
                 info->cursor = prev_cursor;
             }
             break;
@@ -2433,7 +2395,6 @@ static int eval_integer(eval_info *info, const coda_expression *expr, int64_t *v
         case expr_bit_size:
             {
                 coda_cursor prev_cursor;
-                int use_fast_size_expression;
 
                 assert(info->orig_cursor != NULL);
                 prev_cursor = info->cursor;
@@ -2441,21 +2402,16 @@ static int eval_integer(eval_info *info, const coda_expression *expr, int64_t *v
                 {
                     return -1;
                 }
-                use_fast_size_expression = coda_get_option_use_fast_size_expressions();
-                coda_set_option_use_fast_size_expressions(0);
-                if (coda_cursor_get_bit_size(&info->cursor, value) != 0)
+                if (coda_cursor_get_bit_size_with_fast_size_option(&info->cursor, 0, value) != 0)
                 {
-                    coda_set_option_use_fast_size_expressions(use_fast_size_expression);
                     return -1;
                 }
-                coda_set_option_use_fast_size_expressions(use_fast_size_expression);
                 info->cursor = prev_cursor;
             }
             break;
         case expr_byte_size:
             {
                 coda_cursor prev_cursor;
-                int use_fast_size_expression;
 
                 assert(info->orig_cursor != NULL);
                 prev_cursor = info->cursor;
@@ -2463,14 +2419,14 @@ static int eval_integer(eval_info *info, const coda_expression *expr, int64_t *v
                 {
                     return -1;
                 }
-                use_fast_size_expression = coda_get_option_use_fast_size_expressions();
-                coda_set_option_use_fast_size_expressions(0);
-                if (coda_cursor_get_byte_size(&info->cursor, value) != 0)
+                if (coda_cursor_get_bit_size_with_fast_size_option(&info->cursor, 0, value) != 0)
                 {
-                    coda_set_option_use_fast_size_expressions(use_fast_size_expression);
                     return -1;
                 }
-                coda_set_option_use_fast_size_expressions(use_fast_size_expression);
+                if (*value >= 0)
+                {
+                    *value = bit_size_to_byte_size(*value);
+                }
                 info->cursor = prev_cursor;
             }
             break;
@@ -3078,15 +3034,7 @@ static int eval_string(eval_info *info, const coda_expression *expr, long *offse
                 {
                     return -1;
                 }
-                filename = filepath;
-                while (*filepath != '\0')
-                {
-                    if (*filepath == '/')
-                    {
-                        filename = &filepath[1];
-                    }
-                    filepath++;
-                }
+                filename = coda_get_base_filename(filepath);
                 *offset = 0;
                 *length = strlen(filename);
                 *value = malloc(*length + 1);   /* add room for zero termination at a later time */
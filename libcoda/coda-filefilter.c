@@ -53,7 +53,15 @@ typedef struct NameBuffer_struct
 
 ff_expr *coda_filefilter_tree;
 
-static int coda_match_filepath(int ignore_other_file_types, coda_expression *expr, NameBuffer *path_name,
+typedef struct match_info_struct
+{
+    coda_expression *expr;
+    int (*callbackfunc) (const char *, coda_filefilter_status, const char *, void *);
+    void *userdata;
+} match_info;
+
+static int coda_match_filepath(int ignore_other_file_types, NameBuffer *path_name,
+                               int (*filefunc) (const char *, void *),
                                int (*callback) (const char *, coda_filefilter_status, const char *, void *),
                                void *userdata);
 
@@ -107,53 +115,61 @@ static void append_string_to_name_buffer(NameBuffer *name, const char *str)
     name->length += length;
 }
 
-static int coda_match_file(coda_expression *expr, NameBuffer *path_name,
-                           int (*callback) (const char *, coda_filefilter_status, const char *, void *), void *userdata)
+static int coda_match_file(const char *filepath, void *userdata)
 {
+    match_info *info = (match_info *)userdata;
     coda_product *product;
     coda_cursor cursor;
     int filter_result;
     int result;
 
-    result = coda_open(path_name->buffer, &product);
+    result = coda_open(filepath, &product);
     if (result != 0 && coda_errno == CODA_ERROR_FILE_OPEN)
     {
         /* maybe not enough memory space to map the file in memory =>
          * temporarily disable memory mapping of files and try again
          */
         coda_set_option_use_mmap(0);
-        result = coda_open(path_name->buffer, &product);
+        result = coda_open(filepath, &product);
         coda_set_option_use_mmap(1);
     }
     if (result != 0)
     {
         if (coda_errno == CODA_ERROR_UNSUPPORTED_PRODUCT)
         {
-            return callback(path_name->buffer, coda_ffs_unsupported_file, NULL, userdata);
+            return info->callbackfunc(filepath, coda_ffs_unsupported_file, NULL, info->userdata);
         }
         else
         {
-            return callback(path_name->buffer, coda_ffs_could_not_open_file, coda_errno_to_string(coda_errno),
-                            userdata);
+            return info->callbackfunc(filepath, coda_ffs_could_not_open_file, coda_errno_to_string(coda_errno),
+                                        info->userdata);
         }
     }
 
     if (coda_cursor_set_product(&cursor, product) != 0)
     {
         coda_close(product);
-        return callback(path_name->buffer, coda_ffs_error, coda_errno_to_string(coda_errno), userdata);
+        return info->callbackfunc(filepath, coda_ffs_error, coda_errno_to_string(coda_errno), info->userdata);
     }
-    if (coda_expression_eval_bool(expr, &cursor, &filter_result) != 0)
+    if (coda_expression_eval_bool(info->expr, &cursor, &filter_result) != 0)
     {
-        return callback(path_name->buffer, coda_ffs_error, coda_errno_to_string(coda_errno), userdata);
+        return info->callbackfunc(filepath, coda_ffs_error, coda_errno_to_string(coda_errno), info->userdata);
     }
     coda_close(product);
 
 
-    return callback(path_name->buffer, filter_result ? coda_ffs_match : coda_ffs_no_match, NULL, userdata);
+    return info->callbackfunc(filepath, filter_result ? coda_ffs_match : coda_ffs_no_match, NULL, info->userdata);
+}
+
+static int coda_match_walk_error(const char *filepath, coda_filefilter_status status, const char *error,
+                                 void *userdata)
+{
+    match_info *info = (match_info *)userdata;
+
+    return info->callbackfunc(filepath, status, error, info->userdata);
 }
 
-static int coda_match_dir(coda_expression *expr, NameBuffer *path_name,
+static int coda_match_dir(NameBuffer *path_name, int (*filefunc) (const char *, void *),
                           int (*callback) (const char *, coda_filefilter_status, const char *, void *), void *userdata)
 {
 #ifdef WIN32
@@ -200,7 +216,7 @@ static int coda_match_dir(coda_expression *expr, NameBuffer *path_name,
             append_string_to_name_buffer(path_name, FileData.cFileName);
             if (FileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
             {
-                result = coda_match_dir(expr, path_name, callback, userdata);
+                result = coda_match_dir(path_name, filefunc, callback, userdata);
                 if (result != 0)
                 {
                     FindClose(hSearch);
@@ -209,7 +225,7 @@ static int coda_match_dir(coda_expression *expr, NameBuffer *path_name,
             }
             else
             {
-                result = coda_match_file(expr, path_name, callback, userdata);
+                result = filefunc(path_name->buffer, userdata);
                 if (result != 0)
                 {
                     FindClose(hSearch);
@@ -260,7 +276,7 @@ static int coda_match_dir(coda_expression *expr, NameBuffer *path_name,
         append_string_to_name_buffer(path_name, "/");
         append_string_to_name_buffer(path_name, dp->d_name);
 
-        result = coda_match_filepath(1, expr, path_name, callback, userdata);
+        result = coda_match_filepath(1, path_name, filefunc, callback, userdata);
         if (result != 0)
         {
             closedir(dirp);
@@ -277,7 +293,8 @@ static int coda_match_dir(coda_expression *expr, NameBuffer *path_name,
     return 0;
 }
 
-static int coda_match_filepath(int ignore_other_file_types, coda_expression *expr, NameBuffer *path_name,
+static int coda_match_filepath(int ignore_other_file_types, NameBuffer *path_name,
+                               int (*filefunc) (const char *, void *),
                                int (*callback) (const char *, coda_filefilter_status, const char *, void *),
                                void *userdata)
 {
@@ -297,11 +314,11 @@ static int coda_match_filepath(int ignore_other_file_types, coda_expression *exp
 
     if (sb.st_mode & S_IFDIR)
     {
-        return coda_match_dir(expr, path_name, callback, userdata);
+        return coda_match_dir(path_name, filefunc, callback, userdata);
     }
     else if (sb.st_mode & S_IFREG)
     {
-        return coda_match_file(expr, path_name, callback, userdata);
+        return filefunc(path_name->buffer, userdata);
     }
     else if (!ignore_other_file_types)
     {
@@ -311,6 +328,38 @@ static int coda_match_filepath(int ignore_other_file_types, coda_expression *exp
     return 0;
 }
 
+/* Walk a series of files and directories in the same way as coda_match_filefilter() does.
+ * Directories are processed recursively and filefunc is called for each regular file that is encountered.
+ * Paths that can not be processed (e.g. because they do not exist or because a directory can not be read) are passed
+ * to callbackfunc with the appropriate status and error message.
+ * The walk stops as soon as filefunc or callbackfunc returns a non-zero value, which is then returned by this function.
+ */
+int coda_filefilter_walk(int num_filepaths, const char **filepathlist, int (*filefunc) (const char *, void *),
+                         int (*callbackfunc) (const char *, coda_filefilter_status, const char *, void *),
+                         void *userdata)
+{
+    NameBuffer path_name;
+    int result;
+    int i;
+
+    name_buffer_init(&path_name);
+    for (i = 0; i < num_filepaths; i++)
+    {
+        append_string_to_name_buffer(&path_name, filepathlist[i]);
+        result = coda_match_filepath(0, &path_name, filefunc, callbackfunc, userdata);
+        if (result != 0)
+        {
+            name_buffer_done(&path_name);
+            return result;
+        }
+        path_name.length = 0;
+        path_name.buffer[0] = '\0';
+    }
+    name_buffer_done(&path_name);
+
+    return 0;
+}
+
 /** \addtogroup coda_general
  * @{
  */
@@ -375,11 +424,10 @@ LIBCODA_API int coda_match_filefilter(const char *filefilter, int num_filepaths,
                                       int (*callbackfunc) (const char *, coda_filefilter_status, const char *, void *),
                                       void *userdata)
 {
-    NameBuffer path_name;
     coda_expression_type result_type;
     coda_expression *expr;
+    match_info info;
     int result;
-    int i;
 
     if (num_filepaths <= 0 || filepathlist == NULL || callbackfunc == NULL)
     {
@@ -408,25 +456,13 @@ LIBCODA_API int coda_match_filefilter(const char *filefilter, int num_filepaths,
         return -1;
     }
 
-    name_buffer_init(&path_name);
-    for (i = 0; i < num_filepaths; i++)
-    {
-        append_string_to_name_buffer(&path_name, filepathlist[i]);
-        result = coda_match_filepath(0, expr, &path_name, callbackfunc, userdata);
-        if (result != 0)
-        {
-            name_buffer_done(&path_name);
-            coda_expression_delete(expr);
-            return result;
-        }
-        path_name.length = 0;
-        path_name.buffer[0] = '\0';
-    }
-
-    name_buffer_done(&path_name);
+    info.expr = expr;
+    info.callbackfunc = callbackfunc;
+    info.userdata = userdata;
+    result = coda_filefilter_walk(num_filepaths, filepathlist, coda_match_file, coda_match_walk_error, &info);
     coda_expression_delete(expr);
 
-    return 0;
+    return result;
 }
 
 /**
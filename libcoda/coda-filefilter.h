@@ -97,6 +97,11 @@ typedef struct ff_result_struct
 /* expression evaluation declarations */
 ff_result coda_filefilter_eval_expr(coda_cursor *cursor, ff_expr *expr);
 
+/* directory walk that is shared by coda_match_filefilter() and the parallel matching of files in codafind */
+int coda_filefilter_walk(int num_filepaths, const char **filepathlist, int (*filefunc) (const char *, void *),
+                         int (*callbackfunc) (const char *, coda_filefilter_status, const char *, void *),
+                         void *userdata);
+
 /* parser declarations */
 int coda_filefilter_parse(void);
 int coda_filefilter_error(char *error);
@@ -68,15 +68,15 @@ int coda_grib_cursor_goto_array_element(coda_cursor *cursor, int num_subs, const
                        __FILE__, __LINE__);
         return -1;
     }
-    return coda_grib_cursor_goto_array_element_by_index(cursor, subs[0]);
+    return coda_grib_cursor_goto_array_element_by_index(cursor, subs[0], coda_option_perform_boundary_checks);
 }
 
-int coda_grib_cursor_goto_array_element_by_index(coda_cursor *cursor, long index)
+int coda_grib_cursor_goto_array_element_by_index(coda_cursor *cursor, long index, int perform_boundary_checks)
 {
     coda_grib_value_array *type = (coda_grib_value_array *)cursor->stack[cursor->n - 1].type;
 
     /* check the range for index */
-    if (coda_option_perform_boundary_checks)
+    if (perform_boundary_checks)
     {
         if (index < 0 || index >= type->num_elements)
         {
@@ -94,10 +94,11 @@ int coda_grib_cursor_goto_array_element_by_index(coda_cursor *cursor, long index
     return 0;
 }
 
-int coda_grib_cursor_goto_next_array_element(coda_cursor *cursor)
+int coda_grib_cursor_goto_next_array_element(coda_cursor *cursor, int perform_boundary_checks)
 {
     cursor->n--;
-    if (coda_grib_cursor_goto_array_element_by_index(cursor, cursor->stack[cursor->n].index + 1) != 0)
+    if (coda_grib_cursor_goto_array_element_by_index(cursor, cursor->stack[cursor->n].index + 1,
+                                                     perform_boundary_checks) != 0)
     {
         cursor->n++;
         return -1;
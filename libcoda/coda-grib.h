@@ -43,8 +43,8 @@ void coda_grib_type_delete(coda_dynamic_type *type);
 
 int coda_grib_cursor_set_product(coda_cursor *cursor, coda_product *product);
 int coda_grib_cursor_goto_array_element(coda_cursor *cursor, int num_subs, const long subs[]);
-int coda_grib_cursor_goto_array_element_by_index(coda_cursor *cursor, long index);
-int coda_grib_cursor_goto_next_array_element(coda_cursor *cursor);
+int coda_grib_cursor_goto_array_element_by_index(coda_cursor *cursor, long index, int perform_boundary_checks);
+int coda_grib_cursor_goto_next_array_element(coda_cursor *cursor, int perform_boundary_checks);
 int coda_grib_cursor_goto_attributes(coda_cursor *cursor);
 int coda_grib_cursor_get_num_elements(const coda_cursor *cursor, long *num_elements);
 int coda_grib_cursor_get_array_dim(const coda_cursor *cursor, int *num_dims, long dim[]);
@@ -0,0 +1,715 @@
+/*
+ * Copyright (C) 2007-2017 S[&]T, The Netherlands.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coda-gzip.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include "zlib.h"
+
+/* Random access to the decompressed data of a gzip compressed file.
+ * During an initial pass over the full file we record 'access points' at deflate block boundaries roughly every
+ * ACCESS_POINT_SPAN bytes of decompressed data (this is the approach of zran.c from the zlib examples).
+ * An access point contains everything that is needed to restart decompression at that location: the bit position in
+ * the compressed data and the last 32KB of decompressed data (which is the dictionary for the rest of the deflate
+ * stream). A read then only needs to decompress the data from the nearest access point before the requested offset.
+ * The decompression state is kept after each read, so sequential reads can just continue where the previous read
+ * ended. Files consisting of multiple concatenated gzip members are supported.
+ * The same approach is used for a single raw deflate stream at an offset in a file (i.e. a compressed zip entry).
+ */
+
+#define WINDOW_SIZE 32768
+#define ACCESS_POINT_SPAN (1024 * 1024)
+#define INPUT_BUFFER_SIZE 16384
+
+/* maximum number of bytes that we let inflate() produce in one go */
+#define MAX_INFLATE_LENGTH (1 << 30)
+
+typedef struct access_point_struct
+{
+    int64_t out;        /* offset in the decompressed data */
+    int64_t in;         /* offset in the compressed data of the first full byte after the access point */
+    int bits;   /* number of bits (1-7) of the byte at in - 1 that are part of the access point (0 if none), or -1 if
+                 * the access point is at the start of a gzip member or raw deflate stream */
+    uint8_t *window;    /* the WINDOW_SIZE bytes of decompressed data before the access point (NULL if bits is -1) */
+} access_point;
+
+struct coda_gzip_index_struct
+{
+    int64_t size;       /* size of the decompressed data */
+    int raw_deflate;    /* 1 if the data is a single raw deflate stream instead of a sequence of gzip members */
+    long num_points;
+    access_point *point;
+    const coda_gzip_index *shared_index;        /* index that owns 'point' (NULL if this index owns them itself) */
+
+    /* decompression state that is kept between reads */
+    z_stream strm;
+    int strm_initialised;
+    int strm_raw;       /* 1 if strm decodes a raw deflate stream (started from an access point inside a gzip member) */
+    int64_t strm_out;   /* offset in the decompressed data of the next byte that strm will produce */
+    int64_t strm_in;    /* offset in the compressed data of the next byte that will be read into 'input' */
+    uint8_t input[INPUT_BUFFER_SIZE];
+    uint8_t discard[WINDOW_SIZE];       /* output buffer for data that is skipped */
+};
+
+static int read_at(int fd, int64_t offset, uint8_t *buffer, int length, int *num_read)
+{
+    for (;;)
+    {
+        int result;
+
+#if HAVE_PREAD
+        result = (int)pread(fd, buffer, (size_t)length, (off_t)offset);
+#else
+        if (lseek(fd, (off_t)offset, SEEK_SET) < 0)
+        {
+            char byte_offset_str[21];
+
+            coda_str64(offset, byte_offset_str);
+            coda_set_error(CODA_ERROR_FILE_READ, "could not move to byte position %s (%s)", byte_offset_str,
+                           strerror(errno));
+            return -1;
+        }
+        result = (int)read(fd, buffer, (size_t)length);
+#endif
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            coda_set_error(CODA_ERROR_FILE_READ, "could not read from file (%s)", strerror(errno));
+            return -1;
+        }
+        *num_read = result;
+        return 0;
+    }
+}
+
+/* make sure that there is input available for strm (returns 0 in 'available' if the end of the file is reached) */
+static int fill_input(coda_gzip_index *index, int fd, int *available)
+{
+    int num_read;
+
+    if (index->strm.avail_in > 0)
+    {
+        *available = 1;
+        return 0;
+    }
+    if (read_at(fd, index->strm_in, index->input, INPUT_BUFFER_SIZE, &num_read) != 0)
+    {
+        return -1;
+    }
+    index->strm_in += num_read;
+    index->strm.next_in = index->input;
+    index->strm.avail_in = num_read;
+    *available = (num_read > 0);
+
+    return 0;
+}
+
+/* returns whether another gzip member starts at the current input position */
+static int next_member_follows(coda_gzip_index *index, int fd, int *result)
+{
+    uint8_t magic[2];
+    int num_read;
+
+    if (index->strm.avail_in >= 2)
+    {
+        *result = (index->strm.next_in[0] == 0x1f && index->strm.next_in[1] == 0x8b);
+        return 0;
+    }
+    if (read_at(fd, index->strm_in - index->strm.avail_in, magic, 2, &num_read) != 0)
+    {
+        return -1;
+    }
+    *result = (num_read == 2 && magic[0] == 0x1f && magic[1] == 0x8b);
+
+    return 0;
+}
+
+static void set_decompress_error(const z_stream *strm)
+{
+    if (strm->msg != NULL)
+    {
+        coda_set_error(CODA_ERROR_FILE_READ, "could not decompress file (%s)", strm->msg);
+    }
+    else
+    {
+        coda_set_error(CODA_ERROR_FILE_READ, "could not decompress file (invalid compressed data)");
+    }
+}
+
+static int add_access_point(coda_gzip_index *index, int64_t out, int64_t in, int bits, const uint8_t *window,
+                            unsigned int window_position)
+{
+    access_point *point;
+
+    if (index->num_points % 64 == 0)
+    {
+        access_point *new_point;
+
+        new_point = realloc(index->point, (index->num_points + 64) * sizeof(access_point));
+        if (new_point == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (index->num_points + 64) * sizeof(access_point), __FILE__, __LINE__);
+            return -1;
+        }
+        index->point = new_point;
+    }
+    point = &index->point[index->num_points];
+    point->out = out;
+    point->in = in;
+    point->bits = bits;
+    point->window = NULL;
+    if (window != NULL)
+    {
+        point->window = malloc(WINDOW_SIZE);
+        if (point->window == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)WINDOW_SIZE, __FILE__, __LINE__);
+            return -1;
+        }
+        /* 'window' is a circular buffer in which the oldest data starts at window_position */
+        memcpy(point->window, &window[window_position], WINDOW_SIZE - window_position);
+        memcpy(&point->window[WINDOW_SIZE - window_position], window, window_position);
+    }
+    index->num_points++;
+
+    return 0;
+}
+
+void coda_gzip_index_delete(coda_gzip_index *index)
+{
+    long i;
+
+    if (index->shared_index == NULL && index->point != NULL)
+    {
+        for (i = 0; i < index->num_points; i++)
+        {
+            if (index->point[i].window != NULL)
+            {
+                free(index->point[i].window);
+            }
+        }
+        free(index->point);
+    }
+    if (index->strm_initialised)
+    {
+        inflateEnd(&index->strm);
+    }
+    free(index);
+}
+
+static coda_gzip_index *index_new(void)
+{
+    coda_gzip_index *index;
+
+    index = malloc(sizeof(coda_gzip_index));
+    if (index == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       sizeof(coda_gzip_index), __FILE__, __LINE__);
+        return NULL;
+    }
+    index->size = 0;
+    index->raw_deflate = 0;
+    index->num_points = 0;
+    index->point = NULL;
+    index->shared_index = NULL;
+    index->strm_initialised = 0;
+    index->strm_raw = 0;
+    index->strm_out = 0;
+    index->strm_in = 0;
+
+    return index;
+}
+
+/* create a new index that shares the access points of 'index' but has its own decompression state
+ * this allows reading the same compressed file via two file descriptors; the new index should be deleted before
+ * 'index' is deleted
+ */
+coda_gzip_index *coda_gzip_index_share(const coda_gzip_index *index)
+{
+    coda_gzip_index *new_index;
+
+    new_index = index_new();
+    if (new_index == NULL)
+    {
+        return NULL;
+    }
+    new_index->size = index->size;
+    new_index->raw_deflate = index->raw_deflate;
+    new_index->num_points = index->num_points;
+    new_index->point = index->point;
+    new_index->shared_index = index->shared_index != NULL ? index->shared_index : index;
+
+    return new_index;
+}
+
+static int init_stream(coda_gzip_index *index, int window_bits)
+{
+    index->strm.zalloc = Z_NULL;
+    index->strm.zfree = Z_NULL;
+    index->strm.opaque = Z_NULL;
+    index->strm.next_in = Z_NULL;
+    index->strm.avail_in = 0;
+    if (inflateInit2(&index->strm, window_bits) != Z_OK)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "could not initialise decompression (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    index->strm_initialised = 1;
+    index->strm_raw = (window_bits < 0);
+
+    return 0;
+}
+
+/* Decompress the full gzip file (or, if raw_deflate is set, the raw deflate stream that starts at 'offset').
+ * If the size of the decompressed data is at most CODA_GZIP_MAX_MEMORY_SIZE the decompressed data is returned in
+ * 'buffer' (and 'index' is set to NULL). Otherwise 'buffer' is set to NULL and a random access index is returned that
+ * can be used with coda_gzip_read().
+ */
+int coda_gzip_decompress(int fd, int64_t offset, int raw_deflate, uint8_t **buffer, coda_gzip_index **index,
+                         int64_t *size)
+{
+    coda_gzip_index *new_index;
+    uint8_t *window;
+    uint8_t *data = NULL;
+    int64_t data_size = 0;
+    int keep_data = 1;
+    int64_t out = 0;
+    int64_t last_point_out = 0;
+
+    new_index = index_new();
+    if (new_index == NULL)
+    {
+        return -1;
+    }
+    new_index->raw_deflate = raw_deflate;
+    new_index->strm_in = offset;
+    window = calloc(WINDOW_SIZE, 1);
+    if (window == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)WINDOW_SIZE, __FILE__, __LINE__);
+        coda_gzip_index_delete(new_index);
+        return -1;
+    }
+
+    /* 15 + 32: maximum window size with automatic detection of the gzip header */
+    if (init_stream(new_index, raw_deflate ? -15 : 15 + 32) != 0 ||
+        add_access_point(new_index, 0, offset, -1, NULL, 0) != 0)
+    {
+        free(window);
+        coda_gzip_index_delete(new_index);
+        return -1;
+    }
+    new_index->strm.avail_out = 0;
+
+    for (;;)
+    {
+        z_stream *strm = &new_index->strm;
+        uint8_t *next_out;
+        int available;
+        int result;
+        int length;
+
+        if (fill_input(new_index, fd, &available) != 0)
+        {
+            free(window);
+            coda_gzip_index_delete(new_index);
+            if (data != NULL)
+            {
+                free(data);
+            }
+            return -1;
+        }
+        if (!available)
+        {
+            coda_set_error(CODA_ERROR_FILE_READ, "could not decompress file (unexpected end of compressed data)");
+            free(window);
+            coda_gzip_index_delete(new_index);
+            if (data != NULL)
+            {
+                free(data);
+            }
+            return -1;
+        }
+        if (strm->avail_out == 0)
+        {
+            strm->next_out = window;
+            strm->avail_out = WINDOW_SIZE;
+        }
+        next_out = strm->next_out;
+        length = strm->avail_out;
+        result = inflate(strm, Z_BLOCK);
+        length -= strm->avail_out;
+        if (result == Z_NEED_DICT || result == Z_DATA_ERROR || result == Z_MEM_ERROR || result == Z_STREAM_ERROR)
+        {
+            set_decompress_error(strm);
+            free(window);
+            coda_gzip_index_delete(new_index);
+            if (data != NULL)
+            {
+                free(data);
+            }
+            return -1;
+        }
+
+        if (length > 0 && keep_data)
+        {
+            if (out + length > CODA_GZIP_MAX_MEMORY_SIZE)
+            {
+                /* too large to keep in memory -> only use the index */
+                if (data != NULL)
+                {
+                    free(data);
+                    data = NULL;
+                }
+                keep_data = 0;
+            }
+            else
+            {
+                if (out + length > data_size)
+                {
+                    uint8_t *new_data;
+                    int64_t new_size = (data_size == 0 ? 65536 : 2 * data_size);
+
+                    while (new_size < out + length)
+                    {
+                        new_size *= 2;
+                    }
+                    new_data = realloc(data, (size_t)new_size);
+                    if (new_data == NULL)
+                    {
+                        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) "
+                                       "(%s:%u)", (long)new_size, __FILE__, __LINE__);
+                        free(window);
+                        coda_gzip_index_delete(new_index);
+                        if (data != NULL)
+                        {
+                            free(data);
+                        }
+                        return -1;
+                    }
+                    data = new_data;
+                    data_size = new_size;
+                }
+                memcpy(&data[out], next_out, length);
+            }
+        }
+        out += length;
+
+        if (result == Z_STREAM_END)
+        {
+            int next_member;
+
+            if (raw_deflate)
+            {
+                break;
+            }
+            /* end of a gzip member -> check whether another member follows (anything else is ignored) */
+            if (next_member_follows(new_index, fd, &next_member) != 0)
+            {
+                free(window);
+                coda_gzip_index_delete(new_index);
+                if (data != NULL)
+                {
+                    free(data);
+                }
+                return -1;
+            }
+            if (!next_member)
+            {
+                break;
+            }
+            inflateReset(strm);
+            if (out - last_point_out > ACCESS_POINT_SPAN)
+            {
+                if (add_access_point(new_index, out, new_index->strm_in - strm->avail_in, -1, NULL, 0) != 0)
+                {
+                    free(window);
+                    coda_gzip_index_delete(new_index);
+                    if (data != NULL)
+                    {
+                        free(data);
+                    }
+                    return -1;
+                }
+                last_point_out = out;
+            }
+        }
+        else if ((strm->data_type & 128) && !(strm->data_type & 64) && out - last_point_out > ACCESS_POINT_SPAN)
+        {
+            /* we are at a deflate block boundary (that is not the end of the stream) */
+            if (add_access_point(new_index, out, new_index->strm_in - strm->avail_in, strm->data_type & 7, window,
+                                 WINDOW_SIZE - strm->avail_out) != 0)
+            {
+                free(window);
+                coda_gzip_index_delete(new_index);
+                if (data != NULL)
+                {
+                    free(data);
+                }
+                return -1;
+            }
+            last_point_out = out;
+        }
+    }
+
+    free(window);
+    inflateEnd(&new_index->strm);
+    new_index->strm_initialised = 0;
+    new_index->size = out;
+    *size = out;
+
+    if (keep_data)
+    {
+        coda_gzip_index_delete(new_index);
+        if (data == NULL)
+        {
+            /* make sure that we always return a buffer (also for empty files) */
+            data = malloc(1);
+            if (data == NULL)
+            {
+                coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                               (long)1, __FILE__, __LINE__);
+                return -1;
+            }
+        }
+        else if (data_size > out)
+        {
+            uint8_t *new_data = realloc(data, (size_t)out);
+
+            if (new_data != NULL)
+            {
+                data = new_data;
+            }
+        }
+        *buffer = data;
+        *index = NULL;
+    }
+    else
+    {
+        *buffer = NULL;
+        *index = new_index;
+    }
+
+    return 0;
+}
+
+/* (re)start decompression at the last access point before 'offset' */
+static int restart_at_access_point(coda_gzip_index *index, int fd, int64_t offset)
+{
+    access_point *point;
+    long low = 0;
+    long high = index->num_points - 1;
+
+    /* find the last access point with point->out <= offset (the first access point is always at offset 0) */
+    while (low < high)
+    {
+        long middle = (low + high + 1) / 2;
+
+        if (index->point[middle].out <= offset)
+        {
+            low = middle;
+        }
+        else
+        {
+            high = middle - 1;
+        }
+    }
+    point = &index->point[low];
+
+    if (index->strm_initialised)
+    {
+        inflateEnd(&index->strm);
+        index->strm_initialised = 0;
+    }
+    index->strm_out = point->out;
+    index->strm_in = point->in;
+    if (point->bits < 0)
+    {
+        return init_stream(index, index->raw_deflate ? -15 : 15 + 32);
+    }
+
+    /* start a raw deflate stream in the middle of the gzip member */
+    if (init_stream(index, -15) != 0)
+    {
+        return -1;
+    }
+    if (point->bits > 0)
+    {
+        uint8_t byte;
+        int num_read;
+
+        if (read_at(fd, point->in - 1, &byte, 1, &num_read) != 0)
+        {
+            return -1;
+        }
+        if (num_read != 1)
+        {
+            coda_set_error(CODA_ERROR_FILE_READ, "could not decompress file (unexpected end of compressed data)");
+            return -1;
+        }
+        inflatePrime(&index->strm, point->bits, byte >> (8 - point->bits));
+    }
+    inflateSetDictionary(&index->strm, point->window, WINDOW_SIZE);
+
+    return 0;
+}
+
+/* decompress the next 'length' bytes into dst */
+static int inflate_data(coda_gzip_index *index, int fd, uint8_t *dst, int64_t length)
+{
+    z_stream *strm = &index->strm;
+
+    while (length > 0)
+    {
+        int chunk_length = (length > MAX_INFLATE_LENGTH ? MAX_INFLATE_LENGTH : (int)length);
+
+        strm->next_out = dst;
+        strm->avail_out = chunk_length;
+        while (strm->avail_out > 0)
+        {
+            int available;
+            int result;
+
+            if (fill_input(index, fd, &available) != 0)
+            {
+                return -1;
+            }
+            if (!available)
+            {
+                coda_set_error(CODA_ERROR_FILE_READ, "could not decompress file (unexpected end of compressed data)");
+                return -1;
+            }
+            result = inflate(strm, Z_NO_FLUSH);
+            if (result == Z_NEED_DICT || result == Z_DATA_ERROR || result == Z_MEM_ERROR || result == Z_STREAM_ERROR)
+            {
+                set_decompress_error(strm);
+                return -1;
+            }
+            if (result == Z_STREAM_END)
+            {
+                if (index->raw_deflate)
+                {
+                    if (strm->avail_out > 0)
+                    {
+                        coda_set_error(CODA_ERROR_FILE_READ, "could not decompress file (unexpected end of "
+                                       "compressed data)");
+                        return -1;
+                    }
+                }
+                else if (index->strm_raw)
+                {
+                    int trailer_length = 8;
+
+                    /* skip the gzip trailer (CRC32 and ISIZE) and continue with the header of the next member */
+                    while (trailer_length > 0)
+                    {
+                        int skip_length;
+
+                        if (fill_input(index, fd, &available) != 0)
+                        {
+                            return -1;
+                        }
+                        if (!available)
+                        {
+                            coda_set_error(CODA_ERROR_FILE_READ, "could not decompress file (unexpected end of "
+                                           "compressed data)");
+                            return -1;
+                        }
+                        skip_length = (int)strm->avail_in < trailer_length ? (int)strm->avail_in : trailer_length;
+                        strm->next_in += skip_length;
+                        strm->avail_in -= skip_length;
+                        trailer_length -= skip_length;
+                    }
+                    inflateReset2(strm, 15 + 32);
+                    index->strm_raw = 0;
+                }
+                else
+                {
+                    inflateReset(strm);
+                }
+            }
+        }
+        index->strm_out += chunk_length;
+        dst += chunk_length;
+        length -= chunk_length;
+    }
+
+    return 0;
+}
+
+/* read decompressed data using the random access index */
+int coda_gzip_read(coda_gzip_index *index, int fd, int64_t offset, int64_t length, uint8_t *dst)
+{
+    if (!index->strm_initialised || offset < index->strm_out || offset - index->strm_out > ACCESS_POINT_SPAN)
+    {
+        /* we can't continue from the current decompression state */
+        if (restart_at_access_point(index, fd, offset) != 0)
+        {
+            return -1;
+        }
+    }
+    while (index->strm_out < offset)
+    {
+        int64_t skip_length = offset - index->strm_out;
+
+        if (skip_length > WINDOW_SIZE)
+        {
+            skip_length = WINDOW_SIZE;
+        }
+        if (inflate_data(index, fd, index->discard, skip_length) != 0)
+        {
+            inflateEnd(&index->strm);
+            index->strm_initialised = 0;
+            return -1;
+        }
+    }
+    if (inflate_data(index, fd, dst, length) != 0)
+    {
+        inflateEnd(&index->strm);
+        index->strm_initialised = 0;
+        return -1;
+    }
+
+    return 0;
+}
@@ -211,12 +211,12 @@ int coda_hdf4_cursor_goto_array_element(coda_cursor *cursor, int num_subs, const
     return 0;
 }
 
-int coda_hdf4_cursor_goto_array_element_by_index(coda_cursor *cursor, long index)
+int coda_hdf4_cursor_goto_array_element_by_index(coda_cursor *cursor, long index, int perform_boundary_checks)
 {
     coda_hdf4_type *base_type;
 
     /* check the range for index */
-    if (coda_option_perform_boundary_checks)
+    if (perform_boundary_checks)
     {
         long num_elements;
 
@@ -245,9 +245,9 @@ int coda_hdf4_cursor_goto_array_element_by_index(coda_cursor *cursor, long index
     return 0;
 }
 
-int coda_hdf4_cursor_goto_next_array_element(coda_cursor *cursor)
+int coda_hdf4_cursor_goto_next_array_element(coda_cursor *cursor, int perform_boundary_checks)
 {
-    if (coda_option_perform_boundary_checks)
+    if (perform_boundary_checks)
     {
         long num_elements;
         long index;
@@ -844,14 +844,239 @@ static int read_partial_array(const coda_cursor *cursor, long offset, long lengt
     return 0;
 }
 
-static int read_basic_type(const coda_cursor *cursor, void *dst)
+/* returns 1 if the element was available in the cache (and copies it to dst), 0 otherwise */
+static int get_cached_element(const coda_hdf4_cache *cache, long index, int element_size, void *dst)
+{
+    if (cache->num_elements > 0 && index >= cache->start_index && index < cache->start_index + cache->num_elements)
+    {
+        memcpy(dst, &cache->buffer[(index - cache->start_index) * element_size], element_size);
+        return 1;
+    }
+    return 0;
+}
+
+/* make sure the cache buffer can hold 'size' bytes; the contents of the cache will be invalidated */
+static int reserve_cache(coda_hdf4_product *product, coda_hdf4_cache *cache, long size)
+{
+    cache->num_elements = 0;
+    if (cache->buffer == NULL)
+    {
+        coda_hdf4_cache *evicted;
+
+        /* take a slot in the list of cached datasets and release the cache that was previously using that slot */
+        evicted = product->cached_dataset[product->next_cache_slot];
+        if (evicted != NULL)
+        {
+            free(evicted->buffer);
+            evicted->buffer = NULL;
+            evicted->buffer_size = 0;
+            evicted->num_elements = 0;
+        }
+        product->cached_dataset[product->next_cache_slot] = cache;
+        product->next_cache_slot = (product->next_cache_slot + 1) % HDF4_MAX_CACHED_DATASETS;
+    }
+    if (cache->buffer_size < size)
+    {
+        uint8_t *buffer;
+
+        buffer = realloc(cache->buffer, size);
+        if (buffer == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)size, __FILE__, __LINE__);
+            return -1;
+        }
+        cache->buffer = buffer;
+        cache->buffer_size = size;
+    }
+
+    return 0;
+}
+
+/* read the block of the GRImage that contains the element 'index' into the cache of the GRImage */
+static int fill_GRImage_cache(coda_hdf4_product *product, coda_hdf4_GRImage *type, long index)
+{
+    int32 start[2];
+    int32 stride[2];
+    int32 edge[2];
+    long pixel_size;
+    long block_size;
+    long x, y;
+
+    /* the cache always contains whole pixels (i.e. all components) */
+    pixel_size = get_native_type_size(type->basic_type->definition->read_type) * type->ncomp;
+    block_size = HDF4_CACHE_BLOCK_SIZE / pixel_size;
+    if (block_size < 1)
+    {
+        block_size = 1;
+    }
+
+    /* For GRImage data the first dimension is the fastest running */
+    x = (index / type->ncomp) % type->dim_sizes[0];
+    y = (index / type->ncomp) / type->dim_sizes[0];
+    stride[0] = 1;
+    stride[1] = 1;
+    if (type->dim_sizes[0] >= block_size)
+    {
+        /* read part of a single row */
+        start[0] = (int32)((x / block_size) * block_size);
+        edge[0] = (int32)(type->dim_sizes[0] - start[0] < block_size ? type->dim_sizes[0] - start[0] : block_size);
+        start[1] = (int32)y;
+        edge[1] = 1;
+    }
+    else
+    {
+        long num_rows = block_size / type->dim_sizes[0];
+
+        /* read one or more full rows */
+        start[0] = 0;
+        edge[0] = type->dim_sizes[0];
+        start[1] = (int32)((y / num_rows) * num_rows);
+        edge[1] = (int32)(type->dim_sizes[1] - start[1] < num_rows ? type->dim_sizes[1] - start[1] : num_rows);
+    }
+
+    if (reserve_cache(product, &type->cache, edge[0] * edge[1] * pixel_size) != 0)
+    {
+        return -1;
+    }
+    if (GRreadimage(type->ri_id, start, stride, edge, type->cache.buffer) != 0)
+    {
+        coda_set_error(CODA_ERROR_HDF4, NULL);
+        return -1;
+    }
+    type->cache.start_index = ((long)start[1] * type->dim_sizes[0] + start[0]) * type->ncomp;
+    type->cache.num_elements = (long)edge[0] * edge[1] * type->ncomp;
+
+    return 0;
+}
+
+/* read the hyperslab of the SDS that contains the element 'index' into the cache of the SDS */
+static int fill_SDS_cache(coda_hdf4_product *product, coda_hdf4_SDS *type, long index)
 {
     int32 start[MAX_HDF4_VAR_DIMS];
-    int32 stride[MAX_HDF4_VAR_DIMS];
     int32 edge[MAX_HDF4_VAR_DIMS];
-    long index;
+    long element_size;
+    long block_size;
+    long num_elements;
+    long start_index;
+    int last;
     long i;
 
+    assert(type->rank > 0);
+    element_size = get_native_type_size(type->basic_type->definition->read_type);
+    block_size = HDF4_CACHE_BLOCK_SIZE / element_size;
+    if (block_size < 1)
+    {
+        block_size = 1;
+    }
+
+    for (i = type->rank - 1; i >= 0; i--)
+    {
+        start[i] = index % type->dimsizes[i];
+        index /= type->dimsizes[i];
+        edge[i] = 1;
+    }
+
+    /* the last dimension is the fastest running */
+    last = type->rank - 1;
+    if (type->rank == 1 || type->dimsizes[last] >= block_size)
+    {
+        /* read part of a single row */
+        start[last] = (int32)((start[last] / block_size) * block_size);
+        edge[last] = (int32)(type->dimsizes[last] - start[last] < block_size ? type->dimsizes[last] - start[last] :
+                             block_size);
+    }
+    else
+    {
+        long num_rows = block_size / type->dimsizes[last];
+
+        /* read one or more full rows */
+        start[last] = 0;
+        edge[last] = type->dimsizes[last];
+        start[last - 1] = (int32)((start[last - 1] / num_rows) * num_rows);
+        edge[last - 1] = (int32)(type->dimsizes[last - 1] - start[last - 1] < num_rows ?
+                                 type->dimsizes[last - 1] - start[last - 1] : num_rows);
+    }
+
+    start_index = 0;
+    num_elements = 1;
+    for (i = 0; i < type->rank; i++)
+    {
+        start_index = start_index * type->dimsizes[i] + start[i];
+        num_elements *= edge[i];
+    }
+
+    if (reserve_cache(product, &type->cache, num_elements * element_size) != 0)
+    {
+        return -1;
+    }
+    if (SDreaddata(type->sds_id, start, NULL, edge, type->cache.buffer) != 0)
+    {
+        coda_set_error(CODA_ERROR_HDF4, NULL);
+        return -1;
+    }
+    type->cache.start_index = start_index;
+    type->cache.num_elements = num_elements;
+
+    return 0;
+}
+
+/* read the range of Vdata records that contains the element 'index' of the field into the cache of the field */
+static int fill_Vdata_field_cache(coda_hdf4_product *product, coda_hdf4_Vdata *type, coda_hdf4_Vdata_field *field_type,
+                                  long index)
+{
+    long num_records;
+    long record_pos;
+    int size;
+
+    size = VSsizeof(type->vdata_id, field_type->field_name);
+    if (size < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF4, NULL);
+        return -1;
+    }
+
+    /* the cache always contains whole records (i.e. all 'order' elements of the field) */
+    num_records = HDF4_CACHE_BLOCK_SIZE / size;
+    if (num_records < 1)
+    {
+        num_records = 1;
+    }
+    record_pos = ((index / field_type->order) / num_records) * num_records;
+    if (field_type->num_records - record_pos < num_records)
+    {
+        num_records = field_type->num_records - record_pos;
+    }
+
+    if (reserve_cache(product, &field_type->cache, num_records * size) != 0)
+    {
+        return -1;
+    }
+    if (VSseek(type->vdata_id, (int32)record_pos) < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF4, NULL);
+        return -1;
+    }
+    if (VSsetfields(type->vdata_id, field_type->field_name) != 0)
+    {
+        coda_set_error(CODA_ERROR_HDF4, NULL);
+        return -1;
+    }
+    if (VSread(type->vdata_id, field_type->cache.buffer, (int32)num_records, FULL_INTERLACE) < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF4, NULL);
+        return -1;
+    }
+    field_type->cache.start_index = record_pos * field_type->order;
+    field_type->cache.num_elements = num_records * field_type->order;
+
+    return 0;
+}
+
+static int read_basic_type(const coda_cursor *cursor, void *dst)
+{
+    long index;
+
     index = cursor->stack[cursor->n - 1].index;
 
     assert(cursor->n > 1);
@@ -904,79 +1129,46 @@ static int read_basic_type(const coda_cursor *cursor, void *dst)
         case tag_hdf4_GRImage:
             {
                 coda_hdf4_GRImage *type;
+                int component_size;
 
-                stride[0] = 1;
-                stride[1] = 1;
-                edge[0] = 1;
-                edge[1] = 1;
                 type = (coda_hdf4_GRImage *)cursor->stack[cursor->n - 2].type;
-                if (type->ncomp != 1)
+                component_size = get_native_type_size(type->basic_type->definition->read_type);
+                if (!get_cached_element(&type->cache, index, component_size, dst))
                 {
-                    uint8 *buffer;
-                    int component_size;
-                    int component_index;
-
-                    component_size = get_native_type_size(type->basic_type->definition->read_type);
-
-                    /* HDF4 does not allow reading a single component of a GRImage, so we have to first read all
-                     * components and then return only the data item that was requested */
-                    buffer = malloc(component_size * type->ncomp);
-                    if (buffer == NULL)
+                    if (fill_GRImage_cache((coda_hdf4_product *)cursor->product, type, index) != 0)
                     {
-                        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
-                                       (long)(component_size * type->ncomp), __FILE__, __LINE__);
-                        return -1;
-                    }
-                    component_index = index % type->ncomp;
-                    index /= type->ncomp;
-                    /* For GRImage data the first dimension is the fastest running */
-                    start[0] = index % type->dim_sizes[0];
-                    start[1] = index / type->dim_sizes[0];
-                    if (GRreadimage(type->ri_id, start, stride, edge, buffer) != 0)
-                    {
-                        coda_set_error(CODA_ERROR_HDF4, NULL);
-                        free(buffer);
-                        return -1;
-                    }
-                    memcpy(dst, &buffer[component_index * component_size], component_size);
-                    free(buffer);
-                }
-                else
-                {
-                    /* For GRImage data the first dimension is the fastest running */
-                    start[0] = index % type->dim_sizes[0];
-                    start[1] = index / type->dim_sizes[0];
-                    if (GRreadimage(type->ri_id, start, stride, edge, dst) != 0)
-                    {
-                        coda_set_error(CODA_ERROR_HDF4, NULL);
                         return -1;
                     }
+                    get_cached_element(&type->cache, index, component_size, dst);
                 }
             }
             break;
         case tag_hdf4_SDS:
             {
                 coda_hdf4_SDS *type;
+                int element_size;
 
                 type = (coda_hdf4_SDS *)cursor->stack[cursor->n - 2].type;
                 if (type->rank == 0)
                 {
-                    start[0] = 0;
-                    edge[1] = 1;
-                }
-                else
-                {
-                    for (i = type->rank - 1; i >= 0; i--)
+                    int32 start[1] = { 0 };
+                    int32 edge[1] = { 1 };
+
+                    if (SDreaddata(type->sds_id, start, NULL, edge, dst) != 0)
                     {
-                        start[i] = index % type->dimsizes[i];
-                        index /= type->dimsizes[i];
-                        edge[i] = 1;
+                        coda_set_error(CODA_ERROR_HDF4, NULL);
+                        return -1;
                     }
+                    break;
                 }
-                if (SDreaddata(type->sds_id, start, NULL, edge, dst) != 0)
+                element_size = get_native_type_size(type->basic_type->definition->read_type);
+                if (!get_cached_element(&type->cache, index, element_size, dst))
                 {
-                    coda_set_error(CODA_ERROR_HDF4, NULL);
-                    return -1;
+                    if (fill_SDS_cache((coda_hdf4_product *)cursor->product, type, index) != 0)
+                    {
+                        return -1;
+                    }
+                    get_cached_element(&type->cache, index, element_size, dst);
                 }
             }
             break;
@@ -984,63 +1176,19 @@ static int read_basic_type(const coda_cursor *cursor, void *dst)
             {
                 coda_hdf4_Vdata *type;
                 coda_hdf4_Vdata_field *field_type;
-                int record_pos;
-                int order_pos;
+                int element_size;
 
                 assert(cursor->n > 2);
                 type = (coda_hdf4_Vdata *)cursor->stack[cursor->n - 3].type;
                 field_type = (coda_hdf4_Vdata_field *)cursor->stack[cursor->n - 2].type;
-                order_pos = index % field_type->order;
-                record_pos = index / field_type->order;
-                if (VSseek(type->vdata_id, record_pos) < 0)
-                {
-                    coda_set_error(CODA_ERROR_HDF4, NULL);
-                    return -1;
-                }
-                if (VSsetfields(type->vdata_id, field_type->field_name) != 0)
+                element_size = get_native_type_size(field_type->basic_type->definition->read_type);
+                if (!get_cached_element(&field_type->cache, index, element_size, dst))
                 {
-                    coda_set_error(CODA_ERROR_HDF4, NULL);
-                    return -1;
-                }
-                if (field_type->order > 1)
-                {
-                    /* HDF4 does not allow reading part of a vdata field, so we have to first read the full field and
-                     * then return only the data item that was requested */
-                    uint8 *buffer;
-                    int element_size;
-                    int size;
-
-                    size = VSsizeof(type->vdata_id, field_type->field_name);
-                    if (size < 0)
-                    {
-                        coda_set_error(CODA_ERROR_HDF4, NULL);
-                        return -1;
-                    }
-                    buffer = malloc(size);
-                    if (buffer == NULL)
-                    {
-                        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
-                                       (long)size, __FILE__, __LINE__);
-                        return -1;
-                    }
-                    if (VSread(type->vdata_id, buffer, 1, FULL_INTERLACE) < 0)
-                    {
-                        coda_set_error(CODA_ERROR_HDF4, NULL);
-                        free(buffer);
-                        return -1;
-                    }
-                    /* the size of a field element is the field size divided by the order of the field */
-                    element_size = size / field_type->order;
-                    memcpy(dst, &buffer[order_pos * element_size], element_size);
-                    free(buffer);
-                }
-                else
-                {
-                    if (VSread(type->vdata_id, (uint8 *)dst, 1, FULL_INTERLACE) < 0)
+                    if (fill_Vdata_field_cache((coda_hdf4_product *)cursor->product, type, field_type, index) != 0)
                     {
-                        coda_set_error(CODA_ERROR_HDF4, NULL);
                         return -1;
                     }
+                    get_cached_element(&field_type->cache, index, element_size, dst);
                 }
             }
             break;
@@ -41,6 +41,11 @@
 #define MAX_HDF4_NAME_LENGTH 256
 #define MAX_HDF4_VAR_DIMS 32
 
+/* maximum size in bytes of the block of data that is read ahead for a single SDS, GRImage, or Vdata field */
+#define HDF4_CACHE_BLOCK_SIZE 65536
+/* maximum number of datasets for which a read-ahead block is kept in memory (per product) */
+#define HDF4_MAX_CACHED_DATASETS 16
+
 typedef enum hdf4_type_tag_enum
 {
     tag_hdf4_basic_type,        /* coda_integer_class, coda_real_class, coda_text_class */
@@ -55,6 +60,17 @@ typedef enum hdf4_type_tag_enum
     tag_hdf4_Vgroup     /* coda_record_class */
 } hdf4_type_tag;
 
+/* Read-ahead cache for scalar reads from an SDS, GRImage, or Vdata field.
+ * The cache contains a contiguous range of elements (using the flattened CODA element index of the dataset).
+ */
+typedef struct coda_hdf4_cache_struct
+{
+    uint8_t *buffer;
+    long buffer_size;   /* allocated size of buffer in bytes */
+    long start_index;   /* flattened index of the first element in the cache */
+    long num_elements;  /* number of elements in the cache (0 if the cache is empty) */
+} coda_hdf4_cache;
+
 /* Inheritance tree:
  * coda_dynamic_type
  * \ -- coda_hdf4_type
@@ -133,6 +149,7 @@ typedef struct coda_hdf4_GRImage_struct
     int32 dim_sizes[2];
     coda_hdf4_type *basic_type;
     coda_hdf4_attributes *attributes;
+    coda_hdf4_cache cache;
 } coda_hdf4_GRImage;
 
 typedef struct coda_hdf4_SDS_struct
@@ -150,6 +167,7 @@ typedef struct coda_hdf4_SDS_struct
     int32 data_type;
     coda_hdf4_type *basic_type;
     coda_hdf4_attributes *attributes;
+    coda_hdf4_cache cache;
 } coda_hdf4_SDS;
 
 typedef struct coda_hdf4_Vdata_struct
@@ -179,6 +197,7 @@ typedef struct coda_hdf4_Vdata_field_struct
     int32 data_type;
     coda_hdf4_type *basic_type;
     coda_hdf4_attributes *attributes;
+    coda_hdf4_cache cache;
 } coda_hdf4_Vdata_field;
 
 typedef struct coda_hdf4_Vgroup_struct
@@ -231,6 +250,10 @@ struct coda_hdf4_product_struct
 
     int32 num_vdata;
     coda_hdf4_Vdata **vdata;
+
+    /* datasets that currently have a filled read-ahead cache (used as round-robin eviction list) */
+    coda_hdf4_cache *cached_dataset[HDF4_MAX_CACHED_DATASETS];
+    int next_cache_slot;
 };
 typedef struct coda_hdf4_product_struct coda_hdf4_product;
 
@@ -84,6 +84,10 @@ void coda_hdf4_type_delete(coda_dynamic_type *type)
         case tag_hdf4_GRImage:
             coda_dynamic_type_delete((coda_dynamic_type *)((coda_hdf4_GRImage *)type)->basic_type);
             coda_dynamic_type_delete((coda_dynamic_type *)((coda_hdf4_GRImage *)type)->attributes);
+            if (((coda_hdf4_GRImage *)type)->cache.buffer != NULL)
+            {
+                free(((coda_hdf4_GRImage *)type)->cache.buffer);
+            }
             if (((coda_hdf4_GRImage *)type)->ri_id != -1)
             {
                 GRendaccess(((coda_hdf4_GRImage *)type)->ri_id);
@@ -92,6 +96,10 @@ void coda_hdf4_type_delete(coda_dynamic_type *type)
         case tag_hdf4_SDS:
             coda_dynamic_type_delete((coda_dynamic_type *)((coda_hdf4_SDS *)type)->basic_type);
             coda_dynamic_type_delete((coda_dynamic_type *)((coda_hdf4_SDS *)type)->attributes);
+            if (((coda_hdf4_SDS *)type)->cache.buffer != NULL)
+            {
+                free(((coda_hdf4_SDS *)type)->cache.buffer);
+            }
             if (((coda_hdf4_SDS *)type)->sds_id != -1)
             {
                 SDendaccess(((coda_hdf4_SDS *)type)->sds_id);
@@ -115,6 +123,10 @@ void coda_hdf4_type_delete(coda_dynamic_type *type)
         case tag_hdf4_Vdata_field:
             coda_dynamic_type_delete((coda_dynamic_type *)((coda_hdf4_Vdata_field *)type)->basic_type);
             coda_dynamic_type_delete((coda_dynamic_type *)((coda_hdf4_Vdata_field *)type)->attributes);
+            if (((coda_hdf4_Vdata_field *)type)->cache.buffer != NULL)
+            {
+                free(((coda_hdf4_Vdata_field *)type)->cache.buffer);
+            }
             break;
         case tag_hdf4_Vgroup:
             if (((coda_hdf4_Vgroup *)type)->entry != NULL)
@@ -1360,6 +1372,10 @@ coda_hdf4_GRImage *coda_hdf4_GRImage_new(coda_hdf4_product *product, int32 index
     type->index = index;
     type->basic_type = NULL;
     type->attributes = NULL;
+    type->cache.buffer = NULL;
+    type->cache.buffer_size = 0;
+    type->cache.start_index = 0;
+    type->cache.num_elements = 0;
 
     type->definition = coda_type_array_new(coda_format_hdf4);
     if (type->definition == NULL)
@@ -1476,6 +1492,10 @@ coda_hdf4_SDS *coda_hdf4_SDS_new(coda_hdf4_product *product, int32 sds_index)
     type->index = sds_index;
     type->basic_type = NULL;
     type->attributes = NULL;
+    type->cache.buffer = NULL;
+    type->cache.buffer_size = 0;
+    type->cache.start_index = 0;
+    type->cache.num_elements = 0;
 
     type->definition = coda_type_array_new(product->format);
     if (type->definition == NULL)
@@ -1573,6 +1593,10 @@ static coda_hdf4_Vdata_field *Vdata_field_new(coda_hdf4_product *product, int32
     type->tag = tag_hdf4_Vdata_field;
     type->basic_type = NULL;
     type->attributes = NULL;
+    type->cache.buffer = NULL;
+    type->cache.buffer_size = 0;
+    type->cache.start_index = 0;
+    type->cache.num_elements = 0;
 
     type->definition = coda_type_array_new(product->format);
     if (type->definition == NULL)
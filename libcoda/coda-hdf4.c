@@ -450,6 +450,7 @@ int coda_hdf4_close(coda_product *product)
 int coda_hdf4_reopen(coda_product **product)
 {
     coda_hdf4_product *product_file;
+    int i;
 
     product_file = (coda_hdf4_product *)malloc(sizeof(coda_hdf4_product));
     if (product_file == NULL)
@@ -483,6 +484,11 @@ int coda_hdf4_reopen(coda_product **product)
     product_file->vgroup = NULL;
     product_file->num_vdata = 0;
     product_file->vdata = NULL;
+    for (i = 0; i < HDF4_MAX_CACHED_DATASETS; i++)
+    {
+        product_file->cached_dataset[i] = NULL;
+    }
+    product_file->next_cache_slot = 0;
 
     product_file->filename = strdup((*product)->filename);
     if (product_file->filename == NULL)
@@ -45,8 +45,8 @@ int coda_hdf4_cursor_set_product(coda_cursor *cursor, coda_product *product);
 int coda_hdf4_cursor_goto_record_field_by_index(coda_cursor *cursor, long index);
 int coda_hdf4_cursor_goto_next_record_field(coda_cursor *cursor);
 int coda_hdf4_cursor_goto_array_element(coda_cursor *cursor, int num_subs, const long subs[]);
-int coda_hdf4_cursor_goto_array_element_by_index(coda_cursor *cursor, long index);
-int coda_hdf4_cursor_goto_next_array_element(coda_cursor *cursor);
+int coda_hdf4_cursor_goto_array_element_by_index(coda_cursor *cursor, long index, int perform_boundary_checks);
+int coda_hdf4_cursor_goto_next_array_element(coda_cursor *cursor, int perform_boundary_checks);
 int coda_hdf4_cursor_goto_attributes(coda_cursor *cursor);
 int coda_hdf4_cursor_get_string_length(const coda_cursor *cursor, long *length);
 int coda_hdf4_cursor_get_num_elements(const coda_cursor *cursor, long *num_elements);
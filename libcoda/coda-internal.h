@@ -46,6 +46,17 @@
 /* This defines the amount of items that will be allocated per block for an auto-growing array (using realloc) */
 #define BLOCK_SIZE 16
 
+/* Storage class for variables that need a separate instance per thread */
+#ifndef THREAD_LOCAL
+#if defined(_MSC_VER)
+#define THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define THREAD_LOCAL _Thread_local
+#else
+#define THREAD_LOCAL __thread
+#endif
+#endif
+
 #define bit_size_to_byte_size(x) (((x) >> 3) + ((((uint8_t)(x)) & 0x7) != 0))
 
 /* Make sure this define is set to the last enum value of coda_format */
@@ -106,6 +117,9 @@ extern int coda_option_bypass_special_types;
 extern int coda_option_perform_boundary_checks;
 extern int coda_option_perform_conversions;
 extern int coda_option_read_all_definitions;
+extern int coda_option_read_cache_block_size;
+extern int coda_option_read_cache_num_blocks;
+extern int coda_option_product_cache_size;
 extern int coda_option_use_fast_size_expressions;
 extern int coda_option_use_mmap;
 
@@ -117,6 +131,9 @@ void coda_add_error_message_vargs(const char *message, va_list ap);
 void coda_set_error_message_vargs(const char *message, va_list ap);
 void coda_cursor_add_to_error_message(const coda_cursor *cursor);
 
+void coda_product_cache_trim(void);
+void coda_product_cache_done(void);
+
 int coda_data_dictionary_init(void);
 void coda_data_dictionary_done(void);
 int coda_read_definitions(const char *path);
@@ -130,10 +147,18 @@ LIBCODA_API int coda_type_get_record_field_index_from_name_n(const coda_type *ty
                                                              long *index);
 
 int coda_cursor_compare(const coda_cursor *cursor1, const coda_cursor *cursor2);
+int coda_cursor_read_unconverted_int64(const coda_cursor *cursor, int64_t *dst);
+int coda_cursor_read_unconverted_double(const coda_cursor *cursor, double *dst);
+int coda_cursor_goto_first_array_element_unchecked(coda_cursor *cursor);
+int coda_cursor_goto_next_array_element_unchecked(coda_cursor *cursor);
+int coda_cursor_get_bit_size_with_fast_size_option(const coda_cursor *cursor, int use_fast_size_expressions,
+                                                   int64_t *bit_size);
+int coda_cursor_use_fast_size_expressions(void);
 
 int coda_expression_print_html(const coda_expression *expr, int (*print) (const char *, ...));
 int coda_expression_print_xml(const coda_expression *expr, int (*print) (const char *, ...));
 
+const char *coda_get_base_filename(const char *filepath);
 int coda_product_variable_get_size(coda_product *product, const char *name, long *size);
 int coda_product_variable_get_pointer(coda_product *product, const char *name, long i, int64_t **ptr);
 
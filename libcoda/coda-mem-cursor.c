@@ -170,14 +170,14 @@ int coda_mem_cursor_goto_array_element(coda_cursor *cursor, int num_subs, const
     return coda_ascbin_cursor_goto_array_element(cursor, num_subs, subs);
 }
 
-int coda_mem_cursor_goto_array_element_by_index(coda_cursor *cursor, long index)
+int coda_mem_cursor_goto_array_element_by_index(coda_cursor *cursor, long index, int perform_boundary_checks)
 {
     coda_mem_type *type = (coda_mem_type *)cursor->stack[cursor->n - 1].type;
 
     if (type->tag == tag_mem_array)
     {
         /* check the range for index */
-        if (coda_option_perform_boundary_checks)
+        if (perform_boundary_checks)
         {
             if (index < 0 || index >= ((coda_mem_array *)type)->num_elements)
             {
@@ -195,10 +195,10 @@ int coda_mem_cursor_goto_array_element_by_index(coda_cursor *cursor, long index)
     }
 
     assert(type->tag == tag_mem_data);
-    return coda_ascbin_cursor_goto_array_element_by_index(cursor, index);
+    return coda_ascbin_cursor_goto_array_element_by_index(cursor, index, perform_boundary_checks);
 }
 
-int coda_mem_cursor_goto_next_array_element(coda_cursor *cursor)
+int coda_mem_cursor_goto_next_array_element(coda_cursor *cursor, int perform_boundary_checks)
 {
     coda_mem_type *type = (coda_mem_type *)cursor->stack[cursor->n - 2].type;
 
@@ -227,7 +227,7 @@ int coda_mem_cursor_goto_next_array_element(coda_cursor *cursor)
     }
 
     assert(type->tag == tag_mem_data);
-    return coda_ascbin_cursor_goto_next_array_element(cursor);
+    return coda_ascbin_cursor_goto_next_array_element(cursor, perform_boundary_checks);
 }
 
 int coda_mem_cursor_goto_attributes(coda_cursor *cursor)
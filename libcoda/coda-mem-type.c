@@ -746,6 +746,24 @@ int coda_mem_array_validate(coda_mem_array *type)
     return 0;
 }
 
+/* the allocated size of mem_ptr is derived from mem_size: we use the smallest power of two number of blocks that
+ * can hold mem_size bytes, such that the amount of reallocations stays small for products with lots of data
+ */
+static long get_num_data_blocks(int64_t size)
+{
+    long num_blocks = 1;
+
+    if (size == 0)
+    {
+        return 0;
+    }
+    while (num_blocks * (int64_t)DATA_BLOCK_SIZE < size)
+    {
+        num_blocks <<= 1;
+    }
+    return num_blocks;
+}
+
 coda_mem_data *coda_mem_data_new(coda_type *definition, coda_dynamic_type *attributes, coda_product *product,
                                  long length, const uint8_t *data)
 {
@@ -806,10 +824,8 @@ coda_mem_data *coda_mem_data_new(coda_type *definition, coda_dynamic_type *attri
             coda_mem_type_delete((coda_dynamic_type *)type);
             return NULL;
         }
-        /* num_blocks = ((mem_size - 1) / block_size) + 1, since we need to round up */
-        current_num_blocks = (long)(product->mem_size == 0 ? 0 : ((product->mem_size - 1) / DATA_BLOCK_SIZE) + 1);
-        new_num_blocks =
-            (long)(length == 0 ? current_num_blocks : ((product->mem_size + length - 1) / DATA_BLOCK_SIZE) + 1);
+        current_num_blocks = get_num_data_blocks(product->mem_size);
+        new_num_blocks = get_num_data_blocks(product->mem_size + length);
         if (new_num_blocks > current_num_blocks)
         {
             uint8_t *new_mem_ptr;
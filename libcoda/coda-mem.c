@@ -66,6 +66,36 @@ coda_dynamic_type *coda_no_data_singleton(coda_format format)
     return (coda_dynamic_type *)no_data_singleton[format];
 }
 
+/* create all singletons up front so cursor navigation does not need to modify global state */
+int coda_mem_init(void)
+{
+    int i;
+
+    for (i = 0; i <= coda_format_sp3; i++)
+    {
+        if (empty_record_singleton[i] == NULL)
+        {
+            empty_record_singleton[i] = coda_mem_record_new(coda_type_empty_record(i), NULL);
+            if (empty_record_singleton[i] == NULL)
+            {
+                coda_mem_done();
+                return -1;
+            }
+        }
+        if (no_data_singleton[i] == NULL)
+        {
+            no_data_singleton[i] = coda_mem_no_data_new(i);
+            if (no_data_singleton[i] == NULL)
+            {
+                coda_mem_done();
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
 void coda_mem_done(void)
 {
     int i;
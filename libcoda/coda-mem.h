@@ -34,6 +34,7 @@
 
 #include "coda-internal.h"
 
+int coda_mem_init(void);
 void coda_mem_done(void);
 
 void coda_mem_type_delete(coda_dynamic_type *type);
@@ -44,8 +45,8 @@ int coda_mem_cursor_goto_record_field_by_index(coda_cursor *cursor, long index);
 int coda_mem_cursor_goto_next_record_field(coda_cursor *cursor);
 int coda_mem_cursor_goto_available_union_field(coda_cursor *cursor);
 int coda_mem_cursor_goto_array_element(coda_cursor *cursor, int num_subs, const long subs[]);
-int coda_mem_cursor_goto_array_element_by_index(coda_cursor *cursor, long index);
-int coda_mem_cursor_goto_next_array_element(coda_cursor *cursor);
+int coda_mem_cursor_goto_array_element_by_index(coda_cursor *cursor, long index, int perform_boundary_checks);
+int coda_mem_cursor_goto_next_array_element(coda_cursor *cursor, int perform_boundary_checks);
 int coda_mem_cursor_goto_attributes(coda_cursor *cursor);
 int coda_mem_cursor_use_base_type_of_special_type(coda_cursor *cursor);
 int coda_mem_cursor_get_string_length(const coda_cursor *cursor, long *length);
@@ -106,12 +106,12 @@ int coda_netcdf_cursor_goto_array_element(coda_cursor *cursor, int num_subs, con
     return 0;
 }
 
-int coda_netcdf_cursor_goto_array_element_by_index(coda_cursor *cursor, long index)
+int coda_netcdf_cursor_goto_array_element_by_index(coda_cursor *cursor, long index, int perform_boundary_checks)
 {
     coda_dynamic_type *base_type;
 
     /* check the range for index */
-    if (coda_option_perform_boundary_checks)
+    if (perform_boundary_checks)
     {
         long num_elements;
 
@@ -134,9 +134,9 @@ int coda_netcdf_cursor_goto_array_element_by_index(coda_cursor *cursor, long ind
     return 0;
 }
 
-int coda_netcdf_cursor_goto_next_array_element(coda_cursor *cursor)
+int coda_netcdf_cursor_goto_next_array_element(coda_cursor *cursor, int perform_boundary_checks)
 {
-    if (coda_option_perform_boundary_checks)
+    if (perform_boundary_checks)
     {
         long num_elements;
         long index;
@@ -228,6 +228,10 @@ static int read_array(const coda_cursor *cursor, void *dst)
     }
     else
     {
+        if (block_size >= CODA_BIN_PREFETCH_MIN_SIZE)
+        {
+            coda_bin_product_prefetch((coda_bin_product *)product->raw_product, type->base_type->offset, block_size);
+        }
         if (read_bytes(product->raw_product, type->base_type->offset, block_size, (uint8_t *)dst) != 0)
         {
             return -1;
@@ -326,19 +330,19 @@ static int read_partial_array(const coda_cursor *cursor, long offset, long lengt
             /* no endianness conversion needed */
             break;
         case 16:
-            for (i = 0; i < type->definition->num_elements; i++)
+            for (i = 0; i < length; i++)
             {
                 swap2(&((int16_t *)dst)[i]);
             }
             break;
         case 32:
-            for (i = 0; i < type->definition->num_elements; i++)
+            for (i = 0; i < length; i++)
             {
                 swap4(&((int32_t *)dst)[i]);
             }
             break;
         case 64:
-            for (i = 0; i < type->definition->num_elements; i++)
+            for (i = 0; i < length; i++)
             {
                 swap8(&((int64_t *)dst)[i]);
             }
@@ -49,12 +49,13 @@
 #endif
 
 #include "coda-ascbin.h"
-#include "coda-ascii.h"
-#include "coda-bin.h"
-#include "coda-cdf.h"
-#include "coda-xml.h"
-#include "coda-netcdf.h"
-#include "coda-grib.h"
+#include "coda-ascii-internal.h"
+#include "coda-bin-internal.h"
+#include "coda-read-bytes.h"
+#include "coda-cdf-internal.h"
+#include "coda-xml-internal.h"
+#include "coda-netcdf-internal.h"
+#include "coda-grib-internal.h"
 #ifdef HAVE_HDF4
 #include "coda-hdf4.h"
 #endif
@@ -95,6 +96,12 @@
  * If it is an HDF4 or HDF5 file it will use the HDF4/HDF5 backends for further access. In all other cases CODA will
  * consult the data dictionary to determine whether there is a product definition for that file in one of the available
  * product classes.
+ * Product files that are gzip compressed are decompressed transparently (this is not supported for HDF4 and HDF5
+ * files). The file size and all offsets that CODA reports for such products refer to the decompressed data.
+ * A file inside a zip file (such as a SAFE product that is delivered as .zip) can be opened without extracting it by
+ * passing a filename of the form 'archive.zip#path/inside/archive' to coda_open(). Stored entries are accessed
+ * directly from the zip file and compressed entries are decompressed transparently (this is also not supported for
+ * HDF4 and HDF5 files).
  *
  * Within CODA a product class is a grouping of related product types. Usually all data products for a single satellite
  * mission belong to the same product class. Within a product class there can be several product types and each product
@@ -155,6 +162,27 @@
 
 #define DETECTION_BLOCK_SIZE 80
 
+/* returns the 'bin' product that is used to read the data of the product from file (or NULL if there is none) */
+static coda_product *get_raw_product(const coda_product *product)
+{
+    switch (product->format)
+    {
+        case coda_format_ascii:
+        case coda_format_binary:
+            return (coda_product *)product;
+        case coda_format_cdf:
+            return ((const coda_cdf_product *)product)->raw_product;
+        case coda_format_netcdf:
+            return ((const coda_netcdf_product *)product)->raw_product;
+        case coda_format_grib:
+            return ((const coda_grib_product *)product)->raw_product;
+        default:
+            break;
+    }
+
+    return NULL;
+}
+
 static int get_file_size(const char *filename, int64_t *file_size)
 {
     struct stat statbuf;
@@ -355,6 +383,31 @@ static int reopen_with_backend(coda_product **product_file, coda_format format)
      * this will be changed to whatever product file that is applicable for the backend for the format
      * the coda_<backend>_reopen functions are responsible for closing the input raw product (even when errors occur)
      */
+    if (format == coda_format_hdf4 || format == coda_format_hdf5)
+    {
+        /* the HDF4 and HDF5 libraries access the file directly */
+        if (((coda_bin_product *)*product_file)->file_offset > 0)
+        {
+            coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "opening %s products from a zip file is not supported (%s)",
+                           coda_type_get_format_name(format), (*product_file)->filename);
+            coda_close(*product_file);
+            return -1;
+        }
+        if (((coda_bin_product *)*product_file)->is_compressed)
+        {
+            coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "compressed %s files are not supported (%s)",
+                           coda_type_get_format_name(format), (*product_file)->filename);
+            coda_close(*product_file);
+            return -1;
+        }
+        if (((coda_bin_product *)*product_file)->is_memory_buffer)
+        {
+            coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "opening %s products from memory is not supported",
+                           coda_type_get_format_name(format));
+            coda_close(*product_file);
+            return -1;
+        }
+    }
     switch (format)
     {
         case coda_format_ascii:
@@ -427,6 +480,63 @@ static int reopen_with_backend(coda_product **product_file, coda_format format)
     return 0;
 }
 
+/* allocate the (initially empty) product variable information of the product */
+static int init_product_variables(coda_product *product)
+{
+    if (product->product_definition != NULL && product->product_definition->num_product_variables > 0)
+    {
+        int num_product_variables;
+        int i;
+
+        num_product_variables = product->product_definition->num_product_variables;
+        product->product_variable_size = malloc(num_product_variables * sizeof(long *));
+        if (product->product_variable_size == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           num_product_variables * sizeof(long *), __FILE__, __LINE__);
+            return -1;
+        }
+        product->product_variable = malloc(num_product_variables * sizeof(int64_t **));
+        if (product->product_variable == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           num_product_variables * sizeof(int64_t **), __FILE__, __LINE__);
+            return -1;
+        }
+
+        for (i = 0; i < num_product_variables; i++)
+        {
+            product->product_variable[i] = NULL;
+        }
+    }
+
+    return 0;
+}
+
+/* release the product variable information of the product */
+static void delete_product_variables(coda_product *product)
+{
+    if (product->product_variable_size != NULL)
+    {
+        free(product->product_variable_size);
+        product->product_variable_size = NULL;
+    }
+    if (product->product_variable != NULL)
+    {
+        int i;
+
+        for (i = 0; i < product->product_definition->num_product_variables; i++)
+        {
+            if (product->product_variable[i] != NULL)
+            {
+                free(product->product_variable[i]);
+            }
+        }
+        free(product->product_variable);
+        product->product_variable = NULL;
+    }
+}
+
 static int set_definition(coda_product **product, coda_product_definition *definition)
 {
     if (definition == NULL)
@@ -486,32 +596,87 @@ static int set_definition(coda_product **product, coda_product_definition *defin
             break;
     }
 
-    /* initialize product variables */
-    if ((*product)->product_definition->num_product_variables > 0)
-    {
-        int num_product_variables;
-        int i;
+    return init_product_variables(*product);
+}
+
+/* determine the format of a raw product and reopen it with the backend for that format */
+static int open_raw_product(coda_product *product, coda_product **product_file, int force_binary)
+{
+    coda_format format;
 
-        num_product_variables = (*product)->product_definition->num_product_variables;
-        (*product)->product_variable_size = malloc(num_product_variables * sizeof(long *));
-        if ((*product)->product_variable_size == NULL)
+    if (force_binary)
+    {
+        format = coda_format_binary;
+    }
+    else
+    {
+        if (get_format(product, &format) != 0)
         {
-            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
-                           num_product_variables * sizeof(long *), __FILE__, __LINE__);
+            coda_close(product);
             return -1;
         }
-        (*product)->product_variable = malloc(num_product_variables * sizeof(int64_t **));
-        if ((*product)->product_variable == NULL)
+    }
+
+    if (reopen_with_backend(&product, format) != 0)
+    {
+        /* no need to close 'product' as this should already have been done by the backend */
+        return -1;
+    }
+
+    *product_file = product;
+
+    return 0;
+}
+
+/* return the part of 'filepath' that is the name of the file without its directory
+ * for an entry of a zip file ('archive.zip#path/in/archive') this is the name of the entry without its directory
+ */
+const char *coda_get_base_filename(const char *filepath)
+{
+    const char *filename = filepath;
+
+    while (*filepath != '\0')
+    {
+        if (*filepath == '/' || *filepath == '#')
+        {
+            filename = &filepath[1];
+        }
+        filepath++;
+    }
+
+    return filename;
+}
+
+/* check whether 'filename' has the form <archive>#<entry>, with <archive> an existing file
+ * archive_filename will be set to NULL if this is not the case
+ */
+static int get_archive_filename(const char *filename, char **archive_filename)
+{
+    const char *separator;
+
+    *archive_filename = NULL;
+    separator = strchr(filename, '#');
+    while (separator != NULL && separator[1] != '\0')
+    {
+        struct stat statbuf;
+        char *name;
+
+        name = malloc(separator - filename + 1);
+        if (name == NULL)
         {
             coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
-                           num_product_variables * sizeof(int64_t **), __FILE__, __LINE__);
+                           (long)(separator - filename + 1), __FILE__, __LINE__);
             return -1;
         }
-
-        for (i = 0; i < num_product_variables; i++)
+        memcpy(name, filename, separator - filename);
+        name[separator - filename] = '\0';
+        if (stat(name, &statbuf) == 0 && (statbuf.st_mode & S_IFREG) != 0)
         {
-            (*product)->product_variable[i] = NULL;
+            *archive_filename = name;
+            return 0;
         }
+        free(name);
+        separator = strchr(separator + 1, '#');
     }
 
     return 0;
@@ -521,41 +686,35 @@ static int open_file(const char *filename, coda_product **product_file, int forc
 {
     coda_product *product;
     int64_t file_size;
-    coda_format format;
 
     if (get_file_size(filename, &file_size) != 0)
     {
-        return -1;
-    }
-
-    /* we open the file as a 'raw file' which maps the whole file as a single binary raw data block */
-    if (coda_bin_open(filename, file_size, &product) != 0)
-    {
-        return -1;
-    }
+        char *archive_filename;
+        int result;
 
-    if (force_binary)
-    {
-        format = coda_format_binary;
-    }
-    else
-    {
-        if (get_format(product, &format) != 0)
+        /* check whether the file refers to an entry inside a zip file ('archive.zip#path/in/archive') */
+        if (get_archive_filename(filename, &archive_filename) != 0 || archive_filename == NULL)
+        {
+            return -1;
+        }
+        result = coda_bin_open_archive_entry(filename, archive_filename, &filename[strlen(archive_filename) + 1],
+                                             &product);
+        free(archive_filename);
+        if (result != 0)
         {
-            coda_close(product);
             return -1;
         }
+
+        return open_raw_product(product, product_file, force_binary);
     }
 
-    if (reopen_with_backend(&product, format) != 0)
+    /* we open the file as a 'raw file' which maps the whole file as a single binary raw data block */
+    if (coda_bin_open(filename, file_size, &product) != 0)
     {
-        /* no need to close 'product' as this should already have been done by the backend */
         return -1;
     }
 
-    *product_file = product;
-
-    return 0;
+    return open_raw_product(product, product_file, force_binary);
 }
 
 
@@ -649,88 +808,619 @@ LIBCODA_API int coda_recognize_file(const char *filename, int64_t *file_size, co
     return 0;
 }
 
-/** Open a product file for reading.
- * This function will try to open the specified file for reading. On success a newly allocated file handle will be
- * returned. The memory for this file handle will be released when coda_close() is called for this handle.
- * \param filename Relative or full path to the product file.
- * \param product Pointer to the variable where the pointer to the product file handle will be storeed.
- * \return
- *   \arg \c 0, Success.
- *   \arg \c -1, Error occurred (check #coda_errno).
+/* product cache
+ * The cache keeps products open after their last coda_close() such that opening the same file again does not require
+ * the product to be parsed again. The cached product itself is never handed out to the user. Each coda_open() instead
+ * returns a separate handle for the product (see product_handle_new()).
  */
-LIBCODA_API int coda_open(const char *filename, coda_product **product)
+typedef struct product_cache_entry_struct
 {
-    coda_product_definition *definition = NULL;
-    coda_product *product_file;
+    coda_product *product;
+    int64_t file_size;
+    int64_t modification_time;
+    int64_t inode;
+    int64_t device;
+    /* options that determine how the file is accessed; a product is only shared between coda_open() calls for which
+     * these options are the same */
+    int use_mmap;
+    int read_cache_block_size;
+    int read_cache_num_blocks;
+    int reference_count;        /* number of handles for the product that are still open */
+    uint64_t last_use;          /* value of product_cache_counter at the moment of the last coda_open() */
+    int is_released;    /* set by coda_done(); the product is closed when its last handle is closed */
+} product_cache_entry;
+
+/* A handle shares everything that does not change after opening the product (definition, type tree, parsed header
+ * information and decompressed data) with the cached product, but has its own file access state (file descriptor,
+ * memory mapping, read cache, gzip decompression state and access pattern) and its own product variables.
+ * Reading via one handle therefore has no effect on reading via another handle for the same file.
+ */
+typedef struct product_handle_struct
+{
+    coda_product *handle;
+    coda_product *product;      /* the cached product that the handle refers to */
+} product_handle;
 
-    if (filename == NULL)
+static product_cache_entry *product_cache = NULL;
+static int product_cache_num_entries = 0;
+static int product_cache_allocated = 0;
+static uint64_t product_cache_counter = 0;
+
+static product_handle *product_handle_list = NULL;
+static int product_handle_num_entries = 0;
+static int product_handle_allocated = 0;
+
+static int close_product(coda_product *product);
+
+static int get_product_cache_key(const char *filename, product_cache_entry *entry)
+{
+    struct stat statbuf;
+
+    if (stat(filename, &statbuf) != 0 || (statbuf.st_mode & S_IFMT) != S_IFREG)
     {
-        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "filename argument is NULL (%s:%u)", __FILE__, __LINE__);
+        /* we only cache regular files (i.e. not entries inside zip files) */
         return -1;
     }
-    if (product == NULL)
+    entry->product = NULL;
+    entry->file_size = (int64_t)statbuf.st_size;
+    entry->modification_time = (int64_t)statbuf.st_mtime;
+    entry->inode = (int64_t)statbuf.st_ino;
+    entry->device = (int64_t)statbuf.st_dev;
+    entry->use_mmap = coda_option_use_mmap;
+    entry->read_cache_block_size = coda_option_read_cache_block_size;
+    entry->read_cache_num_blocks = coda_option_read_cache_num_blocks;
+    entry->reference_count = 0;
+    entry->last_use = 0;
+    entry->is_released = 0;
+
+    return 0;
+}
+
+/* returns whether separate handles can be created for the product (see product_handle_new()) */
+static int is_cacheable_product(const coda_product *product)
+{
+    switch (product->format)
     {
-        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product argument is NULL (%s:%u)", __FILE__, __LINE__);
-        return -1;
+        case coda_format_ascii:
+        case coda_format_binary:
+        case coda_format_xml:
+        case coda_format_cdf:
+        case coda_format_netcdf:
+        case coda_format_grib:
+        case coda_format_rinex:
+        case coda_format_sp3:
+            return 1;
+        case coda_format_hdf4:
+        case coda_format_hdf5:
+            /* the file access state is kept inside the HDF library */
+            break;
     }
 
-    if (open_file(filename, &product_file, 0) != 0)
+    return 0;
+}
+
+/* returns the location of the raw product of the product (or NULL if the product has no separate raw product) */
+static coda_product **get_raw_product_location(coda_product *product)
+{
+    switch (product->format)
     {
-        return -1;
+        case coda_format_xml:
+            return &((coda_xml_product *)product)->raw_product;
+        case coda_format_cdf:
+            return &((coda_cdf_product *)product)->raw_product;
+        case coda_format_netcdf:
+            return &((coda_netcdf_product *)product)->raw_product;
+        case coda_format_grib:
+            return &((coda_grib_product *)product)->raw_product;
+        default:
+            break;
     }
-    if (coda_data_dictionary_find_definition_for_product(product_file, &definition) != 0)
+
+    return NULL;
+}
+
+/* create a copy of the product structure in which all fields that the handle owns itself are reset */
+static coda_product *product_handle_alloc(const coda_product *product, size_t size)
+{
+    coda_product *handle;
+
+    handle = (coda_product *)malloc(size);
+    if (handle == NULL)
     {
-        coda_close(product_file);
-        return -1;
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)", (long)size,
+                       __FILE__, __LINE__);
+        return NULL;
     }
-    if (set_definition(&product_file, definition) != 0)
+    memcpy(handle, product, size);
+    handle->product_variable_size = NULL;
+    handle->product_variable = NULL;
+    handle->filename = strdup(product->filename);
+    if (handle->filename == NULL)
     {
-        coda_close(product_file);
-        return -1;
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not duplicate filename string) (%s:%u)",
+                       __FILE__, __LINE__);
+        free(handle);
+        return NULL;
     }
 
-    *product = product_file;
-
-    return 0;
+    return handle;
 }
 
-/** Open a product file for reading using a specific format definition.
- * This function will try to open the specified file for reading similar to coda_open(), but instead of trying to
- * automatically recognise the applicable product class/type/version as coda_open() does, this function will impose
- * the format definition that is associated with the given \a product_class, \a product_type, and \a version parameters.
- * \param filename Relative or full path to the product file.
- * \param product_class Name of the product class for the requested format definition.
- * \param product_type Name of the product type for the requested format definition.
- * \param version Format version number of the product type definition. Use -1 to request the latest available definition.
- * \param product Pointer to the variable where the pointer to the product file handle will be storeed.
- * \return
- *   \arg \c 0, Success.
- *   \arg \c -1, Error occurred (check #coda_errno).
- */
-LIBCODA_API int coda_open_as(const char *filename, const char *product_class, const char *product_type, int version,
-                             coda_product **product)
+/* close a handle that was created with product_handle_new() (this leaves the shared data of the product alone) */
+static int product_handle_close(coda_product *handle)
 {
-    coda_product_definition *definition = NULL;
-    coda_product *product_file;
-    int open_as_binary = 0;
+    coda_product **raw_product;
+    int result = 0;
 
-    if (filename == NULL)
+    delete_product_variables(handle);
+
+    switch (handle->format)
     {
-        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "filename argument is NULL (%s:%u)", __FILE__, __LINE__);
-        return -1;
+        case coda_format_ascii:
+            return coda_ascii_close(handle);
+        case coda_format_binary:
+            return coda_bin_close(handle);
+        default:
+            break;
     }
-    if (product_class != NULL)
+
+    raw_product = get_raw_product_location(handle);
+    if (raw_product != NULL && *raw_product != NULL)
     {
-        if (product_type == NULL)
-        {
-            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product_type argument is NULL (%s:%u)", __FILE__, __LINE__);
-            return -1;
-        }
-        if (product == NULL)
-        {
-            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product argument is NULL (%s:%u)", __FILE__, __LINE__);
-            return -1;
-        }
+        result = coda_bin_close(*raw_product);
+    }
+    free(handle->filename);
+    free(handle);
+
+    return result;
+}
+
+/* create a new handle for a cached product */
+static int product_handle_new(coda_product *product, coda_product **handle)
+{
+    coda_product **raw_product;
+    coda_product *handle_file;
+
+    switch (product->format)
+    {
+        case coda_format_ascii:
+            handle_file = product_handle_alloc(product, sizeof(coda_ascii_product));
+            if (handle_file == NULL)
+            {
+                return -1;
+            }
+            /* the line information is determined on first use */
+            ((coda_ascii_product *)handle_file)->end_of_line = eol_unknown;
+            ((coda_ascii_product *)handle_file)->num_asciilines = -1;
+            ((coda_ascii_product *)handle_file)->asciiline_end_offset = NULL;
+            ((coda_ascii_product *)handle_file)->lastline_ending = eol_unknown;
+            ((coda_ascii_product *)handle_file)->asciilines = NULL;
+            break;
+        case coda_format_binary:
+            handle_file = product_handle_alloc(product, sizeof(coda_bin_product));
+            break;
+        case coda_format_xml:
+            handle_file = product_handle_alloc(product, sizeof(coda_xml_product));
+            break;
+        case coda_format_cdf:
+            handle_file = product_handle_alloc(product, sizeof(coda_cdf_product));
+            break;
+        case coda_format_netcdf:
+            handle_file = product_handle_alloc(product, sizeof(coda_netcdf_product));
+            break;
+        case coda_format_grib:
+            handle_file = product_handle_alloc(product, sizeof(coda_grib_product));
+            break;
+        case coda_format_rinex:
+        case coda_format_sp3:
+            handle_file = product_handle_alloc(product, sizeof(coda_product));
+            break;
+        default:
+            assert(0);
+            exit(1);
+    }
+    if (handle_file == NULL)
+    {
+        return -1;
+    }
+
+    if (product->format == coda_format_ascii || product->format == coda_format_binary)
+    {
+        if (coda_bin_product_open_handle((coda_bin_product *)product, (coda_bin_product *)handle_file) != 0)
+        {
+            product_handle_close(handle_file);
+            return -1;
+        }
+    }
+    else
+    {
+        raw_product = get_raw_product_location(handle_file);
+        if (raw_product != NULL && *raw_product != NULL)
+        {
+            coda_product *raw_handle;
+
+            raw_handle = product_handle_alloc(*raw_product, sizeof(coda_bin_product));
+            *raw_product = NULL;
+            if (raw_handle == NULL)
+            {
+                product_handle_close(handle_file);
+                return -1;
+            }
+            if (coda_bin_product_open_handle(*(coda_bin_product **)get_raw_product_location(product),
+                                             (coda_bin_product *)raw_handle) != 0)
+            {
+                coda_bin_close(raw_handle);
+                product_handle_close(handle_file);
+                return -1;
+            }
+            *raw_product = raw_handle;
+        }
+    }
+    if (init_product_variables(handle_file) != 0)
+    {
+        product_handle_close(handle_file);
+        return -1;
+    }
+
+    if (product_handle_num_entries == product_handle_allocated)
+    {
+        product_handle *new_product_handle_list;
+
+        new_product_handle_list = realloc(product_handle_list,
+                                          (product_handle_allocated + 8) * sizeof(product_handle));
+        if (new_product_handle_list == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)((product_handle_allocated + 8) * sizeof(product_handle)), __FILE__, __LINE__);
+            product_handle_close(handle_file);
+            return -1;
+        }
+        product_handle_list = new_product_handle_list;
+        product_handle_allocated += 8;
+    }
+    product_handle_list[product_handle_num_entries].handle = handle_file;
+    product_handle_list[product_handle_num_entries].product = product;
+    product_handle_num_entries++;
+
+    *handle = handle_file;
+
+    return 0;
+}
+
+static int product_handle_find(coda_product *handle)
+{
+    int i;
+
+    for (i = 0; i < product_handle_num_entries; i++)
+    {
+        if (product_handle_list[i].handle == handle)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static int product_cache_find(coda_product *product)
+{
+    int i;
+
+    for (i = 0; i < product_cache_num_entries; i++)
+    {
+        if (product_cache[i].product == product)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static int product_cache_remove(int index)
+{
+    coda_product *product = product_cache[index].product;
+
+    product_cache_num_entries--;
+    if (index < product_cache_num_entries)
+    {
+        product_cache[index] = product_cache[product_cache_num_entries];
+    }
+
+    return close_product(product);
+}
+
+/* remove the least recently used entry that is no longer referenced; returns 0 if there was no such entry */
+static int product_cache_remove_least_recently_used(void)
+{
+    int index = -1;
+    int i;
+
+    for (i = 0; i < product_cache_num_entries; i++)
+    {
+        if (product_cache[i].reference_count == 0 &&
+            (index == -1 || product_cache[i].last_use < product_cache[index].last_use))
+        {
+            index = i;
+        }
+    }
+    if (index == -1)
+    {
+        return 0;
+    }
+    product_cache_remove(index);
+
+    return 1;
+}
+
+/* returns the index of the cache entry for the file (or -1 if the file is not in the cache) */
+static int product_cache_get(const char *filename, const product_cache_entry *key)
+{
+    int i;
+
+    for (i = 0; i < product_cache_num_entries; i++)
+    {
+        if (!product_cache[i].is_released && strcmp(product_cache[i].product->filename, filename) == 0)
+        {
+            if (product_cache[i].file_size == key->file_size &&
+                product_cache[i].modification_time == key->modification_time &&
+                product_cache[i].inode == key->inode && product_cache[i].device == key->device)
+            {
+                if (product_cache[i].use_mmap != key->use_mmap ||
+                    product_cache[i].read_cache_block_size != key->read_cache_block_size ||
+                    product_cache[i].read_cache_num_blocks != key->read_cache_num_blocks)
+                {
+                    /* the product was opened with different access options */
+                    continue;
+                }
+                product_cache[i].last_use = ++product_cache_counter;
+                return i;
+            }
+            if (product_cache[i].reference_count == 0)
+            {
+                /* the file has changed since it was cached */
+                product_cache_remove(i);
+                i--;
+            }
+        }
+    }
+
+    return -1;
+}
+
+/* returns the index of the new cache entry (or -1 if the product could not be added to the cache) */
+static int product_cache_add(coda_product *product, const product_cache_entry *key)
+{
+    if (product_cache_num_entries >= coda_option_product_cache_size)
+    {
+        if (!product_cache_remove_least_recently_used())
+        {
+            /* all cached products are still in use */
+            return -1;
+        }
+    }
+    if (product_cache_num_entries == product_cache_allocated)
+    {
+        product_cache_entry *new_product_cache;
+
+        new_product_cache = realloc(product_cache, (product_cache_allocated + 8) * sizeof(product_cache_entry));
+        if (new_product_cache == NULL)
+        {
+            /* not being able to cache the product is not an error */
+            return -1;
+        }
+        product_cache = new_product_cache;
+        product_cache_allocated += 8;
+    }
+    product_cache[product_cache_num_entries] = *key;
+    product_cache[product_cache_num_entries].product = product;
+    product_cache[product_cache_num_entries].reference_count = 0;
+    product_cache[product_cache_num_entries].last_use = ++product_cache_counter;
+    product_cache_num_entries++;
+
+    return product_cache_num_entries - 1;
+}
+
+/* create a new handle for the product of a cache entry */
+static int product_cache_open_handle(int index, coda_product **product)
+{
+    if (product_handle_new(product_cache[index].product, product) != 0)
+    {
+        return -1;
+    }
+    product_cache[index].reference_count++;
+
+    return 0;
+}
+
+/* close a handle that was returned by product_cache_open_handle() */
+static int product_cache_close_handle(int handle_index)
+{
+    coda_product *handle = product_handle_list[handle_index].handle;
+    int result;
+    int index;
+
+    index = product_cache_find(product_handle_list[handle_index].product);
+    assert(index >= 0);
+
+    product_handle_num_entries--;
+    if (handle_index < product_handle_num_entries)
+    {
+        product_handle_list[handle_index] = product_handle_list[product_handle_num_entries];
+    }
+    result = product_handle_close(handle);
+
+    product_cache[index].reference_count--;
+    if (product_cache[index].reference_count == 0 &&
+        (product_cache[index].is_released || product_cache_num_entries > coda_option_product_cache_size))
+    {
+        if (product_cache_remove(index) != 0)
+        {
+            result = -1;
+        }
+    }
+
+    return result;
+}
+
+/* close cached products that are no longer in use until the cache is within the configured size */
+void coda_product_cache_trim(void)
+{
+    while (product_cache_num_entries > coda_option_product_cache_size)
+    {
+        if (!product_cache_remove_least_recently_used())
+        {
+            break;
+        }
+    }
+}
+
+void coda_product_cache_done(void)
+{
+    int i;
+
+    /* products for which the application still has open handles remain open until their last handle is closed */
+    i = 0;
+    while (i < product_cache_num_entries)
+    {
+        if (product_cache[i].reference_count == 0)
+        {
+            product_cache_remove(i);
+        }
+        else
+        {
+            product_cache[i].is_released = 1;
+            i++;
+        }
+    }
+    if (product_cache_num_entries == 0)
+    {
+        if (product_cache != NULL)
+        {
+            free(product_cache);
+            product_cache = NULL;
+        }
+        product_cache_allocated = 0;
+        product_cache_counter = 0;
+    }
+    if (product_handle_num_entries == 0 && product_handle_list != NULL)
+    {
+        free(product_handle_list);
+        product_handle_list = NULL;
+        product_handle_allocated = 0;
+    }
+}
+
+/** Open a product file for reading.
+ * This function will try to open the specified file for reading. On success a newly allocated file handle will be
+ * returned. The memory for this file handle will be released when coda_close() is called for this handle.
+ * If the product cache is enabled (see coda_set_option_product_cache_size()) and the file is still in the cache, the
+ * returned file handle will reuse the product information of the cached product.
+ * \param filename Relative or full path to the product file.
+ * \param product Pointer to the variable where the pointer to the product file handle will be storeed.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_open(const char *filename, coda_product **product)
+{
+    coda_product_definition *definition = NULL;
+    coda_product *product_file;
+    product_cache_entry cache_key;
+    int use_cache = 0;
+
+    if (filename == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "filename argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (product == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    if (coda_option_product_cache_size > 0 && get_product_cache_key(filename, &cache_key) == 0)
+    {
+        int index;
+
+        use_cache = 1;
+        index = product_cache_get(filename, &cache_key);
+        if (index >= 0)
+        {
+            return product_cache_open_handle(index, product);
+        }
+    }
+
+    if (open_file(filename, &product_file, 0) != 0)
+    {
+        return -1;
+    }
+    if (coda_data_dictionary_find_definition_for_product(product_file, &definition) != 0)
+    {
+        coda_close(product_file);
+        return -1;
+    }
+    if (set_definition(&product_file, definition) != 0)
+    {
+        coda_close(product_file);
+        return -1;
+    }
+
+    if (use_cache && is_cacheable_product(product_file))
+    {
+        int index;
+
+        index = product_cache_add(product_file, &cache_key);
+        if (index >= 0)
+        {
+            /* the cached product itself is never handed out */
+            return product_cache_open_handle(index, product);
+        }
+    }
+
+    *product = product_file;
+
+    return 0;
+}
+
+/** Open a product file for reading using a specific format definition.
+ * This function will try to open the specified file for reading similar to coda_open(), but instead of trying to
+ * automatically recognise the applicable product class/type/version as coda_open() does, this function will impose
+ * the format definition that is associated with the given \a product_class, \a product_type, and \a version parameters.
+ * \param filename Relative or full path to the product file.
+ * \param product_class Name of the product class for the requested format definition.
+ * \param product_type Name of the product type for the requested format definition.
+ * \param version Format version number of the product type definition. Use -1 to request the latest available definition.
+ * \param product Pointer to the variable where the pointer to the product file handle will be storeed.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_open_as(const char *filename, const char *product_class, const char *product_type, int version,
+                             coda_product **product)
+{
+    coda_product_definition *definition = NULL;
+    coda_product *product_file;
+    int open_as_binary = 0;
+
+    if (filename == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "filename argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (product_class != NULL)
+    {
+        if (product_type == NULL)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product_type argument is NULL (%s:%u)", __FILE__, __LINE__);
+            return -1;
+        }
+        if (product == NULL)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product argument is NULL (%s:%u)", __FILE__, __LINE__);
+            return -1;
+        }
     }
 
     if (product_class != NULL)
@@ -762,42 +1452,73 @@ LIBCODA_API int coda_open_as(const char *filename, const char *product_class, co
     return 0;
 }
 
-/** Close an open product file.
- * This function will close the file associated with the file handle and release the memory for the handle.
- * The file handle will be released even if unmapping or closing of the product file produced an error.
- * \param product Pointer to a product file handle. 
+/** Open a product that is already in memory.
+ * This function is similar to coda_open(), but instead of reading the product from a file, the product data is taken
+ * from the given memory buffer. The data is accessed directly from \a buffer (in the same way as a memory mapped file)
+ * and is not copied. The buffer remains owned by the caller and must remain valid (and unmodified) until
+ * coda_close() is called for the product.
+ * The \a name_hint is used as the filename of the product. It is used for product recognition (detection rules that
+ * check the filename) and is what coda_get_product_filename() returns. Pass NULL if there is no name available.
+ * Opening a product from memory is supported for all formats except HDF4 and HDF5. Compressed data is not
+ * decompressed automatically (unlike coda_open()).
+ * \param buffer Pointer to the data of the product.
+ * \param buffer_size Size in bytes of the data of the product.
+ * \param name_hint Name of the product (may be NULL).
+ * \param product Pointer to the variable where the pointer to the product file handle will be stored.
  * \return
  *   \arg \c 0, Success.
  *   \arg \c -1, Error occurred (check #coda_errno).
  */
-LIBCODA_API int coda_close(coda_product *product)
+LIBCODA_API int coda_open_from_memory(const void *buffer, int64_t buffer_size, const char *name_hint,
+                                      coda_product **product)
 {
+    coda_product_definition *definition = NULL;
+    coda_product *product_file;
+
+    if (buffer == NULL && buffer_size > 0)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "buffer argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (buffer_size < 0)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "buffer_size argument is negative (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
     if (product == NULL)
     {
-        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product file argument is NULL (%s:%u)", __FILE__, __LINE__);
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product argument is NULL (%s:%u)", __FILE__, __LINE__);
         return -1;
     }
 
-    /* remove product variable information */
-    if (product->product_variable_size != NULL)
+    if (coda_bin_open_from_memory(name_hint == NULL ? "" : name_hint, (const uint8_t *)buffer, buffer_size,
+                                  &product_file) != 0)
     {
-        free(product->product_variable_size);
-        product->product_variable_size = NULL;
+        return -1;
     }
-    if (product->product_variable != NULL)
+    if (open_raw_product(product_file, &product_file, 0) != 0)
     {
-        int i;
-
-        for (i = 0; i < product->product_definition->num_product_variables; i++)
-        {
-            if (product->product_variable[i] != NULL)
-            {
-                free(product->product_variable[i]);
-            }
-        }
-        free(product->product_variable);
-        product->product_variable = NULL;
+        return -1;
     }
+    if (coda_data_dictionary_find_definition_for_product(product_file, &definition) != 0)
+    {
+        coda_close(product_file);
+        return -1;
+    }
+    if (set_definition(&product_file, definition) != 0)
+    {
+        coda_close(product_file);
+        return -1;
+    }
+
+    *product = product_file;
+
+    return 0;
+}
+
+static int close_product(coda_product *product)
+{
+    delete_product_variables(product);
 
     switch (product->format)
     {
@@ -837,6 +1558,36 @@ LIBCODA_API int coda_close(coda_product *product)
     exit(1);
 }
 
+/** Close an open product file.
+ * This function will close the file associated with the file handle and release the memory for the handle.
+ * The file handle will be released even if unmapping or closing of the product file produced an error.
+ * If the product handle was obtained via the product cache (see coda_set_option_product_cache_size()), the cached
+ * product will only be released once all handles for the product have been closed and the product is no longer needed
+ * by the cache.
+ * \param product Pointer to a product file handle. 
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_close(coda_product *product)
+{
+    int index;
+
+    if (product == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product file argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    index = product_handle_find(product);
+    if (index >= 0)
+    {
+        return product_cache_close_handle(index);
+    }
+
+    return close_product(product);
+}
+
 /** Get the filename of a product file.
  * This function returns the same name that was used in the coda_open() call for this product file.
  * The pointer to the filename string is valid as long as the file is open. When you call coda_close() on the
@@ -1098,6 +1849,253 @@ LIBCODA_API int coda_get_product_definition_file(const coda_product *product, co
     return 0;
 }
 
+/** Get the statistics of the read cache of a product.
+ * If memory mapping is disabled (see coda_set_option_use_mmap()), CODA uses a block cache to read data from the file
+ * for structured ascii, structured binary, CDF, netCDF, and GRIB products (see
+ * coda_set_option_read_cache_block_size()). This function returns the number of block lookups that could be served
+ * from the cache (\a num_hits), the number of times one or more blocks had to be read from the file (\a num_misses),
+ * and the number of blocks that were read in advance because of sequential access (\a num_read_ahead).
+ * For products that do not use a read cache all values will be 0.
+ * \param product Pointer to a product file handle.
+ * \param num_hits Pointer to the variable where the number of cache hits will be stored.
+ * \param num_misses Pointer to the variable where the number of cache misses will be stored.
+ * \param num_read_ahead Pointer to the variable where the number of blocks that were read ahead will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_get_product_read_cache_statistics(const coda_product *product, int64_t *num_hits,
+                                                       int64_t *num_misses, int64_t *num_read_ahead)
+{
+    coda_product *raw_product;
+
+    if (product == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product file argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (num_hits == NULL || num_misses == NULL || num_read_ahead == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid statistics argument (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    raw_product = get_raw_product(product);
+
+    *num_hits = 0;
+    *num_misses = 0;
+    *num_read_ahead = 0;
+    if (raw_product != NULL && ((const coda_bin_product *)raw_product)->read_cache != NULL)
+    {
+        const coda_bin_read_cache *read_cache = ((const coda_bin_product *)raw_product)->read_cache;
+
+        *num_hits = read_cache->num_hits;
+        *num_misses = read_cache->num_misses;
+        *num_read_ahead = read_cache->num_read_ahead;
+    }
+
+    return 0;
+}
+
+/** Set the expected access pattern for a product.
+ * This function passes a hint to the operating system about the way the data of the product is going to be read.
+ * If a product is going to be read in full from start to end (e.g. when checking or dumping a whole product) use
+ * #coda_access_pattern_sequential, which allows the operating system to read ahead aggressively. If only a few
+ * scattered items are going to be read from a large product use #coda_access_pattern_random, which prevents the
+ * operating system from reading data that is not going to be used.
+ * If memory mapping is disabled, the hint also determines when blocks are read in advance by the read cache (see
+ * coda_set_option_read_cache_num_blocks()).
+ * The hint only has an effect for structured ascii, structured binary, CDF, netCDF, and GRIB products on platforms
+ * that support posix_madvise() and/or posix_fadvise(). For all other products (and platforms) this function does
+ * nothing.
+ * The hint is a property of the product file handle. Each coda_open() call returns its own handle (also when the
+ * product cache is enabled), so setting the hint for one handle does not affect other handles for the same file.
+ * \param product Pointer to a product file handle.
+ * \param access_pattern The expected access pattern.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_set_product_access_pattern(coda_product *product, coda_access_pattern access_pattern)
+{
+    coda_product *raw_product;
+
+    if (product == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product file argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (access_pattern != coda_access_pattern_normal && access_pattern != coda_access_pattern_sequential &&
+        access_pattern != coda_access_pattern_random)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid access pattern argument (%d) (%s:%u)",
+                       (int)access_pattern, __FILE__, __LINE__);
+        return -1;
+    }
+
+    raw_product = get_raw_product(product);
+    if (raw_product == NULL)
+    {
+        return 0;
+    }
+
+    return coda_bin_product_set_access_pattern((coda_bin_product *)raw_product, access_pattern);
+}
+
+/** Indicate that a byte range of a product will be read soon.
+ * This function tells the operating system that the data in the given byte range of the product file will be needed
+ * shortly, allowing it to start loading the data in the background. The byte range will be clipped to the size of
+ * the file.
+ * CODA already calls this function itself when a large array is read in one go from a structured binary or
+ * netCDF product.
+ * The hint only has an effect for structured ascii, structured binary, CDF, netCDF, and GRIB products on platforms
+ * that support posix_madvise() and/or posix_fadvise(). For all other products (and platforms) this function does
+ * nothing.
+ * \param product Pointer to a product file handle.
+ * \param byte_offset Offset in bytes from the start of the file of the data that will be needed.
+ * \param byte_length Length in bytes of the data that will be needed.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_prefetch_product_data(coda_product *product, int64_t byte_offset, int64_t byte_length)
+{
+    coda_product *raw_product;
+
+    if (product == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product file argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (byte_offset < 0 || byte_length < 0)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid byte range argument (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    raw_product = get_raw_product(product);
+    if (raw_product == NULL)
+    {
+        return 0;
+    }
+
+    return coda_bin_product_prefetch((coda_bin_product *)raw_product, byte_offset, byte_length);
+}
+
+/** Read a batch of byte ranges from a product file.
+ * This function reads \a num_ranges (possibly scattered) ranges of raw bytes from the product file. The bytes of
+ * range \a i (\a byte_length[i] bytes starting at file offset \a byte_offset[i]) are stored in \a dst directly
+ * after the bytes of range \a i - 1 (i.e. \a dst should be able to hold the sum of all \a byte_length values).
+ * Instead of reading the ranges one by one, all ranges are first announced to the operating system (see
+ * coda_prefetch_product_data()) such that data that is not yet in memory can be loaded concurrently. The ranges are
+ * then read in order of their position in the file. For scattered reads from storage with a high latency (e.g.
+ * network storage) this can be much faster than reading each range separately.
+ * This function is only supported for structured ascii, structured binary, CDF, netCDF, and GRIB products.
+ * \param product Pointer to a product file handle.
+ * \param num_ranges Number of byte ranges to read.
+ * \param byte_offset Array of \a num_ranges file offsets (in bytes) of the ranges.
+ * \param byte_length Array of \a num_ranges lengths (in bytes) of the ranges.
+ * \param dst Pointer to the buffer where the data of all ranges will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_read_product_bytes(coda_product *product, long num_ranges, const int64_t *byte_offset,
+                                        const int64_t *byte_length, uint8_t *dst)
+{
+    coda_bin_byte_range *range;
+    coda_product *raw_product;
+    int64_t *dst_offset;
+    long i;
+
+    if (product == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product file argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (num_ranges < 0)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "num_ranges argument is negative (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (num_ranges == 0)
+    {
+        return 0;
+    }
+    if (byte_offset == NULL || byte_length == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "byte range argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (dst == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "dst argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    raw_product = get_raw_product(product);
+    if (raw_product == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_FORMAT, "reading raw bytes is not supported for %s products",
+                       coda_type_get_format_name(product->format));
+        return -1;
+    }
+
+    range = malloc(num_ranges * sizeof(coda_bin_byte_range));
+    if (range == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       num_ranges * sizeof(coda_bin_byte_range), __FILE__, __LINE__);
+        return -1;
+    }
+    dst_offset = malloc(num_ranges * sizeof(int64_t));
+    if (dst_offset == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       num_ranges * sizeof(int64_t), __FILE__, __LINE__);
+        free(range);
+        return -1;
+    }
+    for (i = 0; i < num_ranges; i++)
+    {
+        if (byte_offset[i] < 0 || byte_length[i] < 0)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid byte range (index %ld) (%s:%u)", i, __FILE__,
+                           __LINE__);
+            free(dst_offset);
+            free(range);
+            return -1;
+        }
+        range[i].offset = byte_offset[i];
+        range[i].length = byte_length[i];
+        range[i].index = i;
+        dst_offset[i] = (i == 0) ? 0 : dst_offset[i - 1] + byte_length[i - 1];
+    }
+
+    if (coda_bin_product_prefetch_ranges((coda_bin_product *)raw_product, num_ranges, range) != 0)
+    {
+        free(dst_offset);
+        free(range);
+        return -1;
+    }
+    for (i = 0; i < num_ranges; i++)
+    {
+        if (range[i].length > 0)
+        {
+            if (read_bytes(raw_product, range[i].offset, range[i].length, &dst[dst_offset[range[i].index]]) != 0)
+            {
+                free(dst_offset);
+                free(range);
+                return -1;
+            }
+        }
+    }
+
+    free(dst_offset);
+    free(range);
+
+    return 0;
+}
+
 /** Get the value for a product variable.
  * CODA supports a mechanism called product variables to store frequently needed information of a product (i.e.
  * information that is needed to calculate byte offsets or array sizes within a product). With this function you
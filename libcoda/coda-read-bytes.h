@@ -86,28 +86,10 @@ static int read_bytes(coda_product *product, int64_t byte_offset, int64_t length
             coda_set_error(CODA_ERROR_OUT_OF_BOUNDS_READ, "trying to read beyond the end of the file");
             return -1;
         }
-#if HAVE_PREAD
-        if (pread(((coda_bin_product *)product)->fd, dst, (size_t)length, (off_t)byte_offset) < 0)
+        if (coda_bin_product_read((coda_bin_product *)product, byte_offset, length, dst) != 0)
         {
-            coda_set_error(CODA_ERROR_FILE_READ, "could not read from file (%s)", strerror(errno));
             return -1;
         }
-#else
-        if (lseek(((coda_bin_product *)product)->fd, (off_t)byte_offset, SEEK_SET) < 0)
-        {
-            char byte_offset_str[21];
-
-            coda_str64(byte_offset, byte_offset_str);
-            coda_set_error(CODA_ERROR_FILE_READ, "could not move to byte position %s (%s)", byte_offset_str,
-                           strerror(errno));
-            return -1;
-        }
-        if (read(((coda_bin_product *)product)->fd, dst, (size_t)length) < 0)
-        {
-            coda_set_error(CODA_ERROR_FILE_READ, "could not read from file (%s)", strerror(errno));
-            return -1;
-        }
-#endif
     }
 
     return 0;
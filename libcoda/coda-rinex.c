@@ -33,6 +33,7 @@
 #include "coda-ascbin.h"
 #include "coda-ascii.h"
 #include "coda-mem-internal.h"
+#include "coda-read-bytes.h"
 
 #include <assert.h>
 #include <errno.h>
@@ -95,6 +96,7 @@ enum
     rinex_obs_epoch_flag,
     rinex_receiver_clock_offset,
     rinex_satellite_number,
+    rinex_observation_satellite_number,
     rinex_observation,
     rinex_lli,
     rinex_signal_strength,
@@ -220,7 +222,10 @@ typedef struct satellite_info_struct
 
 typedef struct ingest_info_struct
 {
-    FILE *f;
+    const char *buffer;         /* full file content */
+    long buffer_size;
+    long buffer_offset;         /* offset of the next line to read */
+    int free_buffer;            /* whether buffer was allocated by us (i.e. file was not memory mapped) */
     coda_product *product;
     coda_mem_record *header;    /* actual data for /header */
     satellite_info gps;
@@ -278,9 +283,9 @@ static void satellite_info_cleanup(satellite_info *info)
 
 static void ingest_info_cleanup(ingest_info *info)
 {
-    if (info->f != NULL)
+    if (info->buffer != NULL && info->free_buffer)
     {
-        fclose(info->f);
+        free((char *)info->buffer);
     }
     if (info->header != NULL)
     {
@@ -328,7 +333,10 @@ static void satellite_info_init(satellite_info *info)
 
 static void ingest_info_init(ingest_info *info)
 {
-    info->f = NULL;
+    info->buffer = NULL;
+    info->buffer_size = 0;
+    info->buffer_offset = 0;
+    info->free_buffer = 0;
     info->header = NULL;
     satellite_info_init(&info->gps);
     satellite_info_init(&info->glonass);
@@ -628,7 +636,18 @@ static int rinex_init(void)
     coda_type_set_description(rinex_type[rinex_satellite_number],
                               "Satellite number (for the applicable satellite system)");
 
-    rinex_type[rinex_observation] = (coda_type *)coda_type_number_new(coda_format_rinex, coda_real_class);
+    /* the observation data of a satellite is stored as a single packed block in memory, which is why the types
+     * for the content of /record[]/<sys>[] use the binary format (with native endianness)
+     */
+    rinex_type[rinex_observation_satellite_number] =
+        (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
+    coda_type_number_set_endianness((coda_type_number *)rinex_type[rinex_observation_satellite_number], endianness);
+    coda_type_set_read_type(rinex_type[rinex_observation_satellite_number], coda_native_type_uint8);
+    coda_type_set_bit_size(rinex_type[rinex_observation_satellite_number], 8);
+    coda_type_set_description(rinex_type[rinex_observation_satellite_number],
+                              "Satellite number (for the applicable satellite system)");
+
+    rinex_type[rinex_observation] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)rinex_type[rinex_observation], endianness);
     coda_type_set_bit_size(rinex_type[rinex_observation], 64);
     coda_type_set_description(rinex_type[rinex_observation],
@@ -636,7 +655,7 @@ static int rinex_init(void)
                               "written as 0.0 or blanks. Phase values overflowing the fixed format have to be clipped "
                               "into the valid interval (e.g add or subtract 10**9), set LLI indicator.");
 
-    rinex_type[rinex_lli] = (coda_type *)coda_type_number_new(coda_format_rinex, coda_integer_class);
+    rinex_type[rinex_lli] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)rinex_type[rinex_lli], endianness);
     coda_type_set_read_type(rinex_type[rinex_lli], coda_native_type_uint8);
     coda_type_set_bit_size(rinex_type[rinex_lli], 8);
@@ -646,7 +665,7 @@ static int rinex_init(void)
                               "not capable of handling half cycles should skip this observation. Valid for the current "
                               "epoch only.");
 
-    rinex_type[rinex_signal_strength] = (coda_type *)coda_type_number_new(coda_format_rinex, coda_integer_class);
+    rinex_type[rinex_signal_strength] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)rinex_type[rinex_signal_strength], endianness);
     coda_type_set_read_type(rinex_type[rinex_signal_strength], coda_native_type_uint8);
     coda_type_set_bit_size(rinex_type[rinex_signal_strength], 8);
@@ -654,7 +673,7 @@ static int rinex_init(void)
                               "1: minimum possible signal strength. 5: average S/N ratio. "
                               "9: maximum possible signal strength. 0 or blank: not known, don't care");
 
-    rinex_type[rinex_observation_record] = (coda_type *)coda_type_record_new(coda_format_rinex);
+    rinex_type[rinex_observation_record] = (coda_type *)coda_type_record_new(coda_format_binary);
     field = coda_type_record_field_new("observation");
     coda_type_record_field_set_type(field, rinex_type[rinex_observation]);
     coda_type_record_add_field((coda_type_record *)rinex_type[rinex_observation_record], field);
@@ -1720,49 +1739,169 @@ static void rtrim(char *str)
     }
 }
 
-static int get_line(FILE *f, char *line)
+static int get_line(ingest_info *info, char *line)
 {
+    const char *start;
+    const char *end;
     long length;
 
-    if (fgets(line, MAX_LINE_LENGTH, f) == NULL)
+    if (info->buffer_offset >= info->buffer_size)
     {
-        if (ferror(f))
-        {
-            coda_set_error(CODA_ERROR_FILE_READ, "could not read from file (%s)", strerror(errno));
-            return -1;
-        }
         /* end of file -> return empty line  */
         line[0] = '\0';
         return 0;
     }
-    length = strlen(line);
 
-    /* remove 'linefeed' character if available */
-    if (length > 0 && line[length - 1] == '\n')
+    /* lines longer than the maximum line length get split (similar to what fgets() would do) */
+    start = &info->buffer[info->buffer_offset];
+    length = info->buffer_size - info->buffer_offset;
+    if (length > MAX_LINE_LENGTH - 1)
     {
-        line[length - 1] = '\0';
-        length--;
+        length = MAX_LINE_LENGTH - 1;
+    }
+    end = memchr(start, '\n', (size_t)length);
+    if (end != NULL)
+    {
+        length = (long)(end - start);
+        /* skip the 'linefeed' character */
+        info->buffer_offset += length + 1;
+    }
+    else
+    {
+        info->buffer_offset += length;
     }
 
     /* remove 'carriage return' character if available */
-    if (length > 0 && line[length - 1] == '\r')
+    if (length > 0 && start[length - 1] == '\r')
     {
-        line[length - 1] = '\0';
         length--;
     }
 
+    memcpy(line, start, (size_t)length);
+    line[length] = '\0';
+
     return length;
 }
 
+/* fast path for parsing fixed width integer fields: leading/trailing blanks, an optional sign, and digits only
+ * returns -1 if the field has any other content (the caller should then fall back to a generic parser)
+ */
+static int parse_fixed_int(const char *str, int length, int *dst)
+{
+    int negative = 0;
+    int num_digits = 0;
+    int value = 0;
+    int i = 0;
+
+    while (i < length && str[i] == ' ')
+    {
+        i++;
+    }
+    if (i < length && (str[i] == '-' || str[i] == '+'))
+    {
+        negative = (str[i] == '-');
+        i++;
+    }
+    while (i < length && str[i] >= '0' && str[i] <= '9')
+    {
+        value = value * 10 + (str[i] - '0');
+        num_digits++;
+        i++;
+    }
+    while (i < length && str[i] == ' ')
+    {
+        i++;
+    }
+    if (num_digits == 0 || num_digits > 9 || i != length)
+    {
+        return -1;
+    }
+    *dst = negative ? -value : value;
+
+    return 0;
+}
+
+/* fast path for parsing fixed width floating point fields in 'F' notation (e.g. F14.3)
+ * an all blank field results in 0.0
+ * since the mantissa and the power of ten are both exactly representable as a double (we allow at most 15 digits),
+ * the result is correctly rounded (i.e. identical to what strtod() would return)
+ * returns -1 if the field has any other content (the caller should then fall back to a generic parser)
+ */
+static int parse_fixed_double(const char *str, int length, double *dst)
+{
+    static const double power_of_ten[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+        1e13, 1e14, 1e15
+    };
+    int64_t mantissa = 0;
+    int num_fraction_digits = -1;       /* -1 means that there was no decimal point */
+    int num_digits = 0;
+    int negative = 0;
+    int i = 0;
+
+    while (i < length && str[i] == ' ')
+    {
+        i++;
+    }
+    if (i == length)
+    {
+        *dst = 0.0;
+        return 0;
+    }
+    if (str[i] == '-' || str[i] == '+')
+    {
+        negative = (str[i] == '-');
+        i++;
+    }
+    for (; i < length; i++)
+    {
+        if (str[i] >= '0' && str[i] <= '9')
+        {
+            mantissa = mantissa * 10 + (str[i] - '0');
+            num_digits++;
+            if (num_fraction_digits >= 0)
+            {
+                num_fraction_digits++;
+            }
+        }
+        else if (str[i] == '.' && num_fraction_digits < 0)
+        {
+            num_fraction_digits = 0;
+        }
+        else
+        {
+            break;
+        }
+    }
+    while (i < length && str[i] == ' ')
+    {
+        i++;
+    }
+    if (num_digits == 0 || num_digits > 15 || i != length)
+    {
+        return -1;
+    }
+    *dst = (double)mantissa;
+    if (num_fraction_digits > 0)
+    {
+        *dst /= power_of_ten[num_fraction_digits];
+    }
+    if (negative)
+    {
+        *dst = -*dst;
+    }
+
+    return 0;
+}
+
 static int read_main_header(ingest_info *info)
 {
     coda_dynamic_type *value;
     char line[MAX_LINE_LENGTH];
     long linelength;
 
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -1884,9 +2023,9 @@ static int handle_observation_definition(ingest_info *info, char *line)
                        "(line: %ld, byte offset: %ld)", line[0], info->linenumber, info->offset);
         return -1;
     }
-    sat_info->sat_obs_definition = coda_type_record_new(coda_format_rinex);
+    sat_info->sat_obs_definition = coda_type_record_new(coda_format_binary);
     field = coda_type_record_field_new("number");
-    coda_type_record_field_set_type(field, rinex_type[rinex_satellite_number]);
+    coda_type_record_field_set_type(field, rinex_type[rinex_observation_satellite_number]);
     coda_type_record_add_field(sat_info->sat_obs_definition, field);
 
     if (coda_ascii_parse_int64(&line[3], 3, &num_types, 0) < 0)
@@ -1926,9 +2065,9 @@ static int handle_observation_definition(ingest_info *info, char *line)
             long expected_line_length = 6 + 13 * 4;
 
             /* read next line */
-            info->offset = ftell(info->f);
+            info->offset = info->buffer_offset;
             info->linenumber++;
-            linelength = get_line(info->f, line);
+            linelength = get_line(info, line);
             if (linelength < 0)
             {
                 coda_dynamic_type_delete((coda_dynamic_type *)sys);
@@ -1992,9 +2131,9 @@ static int read_observation_header(ingest_info *info)
 
     info->sys_array = coda_mem_array_new((coda_type_array *)rinex_type[rinex_sys_array], NULL);
 
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -2342,9 +2481,9 @@ static int read_observation_header(ingest_info *info)
             return -1;
         }
 
-        info->offset = ftell(info->f);
+        info->offset = info->buffer_offset;
         info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_line(info, line);
         if (linelength < 0)
         {
             return -1;
@@ -2354,7 +2493,7 @@ static int read_observation_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "sys", (coda_dynamic_type *)info->sys_array, 0);
     info->sys_array = NULL;
 
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
     return 0;
 }
@@ -2362,17 +2501,17 @@ static int read_observation_header(ingest_info *info)
 static int read_observation_record_for_satellite(ingest_info *info)
 {
     satellite_info *sat_info;
-    coda_mem_record *sat_obs;
-    coda_dynamic_type *value;
-    char line[MAX_LINE_LENGTH];
+    coda_dynamic_type *sat_obs;
+    char line[MAX_LINE_LENGTH + 1];     /* add room for padding of truncated blank values */
+    uint8_t data[1 + 10 * (MAX_LINE_LENGTH / 16)];
+    long data_length;
     long linelength;
-    char str[17];
     int number;
     int i;
 
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -2423,59 +2562,63 @@ static int read_observation_record_for_satellite(ingest_info *info)
         return -1;
     }
 
-    sat_obs = coda_mem_record_new(sat_info->sat_obs_definition, NULL);
-
-    memcpy(str, &line[1], 2);
-    str[2] = '\0';
-    if (sscanf(str, "%2d", &number) != 1)
+    if (parse_fixed_int(&line[1], 2, &number) != 0)
     {
-        coda_dynamic_type_delete((coda_dynamic_type *)sat_obs);
-        coda_set_error(CODA_ERROR_FILE_READ, "invalid satellite number (line: %ld, byte offset: %ld)",
-                       info->linenumber, info->offset + 1);
-        return -1;
+        char str[3];
+
+        memcpy(str, &line[1], 2);
+        str[2] = '\0';
+        if (sscanf(str, "%2d", &number) != 1)
+        {
+            coda_set_error(CODA_ERROR_FILE_READ, "invalid satellite number (line: %ld, byte offset: %ld)",
+                           info->linenumber, info->offset + 1);
+            return -1;
+        }
     }
-    value = (coda_dynamic_type *)coda_mem_uint8_new((coda_type_number *)rinex_type[rinex_satellite_number], NULL,
-                                                    info->product, (uint8_t)number);
-    coda_mem_record_add_field(sat_obs, "number", value, 0);
+
+    /* all data for this satellite is stored as a single block: the satellite number followed by
+     * (observation, lli, signal_strength) for each observable (see sat_obs_definition)
+     */
+    data_length = (long)(sat_info->sat_obs_definition->bit_size >> 3);
+    assert(data_length == 1 + 10 * sat_info->num_observables);
+    assert(data_length <= (long)sizeof(data));
+    data[0] = (uint8_t)number;
 
     for (i = 0; i < sat_info->num_observables; i++)
     {
-        uint8_t lli;
-        uint8_t signal_strength;
+        const char *str = &line[3 + i * 16];
+        uint8_t *obs_data = &data[1 + i * 10];
         double observation;
-        coda_mem_record *observation_record;
 
-        memcpy(str, &line[3 + i * 16], 16);
-        lli = (str[14] >= '0' && str[14] <= '9' ? str[14] - '0' : 0);
-        signal_strength = (str[15] >= '0' && str[15] <= '9' ? str[15] - '0' : 0);
-        str[14] = '\0';
-        if (sscanf(str, "%lf", &observation) != 1)
+        if (parse_fixed_double(str, 14, &observation) != 0)
         {
-            if (strcmp(str, "              ") != 0)
+            char obs_str[15];
+
+            memcpy(obs_str, str, 14);
+            obs_str[14] = '\0';
+            if (sscanf(obs_str, "%lf", &observation) != 1)
             {
-                coda_dynamic_type_delete((coda_dynamic_type *)sat_obs);
                 coda_set_error(CODA_ERROR_FILE_READ, "invalid observation value (line: %ld, byte offset: %ld)",
                                info->linenumber, info->offset + 3 + i * 16);
                 return -1;
             }
-            /* if we have all blanks, use a 'missing value' of 0 */
-            observation = 0.0;
         }
-
-        observation_record = coda_mem_record_new((coda_type_record *)rinex_type[rinex_observation_record], NULL);
-        value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)rinex_type[rinex_observation], NULL,
-                                                         info->product, observation);
-        coda_mem_record_add_field(observation_record, "observation", value, 0);
-        value = (coda_dynamic_type *)coda_mem_uint8_new((coda_type_number *)rinex_type[rinex_lli], NULL,
-                                                        info->product, (uint8_t)lli);
-        coda_mem_record_add_field(observation_record, "lli", value, 0);
-        value = (coda_dynamic_type *)coda_mem_uint8_new((coda_type_number *)rinex_type[rinex_signal_strength], NULL,
-                                                        info->product, (uint8_t)signal_strength);
-        coda_mem_record_add_field(observation_record, "signal_strength", value, 0);
-        coda_mem_record_add_field(sat_obs, sat_info->observable[i], (coda_dynamic_type *)observation_record, 0);
+        memcpy(obs_data, &observation, 8);
+        obs_data[8] = (str[14] >= '0' && str[14] <= '9' ? str[14] - '0' : 0);
+        obs_data[9] = (str[15] >= '0' && str[15] <= '9' ? str[15] - '0' : 0);
     }
 
-    coda_mem_array_add_element(sat_info->sat_obs_array, (coda_dynamic_type *)sat_obs);
+    sat_obs = (coda_dynamic_type *)coda_mem_data_new((coda_type *)sat_info->sat_obs_definition, NULL, info->product,
+                                                     data_length, data);
+    if (sat_obs == NULL)
+    {
+        return -1;
+    }
+    if (coda_mem_array_add_element(sat_info->sat_obs_array, sat_obs) != 0)
+    {
+        coda_dynamic_type_delete(sat_obs);
+        return -1;
+    }
 
     return 0;
 }
@@ -2488,9 +2631,9 @@ static int read_observation_records(ingest_info *info)
     char str[61];
     int i;
 
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -2531,13 +2674,16 @@ static int read_observation_records(ingest_info *info)
                                                        info->product, epoch_flag);
         coda_mem_record_add_field(info->epoch_record, "flag", value, 0);
 
-        memcpy(str, &line[32], 3);
-        str[3] = '\0';
-        if (sscanf(str, "%3d", &num_satellites) != 1)
+        if (parse_fixed_int(&line[32], 3, &num_satellites) != 0)
         {
-            coda_set_error(CODA_ERROR_FILE_READ, "invalid 'number of satellites' entry in epoch record "
-                           "(line: %ld, byte offset: %ld)", info->linenumber, info->offset + 34);
-            return -1;
+            memcpy(str, &line[32], 3);
+            str[3] = '\0';
+            if (sscanf(str, "%3d", &num_satellites) != 1)
+            {
+                coda_set_error(CODA_ERROR_FILE_READ, "invalid 'number of satellites' entry in epoch record "
+                               "(line: %ld, byte offset: %ld)", info->linenumber, info->offset + 34);
+                return -1;
+            }
         }
 
         if (linelength >= 56)
@@ -2579,9 +2725,9 @@ static int read_observation_records(ingest_info *info)
             /* we skip the remaing part of this record if epoch flag != 0 */
             for (i = 0; i < num_satellites; i++)
             {
-                info->offset = ftell(info->f);
+                info->offset = info->buffer_offset;
                 info->linenumber++;
-                linelength = get_line(info->f, line);
+                linelength = get_line(info, line);
                 if (linelength < 0)
                 {
                     return -1;
@@ -2624,9 +2770,9 @@ static int read_observation_records(ingest_info *info)
         coda_mem_array_add_element(info->records, (coda_dynamic_type *)info->epoch_record);
         info->epoch_record = NULL;
 
-        info->offset = ftell(info->f);
+        info->offset = info->buffer_offset;
         info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_line(info, line);
         if (linelength < 0)
         {
             return -1;
@@ -2650,9 +2796,9 @@ static int read_navigation_header(ingest_info *info)
     info->time_system_corr_array = coda_mem_array_new((coda_type_array *)rinex_type[rinex_time_system_corr_array],
                                                       NULL);
 
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -2835,9 +2981,9 @@ static int read_navigation_header(ingest_info *info)
             return -1;
         }
 
-        info->offset = ftell(info->f);
+        info->offset = info->buffer_offset;
         info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_line(info, line);
         if (linelength < 0)
         {
             return -1;
@@ -2849,7 +2995,7 @@ static int read_navigation_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "time_system_corr", (coda_dynamic_type *)info->time_system_corr_array, 0);
     info->time_system_corr_array = NULL;
 
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
     return 0;
 }
@@ -2868,9 +3014,9 @@ static int read_navigation_record_values(ingest_info *info, char *line, int num_
             long linelength;
 
             /* read next line */
-            info->offset = ftell(info->f);
+            info->offset = info->buffer_offset;
             info->linenumber++;
-            linelength = get_line(info->f, line);
+            linelength = get_line(info, line);
             if (linelength < 0)
             {
                 return -1;
@@ -2902,9 +3048,9 @@ static int read_navigation_records(ingest_info *info)
     long linelength;
     char str[61];
 
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -3274,9 +3420,9 @@ static int read_navigation_records(ingest_info *info)
             coda_mem_array_add_element(info->sbas.records, (coda_dynamic_type *)record);
         }
 
-        info->offset = ftell(info->f);
+        info->offset = info->buffer_offset;
         info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_line(info, line);
         if (linelength < 0)
         {
             return -1;
@@ -3296,9 +3442,9 @@ static int read_clock_header(ingest_info *info)
 
     info->sys_array = coda_mem_array_new((coda_type_array *)rinex_type[rinex_sys_array], NULL);
 
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -3419,9 +3565,9 @@ static int read_clock_header(ingest_info *info)
             return -1;
         }
 
-        info->offset = ftell(info->f);
+        info->offset = info->buffer_offset;
         info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_line(info, line);
         if (linelength < 0)
         {
             return -1;
@@ -3431,7 +3577,7 @@ static int read_clock_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "sys", (coda_dynamic_type *)info->sys_array, 0);
     info->sys_array = NULL;
 
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
     return 0;
 }
@@ -3443,9 +3589,9 @@ static int read_clock_records(ingest_info *info)
     double double_value;
     char str[61];
 
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -3526,9 +3672,9 @@ static int read_clock_records(ingest_info *info)
         if (num_values > 2)
         {
             /* read next line */
-            info->offset = ftell(info->f);
+            info->offset = info->buffer_offset;
             info->linenumber++;
-            linelength = get_line(info->f, line);
+            linelength = get_line(info, line);
             if (linelength < 0)
             {
                 return -1;
@@ -3586,9 +3732,9 @@ static int read_clock_records(ingest_info *info)
         coda_mem_array_add_element(info->records, (coda_dynamic_type *)info->epoch_record);
         info->epoch_record = NULL;
 
-        info->offset = ftell(info->f);
+        info->offset = info->buffer_offset;
         info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_line(info, line);
         if (linelength < 0)
         {
             return -1;
@@ -3598,7 +3744,7 @@ static int read_clock_records(ingest_info *info)
     return 0;
 }
 
-static int read_file(coda_product *product)
+static int read_file(coda_product *product, coda_product *raw_product)
 {
     coda_type_array *records_definition;
     coda_type_record_field *field;
@@ -3609,11 +3755,30 @@ static int read_file(coda_product *product)
     ingest_info_init(&info);
     info.product = product;
 
-    info.f = fopen(product->filename, "r");
-    if (info.f == NULL)
+    /* we parse directly from the memory mapped file if possible, otherwise we read the full file into memory */
+    info.buffer_size = (long)raw_product->file_size;
+    if (raw_product->mem_ptr != NULL)
     {
-        coda_set_error(CODA_ERROR_FILE_OPEN, "could not open file %s", product->filename);
-        return -1;
+        info.buffer = (const char *)raw_product->mem_ptr;
+    }
+    else if (info.buffer_size > 0)
+    {
+        char *buffer;
+
+        buffer = malloc((size_t)info.buffer_size);
+        if (buffer == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)info.buffer_size, __FILE__, __LINE__);
+            return -1;
+        }
+        info.buffer = buffer;
+        info.free_buffer = 1;
+        if (read_bytes(raw_product, 0, info.buffer_size, buffer) != 0)
+        {
+            ingest_info_cleanup(&info);
+            return -1;
+        }
     }
 
     if (read_main_header(&info) != 0)
@@ -3797,15 +3962,16 @@ int coda_rinex_reopen(coda_product **product)
         return -1;
     }
 
-    coda_close(*product);
-
     /* create root type */
-    if (read_file(product_file) != 0)
+    if (read_file(product_file, *product) != 0)
     {
         coda_close(product_file);
+        coda_close(*product);
         return -1;
     }
 
+    coda_close(*product);
+
     *product = (coda_product *)product_file;
 
     return 0;
@@ -3822,6 +3988,10 @@ int coda_rinex_close(coda_product *product)
     {
         free(product->filename);
     }
+    if (product->mem_ptr != NULL)
+    {
+        free(product->mem_ptr);
+    }
 
     free(product);
 
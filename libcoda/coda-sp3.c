@@ -33,6 +33,7 @@
 #include "coda-ascbin.h"
 #include "coda-ascii.h"
 #include "coda-mem-internal.h"
+#include "coda-read-bytes.h"
 
 #include <assert.h>
 #include <errno.h>
@@ -41,6 +42,7 @@
 #include <string.h>
 
 #define MAX_LINE_LENGTH 1000
+#define MAX_PACKED_RECORD_SIZE 128
 
 enum
 {
@@ -80,6 +82,7 @@ enum
     sp3_P_clock_pred_flag,
     sp3_P_maneuver_flag,
     sp3_P_orbit_pred_flag,
+    sp3_has_corr,
     sp3_P_corr,
 
     sp3_EP_x_sdev,
@@ -133,16 +136,23 @@ static coda_type **sp3_type = NULL;
 
 typedef struct ingest_info_struct
 {
-    FILE *f;
+    const char *buffer;         /* full file content */
+    long buffer_size;
+    long buffer_offset;         /* offset of the next line to read */
+    int free_buffer;            /* whether buffer was allocated by us (i.e. file was not memory mapped) */
     coda_product *product;
     coda_mem_record *header;    /* actual data for /header */
     coda_mem_array *records;    /* actual data for /record */
     coda_mem_record *record;    /* actual data for /record[] */
     coda_mem_array *pos_clk_array;      /* actual data for /record[]/pos_clk */
-    coda_mem_record *pos_clk;   /* actual data for /record[]/pos_clk[] */
     coda_mem_array *vel_rate_array;     /* actual data for /record[]/vel_rate */
-    coda_mem_record *vel_rate;  /* actual data for /record[]/vel_rate[] */
-    coda_mem_record *corr;      /* actual data for /record[]/...[]/corr */
+    /* the content of each /record[]/pos_clk[] and /record[]/vel_rate[] element is stored as a single packed block
+     * (using the layout of the binary sp3_pos_clk and sp3_vel_rate record definitions)
+     */
+    uint8_t pos_clk[MAX_PACKED_RECORD_SIZE];
+    long pos_clk_length;        /* 0 if there is no pending /record[]/pos_clk[] element */
+    uint8_t vel_rate[MAX_PACKED_RECORD_SIZE];
+    long vel_rate_length;       /* 0 if there is no pending /record[]/vel_rate[] element */
     int num_satellites;
     char posvel;
     long linenumber;
@@ -151,9 +161,9 @@ typedef struct ingest_info_struct
 
 static void ingest_info_cleanup(ingest_info *info)
 {
-    if (info->f != NULL)
+    if (info->buffer != NULL && info->free_buffer)
     {
-        fclose(info->f);
+        free((char *)info->buffer);
     }
     if (info->header != NULL)
     {
@@ -171,35 +181,25 @@ static void ingest_info_cleanup(ingest_info *info)
     {
         coda_dynamic_type_delete((coda_dynamic_type *)info->pos_clk_array);
     }
-    if (info->pos_clk != NULL)
-    {
-        coda_dynamic_type_delete((coda_dynamic_type *)info->pos_clk);
-    }
     if (info->vel_rate_array != NULL)
     {
         coda_dynamic_type_delete((coda_dynamic_type *)info->vel_rate_array);
     }
-    if (info->vel_rate != NULL)
-    {
-        coda_dynamic_type_delete((coda_dynamic_type *)info->vel_rate);
-    }
-    if (info->corr != NULL)
-    {
-        coda_dynamic_type_delete((coda_dynamic_type *)info->corr);
-    }
 }
 
 static void ingest_info_init(ingest_info *info)
 {
-    info->f = NULL;
+    info->buffer = NULL;
+    info->buffer_size = 0;
+    info->buffer_offset = 0;
+    info->free_buffer = 0;
     info->header = NULL;
     info->records = NULL;
     info->record = NULL;
     info->pos_clk_array = NULL;
-    info->pos_clk = NULL;
+    info->pos_clk_length = 0;
     info->vel_rate_array = NULL;
-    info->vel_rate = NULL;
-    info->corr = NULL;
+    info->vel_rate_length = 0;
     info->num_satellites = 0;
     info->linenumber = 0;
     info->offset = 0;
@@ -210,6 +210,8 @@ static int sp3_init(void)
     coda_endianness endianness;
     coda_type_record_field *field;
     coda_expression *expr;
+    char expr_string[32];
+    int64_t fixed_bit_size;
     int i;
 
     if (sp3_type != NULL)
@@ -343,245 +345,245 @@ static int sp3_init(void)
     coda_type_time_set_base_type((coda_type_special *)sp3_type[sp3_epoch], sp3_type[sp3_epoch_string]);
     coda_type_set_description(sp3_type[sp3_epoch], "Epoch Start");
 
-    sp3_type[sp3_vehicle_id] = (coda_type *)coda_type_text_new(coda_format_sp3);
+    sp3_type[sp3_vehicle_id] = (coda_type *)coda_type_text_new(coda_format_binary);
     coda_type_set_byte_size(sp3_type[sp3_vehicle_id], 3);
     coda_type_set_description(sp3_type[sp3_vehicle_id], "Vehicle Id");
 
-    sp3_type[sp3_P_x_coordinate] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_P_x_coordinate] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_x_coordinate], endianness);
     coda_type_set_bit_size(sp3_type[sp3_P_x_coordinate], 64);
     coda_type_set_description(sp3_type[sp3_P_x_coordinate], "x coordinate");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_P_x_coordinate], "km");
 
-    sp3_type[sp3_P_y_coordinate] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_P_y_coordinate] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_y_coordinate], endianness);
     coda_type_set_bit_size(sp3_type[sp3_P_y_coordinate], 64);
     coda_type_set_description(sp3_type[sp3_P_y_coordinate], "y coordinate");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_P_y_coordinate], "km");
 
-    sp3_type[sp3_P_z_coordinate] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_P_z_coordinate] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_z_coordinate], endianness);
     coda_type_set_bit_size(sp3_type[sp3_P_z_coordinate], 64);
     coda_type_set_description(sp3_type[sp3_P_z_coordinate], "z coordinate");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_P_z_coordinate], "km");
 
-    sp3_type[sp3_P_clock] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_P_clock] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_clock], endianness);
     coda_type_set_bit_size(sp3_type[sp3_P_clock], 64);
     coda_type_set_description(sp3_type[sp3_P_clock], "clock");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_P_clock], "1e-6 s");
 
-    sp3_type[sp3_P_x_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_P_x_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_x_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_P_x_sdev], coda_native_type_int8);
     coda_type_set_bit_size(sp3_type[sp3_P_x_sdev], 8);
     coda_type_set_description(sp3_type[sp3_P_x_sdev], "x sdev (b**n mm)");
 
-    sp3_type[sp3_P_y_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_P_y_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_y_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_P_y_sdev], coda_native_type_int8);
     coda_type_set_bit_size(sp3_type[sp3_P_y_sdev], 8);
     coda_type_set_description(sp3_type[sp3_P_y_sdev], "y sdev (b**n mm)");
 
-    sp3_type[sp3_P_z_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_P_z_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_z_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_P_z_sdev], coda_native_type_int8);
     coda_type_set_bit_size(sp3_type[sp3_P_z_sdev], 8);
     coda_type_set_description(sp3_type[sp3_P_z_sdev], "z sdev (b**n mm)");
 
-    sp3_type[sp3_P_clock_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_P_clock_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_clock_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_P_clock_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_P_clock_sdev], 16);
     coda_type_set_description(sp3_type[sp3_P_clock_sdev], "clock sdev (b**n psec)");
 
-    sp3_type[sp3_P_clock_event_flag] = (coda_type *)coda_type_text_new(coda_format_sp3);
+    sp3_type[sp3_P_clock_event_flag] = (coda_type *)coda_type_text_new(coda_format_binary);
     coda_type_set_byte_size(sp3_type[sp3_P_clock_event_flag], 1);
     coda_type_set_description(sp3_type[sp3_P_clock_event_flag], "Clock Event Flag");
 
-    sp3_type[sp3_P_clock_pred_flag] = (coda_type *)coda_type_text_new(coda_format_sp3);
+    sp3_type[sp3_P_clock_pred_flag] = (coda_type *)coda_type_text_new(coda_format_binary);
     coda_type_set_byte_size(sp3_type[sp3_P_clock_pred_flag], 1);
     coda_type_set_description(sp3_type[sp3_P_clock_pred_flag], "Clock Pred. Flag");
 
-    sp3_type[sp3_P_maneuver_flag] = (coda_type *)coda_type_text_new(coda_format_sp3);
+    sp3_type[sp3_P_maneuver_flag] = (coda_type *)coda_type_text_new(coda_format_binary);
     coda_type_set_byte_size(sp3_type[sp3_P_maneuver_flag], 1);
     coda_type_set_description(sp3_type[sp3_P_maneuver_flag], "Maneuver Flag");
 
-    sp3_type[sp3_P_orbit_pred_flag] = (coda_type *)coda_type_text_new(coda_format_sp3);
+    sp3_type[sp3_P_orbit_pred_flag] = (coda_type *)coda_type_text_new(coda_format_binary);
     coda_type_set_byte_size(sp3_type[sp3_P_orbit_pred_flag], 1);
     coda_type_set_description(sp3_type[sp3_P_orbit_pred_flag], "Orbit Pred. Flag");
 
-    sp3_type[sp3_EP_x_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_x_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_x_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_x_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EP_x_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EP_x_sdev], "x sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EP_x_sdev], "mm");
 
-    sp3_type[sp3_EP_y_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_y_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_y_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_y_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EP_y_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EP_y_sdev], "y sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EP_y_sdev], "mm");
 
-    sp3_type[sp3_EP_z_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_z_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_z_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_z_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EP_z_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EP_z_sdev], "z sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EP_z_sdev], "mm");
 
-    sp3_type[sp3_EP_clock_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_clock_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_clock_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_clock_sdev], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_clock_sdev], 32);
     coda_type_set_description(sp3_type[sp3_EP_clock_sdev], "clock sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EP_clock_sdev], "ps");
 
-    sp3_type[sp3_EP_xy_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_xy_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_xy_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_xy_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_xy_corr], 32);
     coda_type_set_description(sp3_type[sp3_EP_xy_corr], "xy correlation");
 
-    sp3_type[sp3_EP_xz_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_xz_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_xz_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_xz_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_xz_corr], 32);
     coda_type_set_description(sp3_type[sp3_EP_xz_corr], "xz correlation");
 
-    sp3_type[sp3_EP_xc_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_xc_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_xc_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_xc_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_xc_corr], 32);
     coda_type_set_description(sp3_type[sp3_EP_xc_corr], "xc correlation");
 
-    sp3_type[sp3_EP_yz_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_yz_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_yz_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_yz_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_yz_corr], 32);
     coda_type_set_description(sp3_type[sp3_EP_yz_corr], "yz correlation");
 
-    sp3_type[sp3_EP_yc_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_yc_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_yc_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_yc_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_yc_corr], 32);
     coda_type_set_description(sp3_type[sp3_EP_yc_corr], "yc correlation");
 
-    sp3_type[sp3_EP_zc_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_zc_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_zc_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_zc_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_zc_corr], 32);
     coda_type_set_description(sp3_type[sp3_EP_zc_corr], "zc correlation");
 
-    sp3_type[sp3_V_x_velocity] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_V_x_velocity] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_x_velocity], endianness);
     coda_type_set_bit_size(sp3_type[sp3_V_x_velocity], 64);
     coda_type_set_description(sp3_type[sp3_V_x_velocity], "x velocity");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_V_x_velocity], "dm/s");
 
-    sp3_type[sp3_V_y_velocity] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_V_y_velocity] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_y_velocity], endianness);
     coda_type_set_bit_size(sp3_type[sp3_V_y_velocity], 64);
     coda_type_set_description(sp3_type[sp3_V_y_velocity], "y velocity");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_V_y_velocity], "dm/s");
 
-    sp3_type[sp3_V_z_velocity] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_V_z_velocity] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_z_velocity], endianness);
     coda_type_set_bit_size(sp3_type[sp3_V_z_velocity], 64);
     coda_type_set_description(sp3_type[sp3_V_z_velocity], "z velocity");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_V_z_velocity], "dm/s");
 
-    sp3_type[sp3_V_clock_rate] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_V_clock_rate] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_clock_rate], endianness);
     coda_type_set_bit_size(sp3_type[sp3_V_clock_rate], 64);
     coda_type_set_description(sp3_type[sp3_V_clock_rate], "clock rate change");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_V_clock_rate], "1e-10 s/s");
 
-    sp3_type[sp3_V_xvel_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_V_xvel_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_xvel_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_V_xvel_sdev], coda_native_type_int8);
     coda_type_set_bit_size(sp3_type[sp3_V_xvel_sdev], 8);
     coda_type_set_description(sp3_type[sp3_V_xvel_sdev], "xvel sdev (b**n 1e-4 mm/sec)");
 
-    sp3_type[sp3_V_yvel_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_V_yvel_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_yvel_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_V_yvel_sdev], coda_native_type_int8);
     coda_type_set_bit_size(sp3_type[sp3_V_yvel_sdev], 8);
     coda_type_set_description(sp3_type[sp3_V_yvel_sdev], "yvel sdev (b**n 1e-4 mm/sec)");
 
-    sp3_type[sp3_V_zvel_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_V_zvel_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_zvel_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_V_zvel_sdev], coda_native_type_int8);
     coda_type_set_bit_size(sp3_type[sp3_V_zvel_sdev], 8);
     coda_type_set_description(sp3_type[sp3_V_zvel_sdev], "zvel sdev (b**n 1e-4 mm/sec)");
 
-    sp3_type[sp3_V_clkrate_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_V_clkrate_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_clkrate_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_V_clkrate_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_V_clkrate_sdev], 16);
     coda_type_set_description(sp3_type[sp3_V_clkrate_sdev], "clock rate sdev (b**n 1e-4 psec/sec)");
 
-    sp3_type[sp3_EV_xvel_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_xvel_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_xvel_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_xvel_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EV_xvel_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EV_xvel_sdev], "xvel sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EV_xvel_sdev], "1e-4 mm/s)");
 
-    sp3_type[sp3_EV_yvel_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_yvel_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_yvel_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_yvel_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EV_yvel_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EV_yvel_sdev], "yvel sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EV_yvel_sdev], "1e-4 mm/s)");
 
-    sp3_type[sp3_EV_zvel_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_zvel_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_zvel_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_zvel_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EV_zvel_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EV_zvel_sdev], "zvel sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EV_zvel_sdev], "1e-4 mm/s)");
 
-    sp3_type[sp3_EV_clkrate_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_clkrate_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_clkrate_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_clkrate_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EV_clkrate_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EV_clkrate_sdev], "clock rate sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EV_clkrate_sdev], "1e-4 ps/s");
 
-    sp3_type[sp3_EV_xy_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_xy_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_xy_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_xy_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EV_xy_corr], 32);
     coda_type_set_description(sp3_type[sp3_EV_xy_corr], "xy correlation");
 
-    sp3_type[sp3_EV_xz_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_xz_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_xz_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_xz_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EV_xz_corr], 32);
     coda_type_set_description(sp3_type[sp3_EV_xz_corr], "xz correlation");
 
-    sp3_type[sp3_EV_xc_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_xc_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_xc_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_xc_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EV_xc_corr], 32);
     coda_type_set_description(sp3_type[sp3_EV_xc_corr], "xc correlation");
 
-    sp3_type[sp3_EV_yz_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_yz_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_yz_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_yz_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EV_yz_corr], 32);
     coda_type_set_description(sp3_type[sp3_EV_yz_corr], "yz correlation");
 
-    sp3_type[sp3_EV_yc_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_yc_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_yc_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_yc_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EV_yc_corr], 32);
     coda_type_set_description(sp3_type[sp3_EV_yc_corr], "yc correlation");
 
-    sp3_type[sp3_EV_zc_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_zc_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_zc_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_zc_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EV_zc_corr], 32);
@@ -654,7 +656,13 @@ static int sp3_init(void)
     coda_type_record_field_set_type(field, sp3_type[sp3_base_clk_rate]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_header], field);
 
-    sp3_type[sp3_P_corr] = (coda_type *)coda_type_record_new(coda_format_sp3);
+    sp3_type[sp3_has_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
+    coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_has_corr], endianness);
+    coda_type_set_read_type(sp3_type[sp3_has_corr], coda_native_type_uint8);
+    coda_type_set_bit_size(sp3_type[sp3_has_corr], 8);
+    coda_type_set_description(sp3_type[sp3_has_corr], "Indicates whether a correlation record is present");
+
+    sp3_type[sp3_P_corr] = (coda_type *)coda_type_record_new(coda_format_binary);
     field = coda_type_record_field_new("x_sdev");
     coda_type_record_field_set_type(field, sp3_type[sp3_EP_x_sdev]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_P_corr], field);
@@ -686,7 +694,7 @@ static int sp3_init(void)
     coda_type_record_field_set_type(field, sp3_type[sp3_EP_zc_corr]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_P_corr], field);
 
-    sp3_type[sp3_pos_clk] = (coda_type *)coda_type_record_new(coda_format_sp3);
+    sp3_type[sp3_pos_clk] = (coda_type *)coda_type_record_new(coda_format_binary);
     field = coda_type_record_field_new("vehicle_id");
     coda_type_record_field_set_type(field, sp3_type[sp3_vehicle_id]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_pos_clk], field);
@@ -726,16 +734,34 @@ static int sp3_init(void)
     field = coda_type_record_field_new("orbit_pred_flag");
     coda_type_record_field_set_type(field, sp3_type[sp3_P_orbit_pred_flag]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_pos_clk], field);
+    /* the packed data stores the has_corr flag directly after the fixed size fields, followed by the optional corr
+     * record; has_corr is added as the last field so the field indices of the product structure stay unchanged */
+    fixed_bit_size = sp3_type[sp3_pos_clk]->bit_size;
     field = coda_type_record_field_new("corr");
     coda_type_record_field_set_type(field, sp3_type[sp3_P_corr]);
     coda_type_record_field_set_optional(field);
+    expr = NULL;
+    coda_expression_from_string("int(./has_corr) != 0", &expr);
+    coda_type_record_field_set_available_expression(field, expr);
+    sprintf(expr_string, "%ld", (long)(fixed_bit_size + 8));
+    expr = NULL;
+    coda_expression_from_string(expr_string, &expr);
+    coda_type_record_field_set_bit_offset_expression(field, expr);
+    coda_type_record_add_field((coda_type_record *)sp3_type[sp3_pos_clk], field);
+    field = coda_type_record_field_new("has_corr");
+    coda_type_record_field_set_type(field, sp3_type[sp3_has_corr]);
+    coda_type_record_field_set_hidden(field);
+    sprintf(expr_string, "%ld", (long)fixed_bit_size);
+    expr = NULL;
+    coda_expression_from_string(expr_string, &expr);
+    coda_type_record_field_set_bit_offset_expression(field, expr);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_pos_clk], field);
 
     sp3_type[sp3_pos_clk_array] = (coda_type *)coda_type_array_new(coda_format_sp3);
     coda_type_array_add_variable_dimension((coda_type_array *)sp3_type[sp3_pos_clk_array], NULL);
     coda_type_array_set_base_type((coda_type_array *)sp3_type[sp3_pos_clk_array], sp3_type[sp3_pos_clk]);
 
-    sp3_type[sp3_V_corr] = (coda_type *)coda_type_record_new(coda_format_sp3);
+    sp3_type[sp3_V_corr] = (coda_type *)coda_type_record_new(coda_format_binary);
     field = coda_type_record_field_new("xvel_sdev");
     coda_type_record_field_set_type(field, sp3_type[sp3_EV_xvel_sdev]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_V_corr], field);
@@ -767,7 +793,7 @@ static int sp3_init(void)
     coda_type_record_field_set_type(field, sp3_type[sp3_EV_zc_corr]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_V_corr], field);
 
-    sp3_type[sp3_vel_rate] = (coda_type *)coda_type_record_new(coda_format_sp3);
+    sp3_type[sp3_vel_rate] = (coda_type *)coda_type_record_new(coda_format_binary);
     field = coda_type_record_field_new("vehicle_id");
     coda_type_record_field_set_type(field, sp3_type[sp3_vehicle_id]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_vel_rate], field);
@@ -795,9 +821,27 @@ static int sp3_init(void)
     field = coda_type_record_field_new("clkrate_sdev");
     coda_type_record_field_set_type(field, sp3_type[sp3_V_clkrate_sdev]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_vel_rate], field);
+    /* the packed data stores the has_corr flag directly after the fixed size fields, followed by the optional corr
+     * record; has_corr is added as the last field so the field indices of the product structure stay unchanged */
+    fixed_bit_size = sp3_type[sp3_vel_rate]->bit_size;
     field = coda_type_record_field_new("corr");
     coda_type_record_field_set_type(field, sp3_type[sp3_V_corr]);
     coda_type_record_field_set_optional(field);
+    expr = NULL;
+    coda_expression_from_string("int(./has_corr) != 0", &expr);
+    coda_type_record_field_set_available_expression(field, expr);
+    sprintf(expr_string, "%ld", (long)(fixed_bit_size + 8));
+    expr = NULL;
+    coda_expression_from_string(expr_string, &expr);
+    coda_type_record_field_set_bit_offset_expression(field, expr);
+    coda_type_record_add_field((coda_type_record *)sp3_type[sp3_vel_rate], field);
+    field = coda_type_record_field_new("has_corr");
+    coda_type_record_field_set_type(field, sp3_type[sp3_has_corr]);
+    coda_type_record_field_set_hidden(field);
+    sprintf(expr_string, "%ld", (long)fixed_bit_size);
+    expr = NULL;
+    coda_expression_from_string(expr_string, &expr);
+    coda_type_record_field_set_bit_offset_expression(field, expr);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_vel_rate], field);
 
     sp3_type[sp3_vel_rate_array] = (coda_type *)coda_type_array_new(coda_format_sp3);
@@ -851,37 +895,47 @@ void coda_sp3_done(void)
     sp3_type = NULL;
 }
 
-static int get_line(FILE *f, char *line)
+static int get_line(ingest_info *info, char *line)
 {
+    const char *start;
+    const char *end;
     long length;
 
-    if (fgets(line, MAX_LINE_LENGTH, f) == NULL)
+    if (info->buffer_offset >= info->buffer_size)
     {
-        if (ferror(f))
-        {
-            coda_set_error(CODA_ERROR_FILE_READ, "could not read from file (%s)", strerror(errno));
-            return -1;
-        }
         /* end of file -> return empty line  */
         line[0] = '\0';
         return 0;
     }
-    length = strlen(line);
 
-    /* remove 'linefeed' character if available */
-    if (length > 0 && line[length - 1] == '\n')
+    /* lines longer than the maximum line length get split (similar to what fgets() would do) */
+    start = &info->buffer[info->buffer_offset];
+    length = info->buffer_size - info->buffer_offset;
+    if (length > MAX_LINE_LENGTH - 1)
     {
-        line[length - 1] = '\0';
-        length--;
+        length = MAX_LINE_LENGTH - 1;
+    }
+    end = memchr(start, '\n', (size_t)length);
+    if (end != NULL)
+    {
+        length = (long)(end - start);
+        /* skip the 'linefeed' character */
+        info->buffer_offset += length + 1;
+    }
+    else
+    {
+        info->buffer_offset += length;
     }
 
     /* remove 'carriage return' character if available */
-    if (length > 0 && line[length - 1] == '\r')
+    if (length > 0 && start[length - 1] == '\r')
     {
-        line[length - 1] = '\0';
         length--;
     }
 
+    memcpy(line, start, (size_t)length);
+    line[length] = '\0';
+
     return length;
 }
 
@@ -898,9 +952,9 @@ static int read_header(ingest_info *info)
     int i;
 
     /* First Line */
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -958,9 +1012,9 @@ static int read_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "agency", value, 0);
 
     /* Line Two */
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -1024,9 +1078,9 @@ static int read_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "frac_day", value, 0);
 
     /* Line Three to Seven */
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -1060,9 +1114,9 @@ static int read_header(ingest_info *info)
         if (i % 17 == 0 && i > 0)
         {
             /* read next line */
-            info->offset = ftell(info->f);
+            info->offset = info->buffer_offset;
             info->linenumber++;
-            linelength = get_line(info->f, line);
+            linelength = get_line(info, line);
             if (linelength < 0)
             {
                 coda_dynamic_type_delete(array);
@@ -1101,9 +1155,9 @@ static int read_header(ingest_info *info)
         if (i % 17 == 0)
         {
             /* read next line */
-            info->offset = ftell(info->f);
+            info->offset = info->buffer_offset;
             info->linenumber++;
-            linelength = get_line(info->f, line);
+            linelength = get_line(info, line);
             if (linelength < 0)
             {
                 coda_dynamic_type_delete(array);
@@ -1140,9 +1194,9 @@ static int read_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "sat_accuracy", array, 0);
 
     /* Line Thirteen */
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -1173,9 +1227,9 @@ static int read_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "time_system", value, 0);
 
     /* Line Fourteen */
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -1194,9 +1248,9 @@ static int read_header(ingest_info *info)
     }
 
     /* Line Fifteen */
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -1235,9 +1289,9 @@ static int read_header(ingest_info *info)
     /* Line Sixteen to Twenty two */
     for (i = 0; i < 7; i++)
     {
-        info->offset = ftell(info->f);
+        info->offset = info->buffer_offset;
         info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_line(info, line);
         if (linelength < 0)
         {
             return -1;
@@ -1247,19 +1301,150 @@ static int read_header(ingest_info *info)
     return 0;
 }
 
+static void pack_text(uint8_t *data, long *offset, const char *str, long length)
+{
+    memcpy(&data[*offset], str, length);
+    *offset += length;
+}
+
+static void pack_int8(uint8_t *data, long *offset, int8_t value)
+{
+    data[*offset] = (uint8_t)value;
+    *offset += 1;
+}
+
+static void pack_int16(uint8_t *data, long *offset, int16_t value)
+{
+    memcpy(&data[*offset], &value, 2);
+    *offset += 2;
+}
+
+static void pack_int32(uint8_t *data, long *offset, int32_t value)
+{
+    memcpy(&data[*offset], &value, 4);
+    *offset += 4;
+}
+
+static void pack_double(uint8_t *data, long *offset, double value)
+{
+    memcpy(&data[*offset], &value, 8);
+    *offset += 8;
+}
+
+/* parse an integer field that may be blank or may be missing at the end of the line (which results in a value of 0) */
+static int parse_optional_int(ingest_info *info, const char *line, long linelength, long offset, long length,
+                              int64_t *value)
+{
+    long i;
+
+    if (linelength >= offset + length)
+    {
+        for (i = 0; i < length; i++)
+        {
+            if (line[offset + i] != ' ')
+            {
+                if (coda_ascii_parse_int64(&line[offset], length, value, 0) < 0)
+                {
+                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + offset);
+                    return -1;
+                }
+                return 0;
+            }
+        }
+    }
+    *value = 0;
+
+    return 0;
+}
+
+/* parse the four F14.6 values (x, y, z, clock) of a Position and Clock or Velocity and Rate Record */
+static int parse_pos_vel_values(ingest_info *info, const char *line, uint8_t *data, long *offset)
+{
+    double double_value;
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        if (coda_ascii_parse_double(&line[4 + i * 14], 14, &double_value, 0) < 0)
+        {
+            coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 4 + i * 14);
+            return -1;
+        }
+        pack_double(data, offset, double_value);
+    }
+
+    return 0;
+}
+
+/* parse the content of an EP or EV correlation record (the layout of both record types is the same) */
+static int parse_corr(ingest_info *info, const char *line, long linelength, uint8_t *data, long *offset)
+{
+    int64_t int_value;
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        if (parse_optional_int(info, line, linelength, 4 + i * 5, 4, &int_value) != 0)
+        {
+            return -1;
+        }
+        pack_int16(data, offset, (int16_t)int_value);
+    }
+    if (parse_optional_int(info, line, linelength, 19, 7, &int_value) != 0)
+    {
+        return -1;
+    }
+    if (line[1] == 'P')
+    {
+        pack_int32(data, offset, (int32_t)int_value);
+    }
+    else
+    {
+        pack_int16(data, offset, (int16_t)int_value);
+    }
+    for (i = 0; i < 6; i++)
+    {
+        if (parse_optional_int(info, line, linelength, 27 + i * 9, 8, &int_value) != 0)
+        {
+            return -1;
+        }
+        pack_int32(data, offset, (int32_t)int_value);
+    }
+
+    return 0;
+}
+
+static int add_packed_record(ingest_info *info, coda_type *definition, coda_mem_array *array, const uint8_t *data,
+                             long length)
+{
+    coda_dynamic_type *element;
+
+    element = (coda_dynamic_type *)coda_mem_data_new(definition, NULL, info->product, length, data);
+    if (element == NULL)
+    {
+        return -1;
+    }
+    if (coda_mem_array_add_element(array, element) != 0)
+    {
+        coda_dynamic_type_delete(element);
+        return -1;
+    }
+
+    return 0;
+}
+
 static int read_records(ingest_info *info)
 {
     coda_dynamic_type *base_type;
     coda_dynamic_type *value;
     char line[MAX_LINE_LENGTH];
-    double double_value;
     int64_t int_value;
     char str[61];
     long linelength;
 
-    info->offset = ftell(info->f);
+    info->offset = info->buffer_offset;
     info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -1301,13 +1486,14 @@ static int read_records(ingest_info *info)
         }
         else if (line[0] == 'P')
         {
+            long length = 0;
+
             if (info->pos_clk_array == NULL)
             {
                 coda_set_error(CODA_ERROR_FILE_READ, "Position and Clock Record without Epoch Header Record "
                                "(line: %ld, byte offset: %ld)", info->linenumber, info->offset);
                 return -1;
             }
-            info->pos_clk = coda_mem_record_new((coda_type_record *)sp3_type[sp3_pos_clk], NULL);
 
             if (linelength < 60)
             {
@@ -1316,123 +1502,54 @@ static int read_records(ingest_info *info)
                 return -1;
             }
 
-            memcpy(str, &line[1], 3);
-            str[3] = '\0';
-            value = (coda_dynamic_type *)coda_mem_string_new((coda_type_text *)sp3_type[sp3_vehicle_id], NULL,
-                                                             info->product, str);
-            coda_mem_record_add_field(info->pos_clk, "vehicle_id", value, 0);
+            /* vehicle_id */
+            pack_text(info->pos_clk, &length, &line[1], 3);
 
-            if (coda_ascii_parse_double(&line[4], 14, &double_value, 0) < 0)
+            /* x_coordinate, y_coordinate, z_coordinate, clock */
+            if (parse_pos_vel_values(info, line, info->pos_clk, &length) != 0)
             {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 4);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_P_x_coordinate], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->pos_clk, "x_coordinate", value, 0);
 
-            if (coda_ascii_parse_double(&line[18], 14, &double_value, 0) < 0)
+            /* x_sdev, y_sdev, z_sdev */
+            if (parse_optional_int(info, line, linelength, 61, 2, &int_value) != 0)
             {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 18);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_P_y_coordinate], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->pos_clk, "y_coordinate", value, 0);
-
-            if (coda_ascii_parse_double(&line[32], 14, &double_value, 0) < 0)
+            pack_int8(info->pos_clk, &length, (int8_t)int_value);
+            if (parse_optional_int(info, line, linelength, 64, 2, &int_value) != 0)
             {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 32);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_P_z_coordinate], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->pos_clk, "z_coordinate", value, 0);
-
-            if (coda_ascii_parse_double(&line[46], 14, &double_value, 0) < 0)
+            pack_int8(info->pos_clk, &length, (int8_t)int_value);
+            if (parse_optional_int(info, line, linelength, 67, 2, &int_value) != 0)
             {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 46);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_P_clock], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->pos_clk, "clock", value, 0);
+            pack_int8(info->pos_clk, &length, (int8_t)int_value);
 
-            if (linelength < 64 || memcmp(&line[61], "  ", 2) == 0)
-            {
-                int_value = 0;
-            }
-            else if (coda_ascii_parse_int64(&line[61], 2, &int_value, 0) < 0)
+            /* clock_sdev */
+            if (parse_optional_int(info, line, linelength, 70, 3, &int_value) != 0)
             {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 61);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_int8_new((coda_type_number *)sp3_type[sp3_P_x_sdev], NULL,
-                                                           info->product, (int8_t)int_value);
-            coda_mem_record_add_field(info->pos_clk, "x_sdev", value, 0);
+            pack_int16(info->pos_clk, &length, (int16_t)int_value);
 
-            if (linelength < 66 || memcmp(&line[64], "  ", 2) == 0)
-            {
-                int_value = 0;
-            }
-            else if (coda_ascii_parse_int64(&line[64], 2, &int_value, 0) < 0)
-            {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 64);
-                return -1;
-            }
-            value = (coda_dynamic_type *)coda_mem_int8_new((coda_type_number *)sp3_type[sp3_P_y_sdev], NULL,
-                                                           info->product, (int8_t)int_value);
-            coda_mem_record_add_field(info->pos_clk, "y_sdev", value, 0);
+            /* clock_event_flag, clock_pred_flag, maneuver_flag, orbit_pred_flag */
+            pack_text(info->pos_clk, &length, linelength < 75 ? " " : &line[74], 1);
+            pack_text(info->pos_clk, &length, linelength < 76 ? " " : &line[75], 1);
+            pack_text(info->pos_clk, &length, linelength < 79 ? " " : &line[78], 1);
+            pack_text(info->pos_clk, &length, linelength < 80 ? " " : &line[79], 1);
 
-            if (linelength < 69 || memcmp(&line[67], "  ", 2) == 0)
-            {
-                int_value = 0;
-            }
-            else if (coda_ascii_parse_int64(&line[67], 2, &int_value, 0) < 0)
-            {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 67);
-                return -1;
-            }
-            value = (coda_dynamic_type *)coda_mem_int8_new((coda_type_number *)sp3_type[sp3_P_z_sdev], NULL,
-                                                           info->product, (int8_t)int_value);
-            coda_mem_record_add_field(info->pos_clk, "z_sdev", value, 0);
+            /* has_corr (will be updated if a correlation record follows) */
+            pack_int8(info->pos_clk, &length, 0);
 
-            if (linelength < 73 || memcmp(&line[70], "   ", 3) == 0)
-            {
-                int_value = 0;
-            }
-            else if (coda_ascii_parse_int64(&line[70], 3, &int_value, 0) < 0)
-            {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 70);
-                return -1;
-            }
-            value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_P_clock_sdev], NULL,
-                                                            info->product, (int16_t)int_value);
-            coda_mem_record_add_field(info->pos_clk, "clock_sdev", value, 0);
-
-            str[0] = linelength < 75 ? ' ' : line[74];
-            str[1] = '\0';
-            value = (coda_dynamic_type *)coda_mem_string_new((coda_type_text *)sp3_type[sp3_P_clock_event_flag], NULL,
-                                                             info->product, str);
-            coda_mem_record_add_field(info->pos_clk, "clock_event_flag", value, 0);
-
-            str[0] = linelength < 76 ? ' ' : line[75];
-            value = (coda_dynamic_type *)coda_mem_string_new((coda_type_text *)sp3_type[sp3_P_clock_pred_flag], NULL,
-                                                             info->product, str);
-            coda_mem_record_add_field(info->pos_clk, "clock_pred_flag", value, 0);
-
-            str[0] = linelength < 79 ? ' ' : line[78];
-            value = (coda_dynamic_type *)coda_mem_string_new((coda_type_text *)sp3_type[sp3_P_maneuver_flag], NULL,
-                                                             info->product, str);
-            coda_mem_record_add_field(info->pos_clk, "maneuver_flag", value, 0);
-
-            str[0] = linelength < 80 ? ' ' : line[79];
-            value = (coda_dynamic_type *)coda_mem_string_new((coda_type_text *)sp3_type[sp3_P_orbit_pred_flag], NULL,
-                                                             info->product, str);
-            coda_mem_record_add_field(info->pos_clk, "orbit_pred_flag", value, 0);
+            info->pos_clk_length = length;
         }
         else if (line[0] == 'V')
         {
+            long length = 0;
+
             if (info->posvel != 'V')
             {
                 coda_set_error(CODA_ERROR_FILE_READ, "Velocity and Rate Record not allowed due to header Position/"
@@ -1445,7 +1562,6 @@ static int read_records(ingest_info *info)
                                "(line: %ld, byte offset: %ld)", info->linenumber, info->offset);
                 return -1;
             }
-            info->vel_rate = coda_mem_record_new((coda_type_record *)sp3_type[sp3_vel_rate], NULL);
 
             if (linelength < 60)
             {
@@ -1454,99 +1570,43 @@ static int read_records(ingest_info *info)
                 return -1;
             }
 
-            memcpy(str, &line[1], 3);
-            str[3] = '\0';
-            value = (coda_dynamic_type *)coda_mem_string_new((coda_type_text *)sp3_type[sp3_vehicle_id], NULL,
-                                                             info->product, str);
-            coda_mem_record_add_field(info->vel_rate, "vehicle_id", value, 0);
+            /* vehicle_id */
+            pack_text(info->vel_rate, &length, &line[1], 3);
 
-            if (coda_ascii_parse_double(&line[4], 14, &double_value, 0) < 0)
+            /* x_velocity, y_velocity, z_velocity, clock_rate */
+            if (parse_pos_vel_values(info, line, info->vel_rate, &length) != 0)
             {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 4);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_V_x_velocity], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->vel_rate, "x_velocity", value, 0);
 
-            if (coda_ascii_parse_double(&line[18], 14, &double_value, 0) < 0)
+            /* xvel_sdev, yvel_sdev, zvel_sdev */
+            if (parse_optional_int(info, line, linelength, 61, 2, &int_value) != 0)
             {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 18);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_V_y_velocity], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->vel_rate, "y_velocity", value, 0);
-
-            if (coda_ascii_parse_double(&line[32], 14, &double_value, 0) < 0)
+            pack_int8(info->vel_rate, &length, (int8_t)int_value);
+            if (parse_optional_int(info, line, linelength, 64, 2, &int_value) != 0)
             {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 32);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_V_z_velocity], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->vel_rate, "z_velocity", value, 0);
-
-            if (coda_ascii_parse_double(&line[46], 14, &double_value, 0) < 0)
+            pack_int8(info->vel_rate, &length, (int8_t)int_value);
+            if (parse_optional_int(info, line, linelength, 67, 2, &int_value) != 0)
             {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 46);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_V_clock_rate], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->vel_rate, "clock_rate", value, 0);
+            pack_int8(info->vel_rate, &length, (int8_t)int_value);
 
-            if (linelength < 63 || memcmp(&line[61], "  ", 2) == 0)
+            /* clkrate_sdev */
+            if (parse_optional_int(info, line, linelength, 70, 3, &int_value) != 0)
             {
-                int_value = 0;
-            }
-            else if (coda_ascii_parse_int64(&line[61], 2, &int_value, 0) < 0)
-            {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 61);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_int8_new((coda_type_number *)sp3_type[sp3_V_xvel_sdev], NULL,
-                                                           info->product, (int8_t)int_value);
-            coda_mem_record_add_field(info->vel_rate, "xvel_sdev", value, 0);
+            pack_int16(info->vel_rate, &length, (int16_t)int_value);
 
-            if (linelength < 66 || memcmp(&line[64], "  ", 2) == 0)
-            {
-                int_value = 0;
-            }
-            else if (coda_ascii_parse_int64(&line[64], 2, &int_value, 0) < 0)
-            {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 64);
-                return -1;
-            }
-            value = (coda_dynamic_type *)coda_mem_int8_new((coda_type_number *)sp3_type[sp3_V_yvel_sdev], NULL,
-                                                           info->product, (int8_t)int_value);
-            coda_mem_record_add_field(info->vel_rate, "yvel_sdev", value, 0);
+            /* has_corr (will be updated if a correlation record follows) */
+            pack_int8(info->vel_rate, &length, 0);
 
-            if (linelength < 69 || memcmp(&line[67], "  ", 2) == 0)
-            {
-                int_value = 0;
-            }
-            else if (coda_ascii_parse_int64(&line[67], 2, &int_value, 0) < 0)
-            {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 67);
-                return -1;
-            }
-            value = (coda_dynamic_type *)coda_mem_int8_new((coda_type_number *)sp3_type[sp3_V_zvel_sdev], NULL,
-                                                           info->product, (int8_t)int_value);
-            coda_mem_record_add_field(info->vel_rate, "zvel_sdev", value, 0);
-
-            if (linelength < 73 || memcmp(&line[70], "   ", 3) == 0)
-            {
-                int_value = 0;
-            }
-            else if (coda_ascii_parse_int64(&line[70], 3, &int_value, 0) < 0)
-            {
-                coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 70);
-                return -1;
-            }
-            value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_V_clkrate_sdev], NULL,
-                                                            info->product, (int16_t)int_value);
-            coda_mem_record_add_field(info->vel_rate, "clkrate_sdev", value, 0);
+            info->vel_rate_length = length;
         }
         else
         {
@@ -1555,9 +1615,9 @@ static int read_records(ingest_info *info)
             return -1;
         }
 
-        info->offset = ftell(info->f);
+        info->offset = info->buffer_offset;
         info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_line(info, line);
         if (linelength < 0)
         {
             return -1;
@@ -1567,308 +1627,58 @@ static int read_records(ingest_info *info)
         {
             if (line[1] == 'P')
             {
-                if (info->pos_clk == NULL)
+                if (info->pos_clk_length == 0)
                 {
                     coda_set_error(CODA_ERROR_FILE_READ, "Position and Clock Correlation Record without Position and "
                                    "Clock Record (line: %ld, byte offset: %ld)", info->linenumber, info->offset);
                     return -1;
                 }
-                info->corr = coda_mem_record_new((coda_type_record *)sp3_type[sp3_P_corr], NULL);
-
-                if (linelength < 8 || memcmp(&line[4], "    ", 4) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[4], 4, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 4);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EP_x_sdev], NULL,
-                                                                info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "x_sdev", value, 0);
-
-                if (linelength < 13 || memcmp(&line[9], "    ", 4) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[9], 4, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 9);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EP_y_sdev], NULL,
-                                                                info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "y_sdev", value, 0);
-
-                if (linelength < 18 || memcmp(&line[14], "    ", 4) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[14], 4, &int_value, 0) < 0)
+                info->pos_clk[info->pos_clk_length - 1] = 1;
+                if (parse_corr(info, line, linelength, info->pos_clk, &info->pos_clk_length) != 0)
                 {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 14);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EP_z_sdev], NULL,
-                                                                info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "z_sdev", value, 0);
-
-                if (linelength < 26 || memcmp(&line[19], "       ", 7) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[19], 7, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 19);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_clock_sdev], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "clock_sdev", value, 0);
-
-                if (linelength < 35 || memcmp(&line[27], "        ", 8) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[27], 8, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 27);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_xy_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "xy_corr", value, 0);
-
-                if (linelength < 44 || memcmp(&line[36], "        ", 8) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[36], 8, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 36);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_xz_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "xz_corr", value, 0);
-
-                if (linelength < 53 || memcmp(&line[45], "        ", 8) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[45], 8, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 45);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_xc_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "xc_corr", value, 0);
-
-                if (linelength < 62 || memcmp(&line[54], "        ", 8) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[54], 8, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 54);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_yz_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "yz_corr", value, 0);
-
-                if (linelength < 71 || memcmp(&line[63], "        ", 8) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[63], 8, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 63);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_yc_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "yc_corr", value, 0);
-
-                if (linelength < 80 || memcmp(&line[72], "        ", 8) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[72], 8, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 72);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_zc_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "zc_corr", value, 0);
-
-                coda_mem_record_add_field(info->pos_clk, "corr", (coda_dynamic_type *)info->corr, 0);
-                info->corr = NULL;
             }
             else
             {
-                if (info->vel_rate == NULL)
+                if (info->vel_rate_length == 0)
                 {
                     coda_set_error(CODA_ERROR_FILE_READ, "Velocity and Rate Correlation Record without Velocity and "
                                    "Rate Record (line: %ld, byte offset: %ld)", info->linenumber, info->offset);
                     return -1;
                 }
-                info->corr = coda_mem_record_new((coda_type_record *)sp3_type[sp3_V_corr], NULL);
-
-                if (linelength < 8 || memcmp(&line[4], "    ", 4) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[4], 4, &int_value, 0) < 0)
+                info->vel_rate[info->vel_rate_length - 1] = 1;
+                if (parse_corr(info, line, linelength, info->vel_rate, &info->vel_rate_length) != 0)
                 {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 4);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EV_xvel_sdev], NULL,
-                                                                info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "xvel_sdev", value, 0);
-
-                if (linelength < 13 || memcmp(&line[9], "    ", 4) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[9], 4, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 9);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EV_yvel_sdev], NULL,
-                                                                info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "yvel_sdev", value, 0);
-
-                if (linelength < 18 || memcmp(&line[14], "    ", 4) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[14], 4, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 14);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EV_zvel_sdev], NULL,
-                                                                info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "zvel_sdev", value, 0);
-
-                if (linelength < 28 || memcmp(&line[19], "       ", 7) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[19], 7, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 19);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EV_clkrate_sdev],
-                                                                NULL, info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "clkrate_sdev", value, 0);
-
-                if (linelength < 35 || memcmp(&line[27], "        ", 8) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[27], 8, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 27);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EV_xy_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "xy_corr", value, 0);
-
-                if (linelength < 44 || memcmp(&line[36], "        ", 8) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[36], 8, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 36);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EV_xz_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "xz_corr", value, 0);
-
-                if (linelength < 53 || memcmp(&line[45], "        ", 8) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[45], 8, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 45);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EV_xc_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "xc_corr", value, 0);
-
-                if (linelength < 62 || memcmp(&line[54], "        ", 8) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[54], 8, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 54);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EV_yz_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "yz_corr", value, 0);
-
-                if (linelength < 71 || memcmp(&line[63], "        ", 8) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[63], 8, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 63);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EV_yc_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "yc_corr", value, 0);
-
-                if (linelength < 80 || memcmp(&line[72], "        ", 8) == 0)
-                {
-                    int_value = 0;
-                }
-                else if (coda_ascii_parse_int64(&line[72], 8, &int_value, 0) < 0)
-                {
-                    coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 72);
-                    return -1;
-                }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EV_zc_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "zc_corr", value, 0);
-
-                coda_mem_record_add_field(info->vel_rate, "corr", (coda_dynamic_type *)info->corr, 0);
-                info->corr = NULL;
             }
-            info->offset = ftell(info->f);
+            info->offset = info->buffer_offset;
             info->linenumber++;
-            linelength = get_line(info->f, line);
+            linelength = get_line(info, line);
             if (linelength < 0)
             {
                 return -1;
             }
         }
 
-        if (info->pos_clk != NULL)
+        if (info->pos_clk_length > 0)
         {
-            coda_mem_array_add_element(info->pos_clk_array, (coda_dynamic_type *)info->pos_clk);
-            info->pos_clk = NULL;
+            if (add_packed_record(info, sp3_type[sp3_pos_clk], info->pos_clk_array, info->pos_clk,
+                                  info->pos_clk_length) != 0)
+            {
+                return -1;
+            }
+            info->pos_clk_length = 0;
         }
-        if (info->vel_rate != NULL)
+        if (info->vel_rate_length > 0)
         {
-            coda_mem_array_add_element(info->vel_rate_array, (coda_dynamic_type *)info->vel_rate);
-            info->vel_rate = NULL;
+            if (add_packed_record(info, sp3_type[sp3_vel_rate], info->vel_rate_array, info->vel_rate,
+                                  info->vel_rate_length) != 0)
+            {
+                return -1;
+            }
+            info->vel_rate_length = 0;
         }
     }
 
@@ -1885,7 +1695,7 @@ static int read_records(ingest_info *info)
     return 0;
 }
 
-static int read_file(coda_product *product)
+static int read_file(coda_product *product, coda_product *raw_product)
 {
     coda_mem_record *root_type = NULL;
     ingest_info info;
@@ -1893,11 +1703,30 @@ static int read_file(coda_product *product)
     ingest_info_init(&info);
     info.product = product;
 
-    info.f = fopen(product->filename, "r");
-    if (info.f == NULL)
+    /* we parse directly from the memory mapped file if possible, otherwise we read the full file into memory */
+    info.buffer_size = (long)raw_product->file_size;
+    if (raw_product->mem_ptr != NULL)
     {
-        coda_set_error(CODA_ERROR_FILE_OPEN, "could not open file %s", product->filename);
-        return -1;
+        info.buffer = (const char *)raw_product->mem_ptr;
+    }
+    else if (info.buffer_size > 0)
+    {
+        char *buffer;
+
+        buffer = malloc((size_t)info.buffer_size);
+        if (buffer == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)info.buffer_size, __FILE__, __LINE__);
+            return -1;
+        }
+        info.buffer = buffer;
+        info.free_buffer = 1;
+        if (read_bytes(raw_product, 0, info.buffer_size, buffer) != 0)
+        {
+            ingest_info_cleanup(&info);
+            return -1;
+        }
     }
 
     info.header = coda_mem_record_new((coda_type_record *)sp3_type[sp3_header], NULL);
@@ -1967,15 +1796,16 @@ int coda_sp3_reopen(coda_product **product)
         return -1;
     }
 
-    coda_close(*product);
-
     /* create root type */
-    if (read_file(product_file) != 0)
+    if (read_file(product_file, *product) != 0)
     {
         coda_close(product_file);
+        coda_close(*product);
         return -1;
     }
 
+    coda_close(*product);
+
     *product = (coda_product *)product_file;
 
     return 0;
@@ -1992,6 +1822,10 @@ int coda_sp3_close(coda_product *product)
     {
         free(product->filename);
     }
+    if (product->mem_ptr != NULL)
+    {
+        free(product->mem_ptr);
+    }
 
     free(product);
 
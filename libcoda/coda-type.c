@@ -1304,9 +1304,11 @@ int coda_type_record_insert_field(coda_type_record *type, long index, coda_type_
 
     if (type->format != field->type->format)
     {
-        /* we only allow switching from binary or xml to ascii */
+        /* we only allow switching from binary or xml to ascii and from rinex or sp3 to binary */
         if (!(field->type->format == coda_format_ascii &&
-              (type->format == coda_format_binary || type->format == coda_format_xml)))
+              (type->format == coda_format_binary || type->format == coda_format_xml)) &&
+            !(field->type->format == coda_format_binary &&
+              (type->format == coda_format_rinex || type->format == coda_format_sp3)))
         {
             coda_set_error(CODA_ERROR_DATA_DEFINITION, "cannot add field with %s format to record with %s format",
                            coda_type_get_format_name(field->type->format), coda_type_get_format_name(type->format));
@@ -1617,9 +1619,11 @@ int coda_type_array_set_base_type(coda_type_array *type, coda_type *base_type)
     }
     if (type->format != base_type->format)
     {
-        /* we only allow switching from binary or xml to ascii */
+        /* we only allow switching from binary or xml to ascii and from rinex or sp3 to binary */
         if (!(base_type->format == coda_format_ascii &&
-              (type->format == coda_format_binary || type->format == coda_format_xml)))
+              (type->format == coda_format_binary || type->format == coda_format_xml)) &&
+            !(base_type->format == coda_format_binary &&
+              (type->format == coda_format_rinex || type->format == coda_format_sp3)))
         {
             coda_set_error(CODA_ERROR_DATA_DEFINITION, "cannot add element with %s format to array with %s format",
                            coda_type_get_format_name(base_type->format), coda_type_get_format_name(type->format));
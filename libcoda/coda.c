@@ -94,6 +94,9 @@ int coda_option_bypass_special_types = 0;
 int coda_option_perform_boundary_checks = 1;
 int coda_option_perform_conversions = 1;
 int coda_option_read_all_definitions = 0;
+int coda_option_read_cache_block_size = 65536;
+int coda_option_read_cache_num_blocks = 16;
+int coda_option_product_cache_size = 0;
 int coda_option_use_fast_size_expressions = 1;
 int coda_option_use_mmap = 1;
 
@@ -329,6 +332,127 @@ LIBCODA_API int coda_get_option_use_mmap(void)
     return coda_option_use_mmap;
 }
 
+/** Set the size of the blocks of the read cache.
+ * When memory mapping is disabled (see coda_set_option_use_mmap()) CODA reads data from structured ascii and binary
+ * files (and from the files of some other formats, such as netCDF 3) using a cache of file blocks for each product.
+ * All blocks are aligned to a multiple of the block size within the file. Reads that are larger than a block are
+ * performed directly on the file. If the blocks of a file are accessed sequentially, CODA will read ahead several
+ * blocks at once.
+ *
+ * The default block size is 64KB.
+ *
+ * \note The new setting will only be applicable for files that will be opened after you changed the option.
+ *
+ * \param block_size Size of a cache block in bytes (should be > 0).
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_set_option_read_cache_block_size(int block_size)
+{
+    if (block_size <= 0)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "block_size argument (%d) is not valid", block_size);
+        return -1;
+    }
+
+    coda_option_read_cache_block_size = block_size;
+
+    return 0;
+}
+
+/** Retrieve the current setting for the block size of the read cache.
+ * \see coda_set_option_read_cache_block_size()
+ * \return The size of a block of the read cache in bytes.
+ */
+LIBCODA_API int coda_get_option_read_cache_block_size(void)
+{
+    return coda_option_read_cache_block_size;
+}
+
+/** Set the maximum number of blocks in the read cache.
+ * This sets the capacity of the per-product read cache that is used when memory mapping is disabled (see
+ * coda_set_option_read_cache_block_size()). When the cache is full, the least recently used block will be replaced.
+ * Setting the number of blocks to 0 disables the read cache, in which case each read results in a read of the file.
+ *
+ * The default number of blocks is 16.
+ *
+ * \note The new setting will only be applicable for files that will be opened after you changed the option.
+ *
+ * \param num_blocks Number of blocks in the cache (should be >= 0).
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_set_option_read_cache_num_blocks(int num_blocks)
+{
+    if (num_blocks < 0)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "num_blocks argument (%d) is not valid", num_blocks);
+        return -1;
+    }
+
+    coda_option_read_cache_num_blocks = num_blocks;
+
+    return 0;
+}
+
+/** Retrieve the current setting for the maximum number of blocks in the read cache.
+ * \see coda_set_option_read_cache_num_blocks()
+ * \return The maximum number of blocks in the read cache.
+ */
+LIBCODA_API int coda_get_option_read_cache_num_blocks(void)
+{
+    return coda_option_read_cache_num_blocks;
+}
+
+/** Set the maximum number of products in the product cache.
+ * If the product cache is enabled (i.e. the size is > 0), coda_open() will reuse the opened product when a file is
+ * opened that is still open, or that was closed but is still in the cache. This avoids the repeated format detection,
+ * definition matching, and reading of file headers for applications that open the same files over and over again.
+ * Each coda_open() call still returns its own product handle. The handles for the same file share the parsed product
+ * information, but each handle has its own file access state (file descriptor, memory mapping, read cache, and access
+ * pattern). A handle can therefore be used independently of the other handles for the same file.
+ * A cached product is only reused if the path, size, modification time, and inode number of the file are unchanged.
+ * When the cache is full, the least recently used product for which no handles are open anymore will be closed.
+ * Products that are opened with coda_open_as() or coda_open_from_memory() are never cached.
+ * Setting the size to 0 disables the product cache (and closes all cached products for which no handles are open).
+ *
+ * The default cache size is 0.
+ *
+ * A cached product is only shared between coda_open() calls for which the memory mapping and read cache options (see
+ * coda_set_option_use_mmap(), coda_set_option_read_cache_block_size(), and coda_set_option_read_cache_num_blocks())
+ * are the same. Opening a file with different options results in a separately opened product.
+ * HDF4 and HDF5 products are never cached.
+ *
+ * \param num_products Maximum number of products in the cache (should be >= 0).
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_set_option_product_cache_size(int num_products)
+{
+    if (num_products < 0)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "num_products argument (%d) is not valid", num_products);
+        return -1;
+    }
+
+    coda_option_product_cache_size = num_products;
+    coda_product_cache_trim();
+
+    return 0;
+}
+
+/** Retrieve the current setting for the maximum number of products in the product cache.
+ * \see coda_set_option_product_cache_size()
+ * \return The maximum number of products in the product cache.
+ */
+LIBCODA_API int coda_get_option_product_cache_size(void)
+{
+    return coda_option_product_cache_size;
+}
+
 
 static char *coda_definition_path = NULL;
 
@@ -470,6 +594,11 @@ LIBCODA_API int coda_set_definition_path_conditional(const char *file, const cha
  * file), you will have the set the CODA definition path to the location of your .codadef files before you call
  * coda_init(). This can be done either via coda_set_definition_path() or via the CODA_DEFINITION environment variable.
  *
+ * If the CODA_DEFINITION_CACHE environment variable is set to the path of an existing directory, CODA will store a
+ * binary cache of the index of each .codadef file in this directory and will use this cache (instead of parsing the
+ * XML content of the .codadef file) on the next call to coda_init(). A cache file is automatically recreated when the
+ * .codadef file changes.
+ *
  * It is valid to perform multiple calls to coda_init() after each other. Only the first call to coda_init() will do
  * the actual initialization and all following calls to coda_init() will only increase an initialization counter (this
  * also means that it is important that you set the CODA definition path before the first call to coda_init() is
@@ -530,6 +659,14 @@ LIBCODA_API int coda_init(void)
             return -1;
         }
 #endif
+        if (coda_mem_init() != 0)
+        {
+            coda_data_dictionary_done();
+            /* don't clear coda_definition_path */
+            coda_type_done();
+            coda_leap_second_table_done();
+            return -1;
+        }
     }
     coda_init_counter++;
 
@@ -559,6 +696,7 @@ LIBCODA_API void coda_done(void)
         coda_init_counter--;
         if (coda_init_counter == 0)
         {
+            coda_product_cache_done();
             coda_sp3_done();
             coda_rinex_done();
             coda_grib_done();
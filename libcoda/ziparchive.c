@@ -435,12 +435,18 @@ long za_get_entry_size(za_entry *entry)
     return entry->uncompressed_size;
 }
 
+unsigned long za_get_entry_crc(za_entry *entry)
+{
+    return entry->crc;
+}
+
 const char *za_get_entry_name(za_entry *entry)
 {
     return entry->filename;
 }
 
-int za_read_entry(za_entry *entry, char *out_buffer)
+/* verify the 'local file header' of an entry and move the file position to the start of the entry data */
+static int read_local_header(za_entry *entry, int64_t *data_offset)
 {
     union
     {
@@ -574,6 +580,30 @@ int za_read_entry(za_entry *entry, char *out_buffer)
         entry->zf->handle_error(strerror(errno));
         return -1;
     }
+    *data_offset = (int64_t)entry->localheader_offset + 30 + filename_length + extrafield_length;
+
+    return 0;
+}
+
+/* get the offset of the (possibly compressed) data of an entry within the zip file */
+int za_get_entry_data_offset(za_entry *entry, int64_t *offset)
+{
+    return read_local_header(entry, offset);
+}
+
+int za_entry_is_compressed(za_entry *entry)
+{
+    return entry->compression != 0;
+}
+
+int za_read_entry(za_entry *entry, char *out_buffer)
+{
+    int64_t data_offset;
+
+    if (read_local_header(entry, &data_offset) != 0)
+    {
+        return -1;
+    }
 
     if (entry->compression == 0)
     {
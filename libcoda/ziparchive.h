@@ -32,13 +32,19 @@
 #ifndef ZIPARCHIVE_H
 #define ZIPARCHIVE_H
 
+/* for definition of int64_t */
+#include "coda.h"
+
 #define za_open coda_za_open
 #define za_get_filename coda_za_get_filename
 #define za_get_num_entries coda_za_get_num_entries
 #define za_get_entry_by_index coda_za_get_entry_by_index
 #define za_get_entry_by_name coda_za_get_entry_by_name
 #define za_get_entry_size coda_za_get_entry_size
+#define za_get_entry_crc coda_za_get_entry_crc
 #define za_get_entry_name coda_za_get_entry_name
+#define za_get_entry_data_offset coda_za_get_entry_data_offset
+#define za_entry_is_compressed coda_za_entry_is_compressed
 #define za_read_entry coda_za_read_entry
 #define za_close coda_za_close
 
@@ -53,7 +59,10 @@ za_entry *za_get_entry_by_index(za_file *zf, long index);
 za_entry *za_get_entry_by_name(za_file *zf, const char *name);
 
 long za_get_entry_size(za_entry *entry);
+unsigned long za_get_entry_crc(za_entry *entry);
 const char *za_get_entry_name(za_entry *entry);
+int za_get_entry_data_offset(za_entry *entry, int64_t *offset);
+int za_entry_is_compressed(za_entry *entry);
 int za_read_entry(za_entry *entry, char *buffer);
 
 void za_close(za_file *zf);
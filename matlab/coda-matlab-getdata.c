@@ -31,10 +31,16 @@
 
 #include "coda-matlab.h"
 
+#include <string.h>
+
 static mxArray *coda_matlab_get_multi_index_data(coda_cursor *base_cursor, int nrhs, const mxArray *prhs[],
                                                  int num_dims, int *index);
 static int coda_matlab_read_data_direct(coda_cursor *cursor, mxArray *mx_data, int index);
 static mxArray *coda_matlab_read_array(coda_cursor *cursor, int num_dims, const long *dim, int num_elements);
+static coda_native_type coda_matlab_get_field_array_read_type(coda_type *record_type, long field_index);
+static void coda_matlab_read_field_array(coda_cursor *cursor, const char *field_name, coda_native_type read_type,
+                                         int num_dims, const long *dim, int num_elements, mxArray *mx_data,
+                                         int struct_field_index);
 static void coda_matlab_get_cursor_info(coda_cursor *cursor, mxClassID *class, mxComplexity *complex_flag,
                                         int *is_scalar);
 
@@ -995,9 +1001,11 @@ static mxArray *coda_matlab_read_array(coda_cursor *cursor, int num_dims, const
                 long num_fields;
                 int mx_field_index;
                 int mx_num_fields;
+                int num_element_fields;
                 char **field_name;
                 int *struct_index;
                 int *skip;
+                coda_native_type *field_array_read_type;
                 int index = 0;
                 long new_dim[CODA_MAX_NUM_DIMS];
 
@@ -1019,12 +1027,15 @@ static mxArray *coda_matlab_read_array(coda_cursor *cursor, int num_dims, const
                 field_name = mxCalloc(num_fields, sizeof(*field_name));
                 struct_index = mxCalloc(num_fields, sizeof(*struct_index));
                 skip = mxCalloc(num_fields, sizeof(*skip));
+                field_array_read_type = mxCalloc(num_fields, sizeof(*field_array_read_type));
 
                 mx_num_fields = 0;
+                num_element_fields = 0;
 
                 for (field_index = 0; field_index < num_fields; field_index++)
                 {
                     skip[field_index] = 0;
+                    field_array_read_type[field_index] = coda_native_type_not_available;
                     if (coda_env.option_filter_record_fields)
                     {
                         int hidden;
@@ -1046,6 +1057,11 @@ static mxArray *coda_matlab_read_array(coda_cursor *cursor, int num_dims, const
                             coda_matlab_coda_error();
                         }
                         mx_num_fields++;
+                        field_array_read_type[field_index] = coda_matlab_get_field_array_read_type(type, field_index);
+                        if (field_array_read_type[field_index] == coda_native_type_not_available)
+                        {
+                            num_element_fields++;
+                        }
                     }
                 }
 
@@ -1057,72 +1073,98 @@ static mxArray *coda_matlab_read_array(coda_cursor *cursor, int num_dims, const
                     struct_index[field_index] = mxGetFieldNumber(mx_data, field_name[field_index]);
                 }
 
-                if (coda_cursor_goto_first_array_element(cursor) != 0)
+                /* read the numeric fields column-wise for all array elements at once */
+                mx_field_index = 0;
+                for (field_index = 0; field_index < num_fields; field_index++)
                 {
-                    coda_matlab_coda_error();
+                    if (!skip[field_index])
+                    {
+                        if (field_array_read_type[field_index] != coda_native_type_not_available)
+                        {
+                            coda_matlab_read_field_array(cursor, field_name[mx_field_index],
+                                                         field_array_read_type[field_index], num_dims, dim,
+                                                         num_elements, mx_data, struct_index[mx_field_index]);
+                        }
+                        mx_field_index++;
+                    }
                 }
-                while (index < num_elements)
-                {
-                    coda_cursor record_cursor;
 
-                    mx_field_index = 0;
-
-                    record_cursor = *cursor;
-                    if (coda_cursor_goto_first_record_field(cursor) != 0)
+                /* read the remaining fields element by element */
+                if (num_element_fields > 0)
+                {
+                    if (coda_cursor_goto_first_array_element(cursor) != 0)
                     {
                         coda_matlab_coda_error();
                     }
-                    for (field_index = 0; field_index < num_fields; field_index++)
+                    while (index < num_elements)
                     {
-                        if (!skip[field_index])
-                        {
-                            mxArray *mx_array = NULL;
-                            int available;
+                        coda_cursor record_cursor;
 
-                            if (coda_cursor_get_record_field_available_status(&record_cursor, field_index,
-                                                                              &available) != 0)
-                            {
-                                coda_matlab_coda_error();
-                            }
-                            if (available)
+                        mx_field_index = 0;
+
+                        record_cursor = *cursor;
+                        if (coda_cursor_goto_first_record_field(cursor) != 0)
+                        {
+                            coda_matlab_coda_error();
+                        }
+                        for (field_index = 0; field_index < num_fields; field_index++)
+                        {
+                            if (!skip[field_index] &&
+                                field_array_read_type[field_index] == coda_native_type_not_available)
                             {
-                                mx_array = coda_matlab_read_data(cursor);
-                                /* note: if the field is not available, we put a NULL mx object in the field array */
+                                mxArray *mx_array = NULL;
+                                int available;
+
+                                if (coda_cursor_get_record_field_available_status(&record_cursor, field_index,
+                                                                                  &available) != 0)
+                                {
+                                    coda_matlab_coda_error();
+                                }
+                                if (available)
+                                {
+                                    mx_array = coda_matlab_read_data(cursor);
+                                    /* note: if the field is not available, we put a NULL mx object in the field
+                                     * array */
+                                }
+                                if (coda_env.option_swap_dimensions)
+                                {
+                                    mxSetFieldByNumber(mx_data, coda_c_index_to_fortran_index(num_dims, dim, index),
+                                                       struct_index[mx_field_index], mx_array);
+                                }
+                                else
+                                {
+                                    mxSetFieldByNumber(mx_data, index, struct_index[mx_field_index], mx_array);
+                                }
                             }
-                            if (coda_env.option_swap_dimensions)
+                            if (!skip[field_index])
                             {
-                                mxSetFieldByNumber(mx_data, coda_c_index_to_fortran_index(num_dims, dim, index),
-                                                   struct_index[mx_field_index], mx_array);
+                                mx_field_index++;
                             }
-                            else
+                            if (field_index < num_fields - 1)
                             {
-                                mxSetFieldByNumber(mx_data, index, struct_index[mx_field_index], mx_array);
+                                if (coda_cursor_goto_next_record_field(cursor) != 0)
+                                {
+                                    coda_matlab_coda_error();
+                                }
                             }
-                            mx_field_index++;
                         }
-                        if (field_index < num_fields - 1)
+                        coda_cursor_goto_parent(cursor);
+                        index++;
+                        if (index < num_elements)
                         {
-                            if (coda_cursor_goto_next_record_field(cursor) != 0)
+                            if (coda_cursor_goto_next_array_element(cursor) != 0)
                             {
                                 coda_matlab_coda_error();
                             }
                         }
                     }
                     coda_cursor_goto_parent(cursor);
-                    index++;
-                    if (index < num_elements)
-                    {
-                        if (coda_cursor_goto_next_array_element(cursor) != 0)
-                        {
-                            coda_matlab_coda_error();
-                        }
-                    }
                 }
-                coda_cursor_goto_parent(cursor);
 
                 mxFree(field_name);
                 mxFree(struct_index);
                 mxFree(skip);
+                mxFree(field_array_read_type);
             }
             break;
         case coda_integer_class:
@@ -1460,6 +1502,242 @@ static mxArray *coda_matlab_read_array(coda_cursor *cursor, int num_dims, const
     return mx_data;
 }
 
+/*
+ * Returns the type with which a record field can be read for all elements of an array of records at once, or
+ * coda_native_type_not_available if the field needs to be read element by element.
+ * Only binary records with a fixed size are read this way, since for these records the position of a field in each
+ * array element can be calculated directly. For all other records this would just duplicate the cursor navigation.
+ */
+static coda_native_type coda_matlab_get_field_array_read_type(coda_type *record_type, long field_index)
+{
+    coda_native_type read_type;
+    coda_type_class type_class;
+    coda_format format;
+    coda_type *type;
+    int64_t bit_size;
+    int available;
+
+    if (coda_type_get_format(record_type, &format) != 0)
+    {
+        coda_matlab_coda_error();
+    }
+    if (coda_type_get_bit_size(record_type, &bit_size) != 0)
+    {
+        coda_matlab_coda_error();
+    }
+    if (format != coda_format_binary || bit_size < 0)
+    {
+        return coda_native_type_not_available;
+    }
+
+    /* fields that are not always available (which includes all fields of a union) are read element by element */
+    if (coda_type_get_record_field_available_status(record_type, field_index, &available) != 0)
+    {
+        coda_matlab_coda_error();
+    }
+    if (available != 1)
+    {
+        return coda_native_type_not_available;
+    }
+
+    if (coda_type_get_record_field_type(record_type, field_index, &type) != 0)
+    {
+        coda_matlab_coda_error();
+    }
+    if (coda_type_get_class(type, &type_class) != 0)
+    {
+        coda_matlab_coda_error();
+    }
+    if (coda_get_option_bypass_special_types() && type_class == coda_special_class)
+    {
+        if (coda_type_get_special_base_type(type, &type) != 0)
+        {
+            coda_matlab_coda_error();
+        }
+        if (coda_type_get_class(type, &type_class) != 0)
+        {
+            coda_matlab_coda_error();
+        }
+    }
+
+    switch (type_class)
+    {
+        case coda_integer_class:
+        case coda_real_class:
+            if (coda_type_get_read_type(type, &read_type) != 0)
+            {
+                coda_matlab_coda_error();
+            }
+            switch (read_type)
+            {
+                case coda_native_type_int8:
+                case coda_native_type_uint8:
+                case coda_native_type_int16:
+                case coda_native_type_uint16:
+                case coda_native_type_int32:
+                case coda_native_type_uint32:
+                case coda_native_type_float:
+                    if (coda_env.option_convert_numbers_to_double)
+                    {
+                        read_type = coda_native_type_double;
+                    }
+                    return read_type;
+                case coda_native_type_int64:
+                case coda_native_type_uint64:
+                    if (coda_env.option_convert_numbers_to_double || !coda_env.option_use_64bit_integer)
+                    {
+                        read_type = coda_native_type_double;
+                    }
+                    return read_type;
+                case coda_native_type_double:
+                    return read_type;
+                default:
+                    break;
+            }
+            break;
+        case coda_special_class:
+            {
+                coda_special_type special_type;
+
+                if (coda_type_get_special_type(type, &special_type) != 0)
+                {
+                    coda_matlab_coda_error();
+                }
+                if (special_type == coda_special_vsf_integer || special_type == coda_special_time)
+                {
+                    return coda_native_type_double;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+
+    return coda_native_type_not_available;
+}
+
+/*
+ * Reads a record field for all elements of the array of records that the cursor points to with a single strided
+ * read and stores the values as scalars in the field of the struct array.
+ */
+static void coda_matlab_read_field_array(coda_cursor *cursor, const char *field_name, coda_native_type read_type,
+                                         int num_dims, const long *dim, int num_elements, mxArray *mx_data,
+                                         int struct_field_index)
+{
+    mxClassID class = mxDOUBLE_CLASS;
+    uint8_t *buffer;
+    int element_size = 0;
+    int result = 0;
+    int index;
+
+    switch (read_type)
+    {
+        case coda_native_type_int8:
+            class = mxINT8_CLASS;
+            element_size = sizeof(int8_t);
+            break;
+        case coda_native_type_uint8:
+            class = mxUINT8_CLASS;
+            element_size = sizeof(uint8_t);
+            break;
+        case coda_native_type_int16:
+            class = mxINT16_CLASS;
+            element_size = sizeof(int16_t);
+            break;
+        case coda_native_type_uint16:
+            class = mxUINT16_CLASS;
+            element_size = sizeof(uint16_t);
+            break;
+        case coda_native_type_int32:
+            class = mxINT32_CLASS;
+            element_size = sizeof(int32_t);
+            break;
+        case coda_native_type_uint32:
+            class = mxUINT32_CLASS;
+            element_size = sizeof(uint32_t);
+            break;
+        case coda_native_type_int64:
+            class = mxINT64_CLASS;
+            element_size = sizeof(int64_t);
+            break;
+        case coda_native_type_uint64:
+            class = mxUINT64_CLASS;
+            element_size = sizeof(uint64_t);
+            break;
+        case coda_native_type_float:
+            class = mxSINGLE_CLASS;
+            element_size = sizeof(float);
+            break;
+        case coda_native_type_double:
+            class = mxDOUBLE_CLASS;
+            element_size = sizeof(double);
+            break;
+        default:
+            mxAssert(0, "Invalid internal parameters");
+            break;
+    }
+
+    buffer = mxMalloc(num_elements * element_size);
+    switch (read_type)
+    {
+        case coda_native_type_int8:
+            result = coda_cursor_read_int8_field_array(cursor, field_name, (int8_t *)buffer);
+            break;
+        case coda_native_type_uint8:
+            result = coda_cursor_read_uint8_field_array(cursor, field_name, (uint8_t *)buffer);
+            break;
+        case coda_native_type_int16:
+            result = coda_cursor_read_int16_field_array(cursor, field_name, (int16_t *)buffer);
+            break;
+        case coda_native_type_uint16:
+            result = coda_cursor_read_uint16_field_array(cursor, field_name, (uint16_t *)buffer);
+            break;
+        case coda_native_type_int32:
+            result = coda_cursor_read_int32_field_array(cursor, field_name, (int32_t *)buffer);
+            break;
+        case coda_native_type_uint32:
+            result = coda_cursor_read_uint32_field_array(cursor, field_name, (uint32_t *)buffer);
+            break;
+        case coda_native_type_int64:
+            result = coda_cursor_read_int64_field_array(cursor, field_name, (int64_t *)buffer);
+            break;
+        case coda_native_type_uint64:
+            result = coda_cursor_read_uint64_field_array(cursor, field_name, (uint64_t *)buffer);
+            break;
+        case coda_native_type_float:
+            result = coda_cursor_read_float_field_array(cursor, field_name, (float *)buffer);
+            break;
+        case coda_native_type_double:
+            result = coda_cursor_read_double_field_array(cursor, field_name, (double *)buffer);
+            break;
+        default:
+            break;
+    }
+    if (result != 0)
+    {
+        coda_matlab_coda_error();
+    }
+
+    for (index = 0; index < num_elements; index++)
+    {
+        mxArray *mx_array;
+
+        mx_array = mxCreateNumericMatrix(1, 1, class, mxREAL);
+        memcpy(mxGetData(mx_array), &buffer[index * element_size], element_size);
+        if (coda_env.option_swap_dimensions)
+        {
+            mxSetFieldByNumber(mx_data, coda_c_index_to_fortran_index(num_dims, dim, index), struct_field_index,
+                               mx_array);
+        }
+        else
+        {
+            mxSetFieldByNumber(mx_data, index, struct_field_index, mx_array);
+        }
+    }
+
+    mxFree(buffer);
+}
+
 static void coda_matlab_get_cursor_info(coda_cursor *cursor, mxClassID *class, mxComplexity *complex_flag,
                                         int *is_scalar)
 {
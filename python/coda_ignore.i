@@ -62,6 +62,7 @@
 %ignore CODA_CURSOR_MAXDEPTH;
 
 %ignore coda_errno;
+%ignore coda_get_errno;
 
 %ignore coda_set_definition_path;
 %ignore coda_free;
@@ -355,6 +355,7 @@
 %{
     PyObject * ## __helper_name ## (const coda_cursor *cursor)
     {
+        char error_message[CODAC_MAX_ERROR_MESSAGE_LENGTH + 1];
         int tmp_result, tmp_num_dims;
         npy_intp tmp_dims_int[CODA_MAX_NUM_DIMS];
         long tmp_dims_long[CODA_MAX_NUM_DIMS];
@@ -384,11 +385,13 @@
             return PyErr_NoMemory();
         }
 
+        CODAC_BEGIN_ALLOW_THREADS(cursor)
         tmp_result = __function_name(cursor, (__native_type*)PyArray_DATA((PyArrayObject *)tmp), coda_array_ordering_c);
+        CODAC_END_ALLOW_THREADS(tmp_result, error_message)
         if (tmp_result < 0)
         {
             Py_DECREF(tmp);
-            return PyErr_Format(codacError, #__function_name"(): %s", coda_errno_to_string(coda_errno));
+            return PyErr_Format(codacError, #__function_name"(): %s", error_message);
         }
 
         return tmp;
@@ -406,6 +409,7 @@
 %{
     PyObject * ## __helper_name ## (const coda_cursor *cursor, long offset, long length)
     {
+        char error_message[CODAC_MAX_ERROR_MESSAGE_LENGTH + 1];
         int tmp_result;
         npy_intp tmp_dims_int[CODA_MAX_NUM_DIMS];
         PyObject *tmp;
@@ -417,11 +421,13 @@
             return PyErr_NoMemory();
         }
 
+        CODAC_BEGIN_ALLOW_THREADS(cursor)
         tmp_result = __function_name(cursor, offset, length, (__native_type*)PyArray_DATA((PyArrayObject *)tmp));
+        CODAC_END_ALLOW_THREADS(tmp_result, error_message)
         if (tmp_result < 0)
         {
             Py_DECREF(tmp);
-            return PyErr_Format(codacError, #__function_name"(): %s", coda_errno_to_string(coda_errno));
+            return PyErr_Format(codacError, #__function_name"(): %s", error_message);
         }
 
         return tmp;
@@ -439,6 +445,7 @@
 %{
     PyObject * ## __helper_name ## (const coda_cursor *cursor)
     {
+        char error_message[CODAC_MAX_ERROR_MESSAGE_LENGTH + 1];
         int tmp_result, tmp_num_dims;
         npy_intp tmp_dims_int[CODA_MAX_NUM_DIMS];
         long tmp_dims_long[CODA_MAX_NUM_DIMS];
@@ -475,14 +482,16 @@
             return PyErr_NoMemory();
         }
 
+        CODAC_BEGIN_ALLOW_THREADS(cursor)
         tmp_result = __function_name(cursor, (__native_type *)PyArray_DATA((PyArrayObject *)tmp[0]),
                                      (__native_type *)PyArray_DATA((PyArrayObject *)tmp[1]),
                                      coda_array_ordering_c);
+        CODAC_END_ALLOW_THREADS(tmp_result, error_message)
         if (tmp_result < 0)
         {
             Py_DECREF(tmp[0]);
             Py_DECREF(tmp[1]);
-            return PyErr_Format(codacError, #__function_name"(): %s", coda_errno_to_string(coda_errno));
+            return PyErr_Format(codacError, #__function_name"(): %s", error_message);
         }
 
         result_list = PyList_New(2);
@@ -545,6 +554,7 @@
 %{
     PyObject * ## __helper_name ## (const coda_cursor *cursor)
     {
+        char error_message[CODAC_MAX_ERROR_MESSAGE_LENGTH + 1];
         int tmp_result, tmp_num_dims;
         npy_intp tmp_dims_int[CODA_MAX_NUM_DIMS+1];
         long tmp_dims_long[CODA_MAX_NUM_DIMS+1];
@@ -575,12 +585,14 @@
             return PyErr_NoMemory();
         }
 
+        CODAC_BEGIN_ALLOW_THREADS(cursor)
         tmp_result = __function_name(cursor, (double *)PyArray_DATA((PyArrayObject *)tmp),
                                      coda_array_ordering_c);
+        CODAC_END_ALLOW_THREADS(tmp_result, error_message)
         if (tmp_result < 0)
         {
             Py_DECREF(tmp);
-            return PyErr_Format(codacError, #__function_name"(): %s", coda_errno_to_string(coda_errno));
+            return PyErr_Format(codacError, #__function_name"(): %s", error_message);
         }
 
         return (PyObject*) tmp;
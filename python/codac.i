@@ -83,6 +83,54 @@ CodacError = _codac.CodacError
 %}
 
 
+/*
+----------------------------------------------------------------------------------------
+- RELEASING THE GIL                                                                    -
+----------------------------------------------------------------------------------------
+*/
+/*
+    the GIL is released around array reads and expression evaluations, such
+    that other Python threads can run while CODA is reading. libcoda may be
+    used concurrently for distinct product handles (each coda_open() returns
+    its own handle, also when the product cache is enabled), and both the
+    error state and the expression evaluation settings are kept per thread.
+    the HDF4 and HDF5 libraries are not thread-safe, so the GIL is kept for
+    products in those formats. functions that modify global libcoda state
+    (such as opening and closing products) always keep the GIL.
+*/
+%{
+    static int codac_can_release_gil(const coda_cursor *cursor)
+    {
+        coda_product *product;
+        coda_format format;
+
+        if (cursor == NULL || coda_cursor_get_product_file(cursor, &product) != 0 ||
+            coda_get_product_format(product, &format) != 0)
+        {
+            return 0;
+        }
+
+        return format != coda_format_hdf4 && format != coda_format_hdf5;
+    }
+
+#define CODAC_MAX_ERROR_MESSAGE_LENGTH 4096
+
+    /* the libcoda error state is kept per thread, so the error message of the call is copied while it is still
+     * available (i.e. before the exception is built, which may involve other libcoda calls) */
+    static void codac_copy_error_message(char *error_message)
+    {
+        strncpy(error_message, coda_errno_to_string(coda_errno), CODAC_MAX_ERROR_MESSAGE_LENGTH);
+        error_message[CODAC_MAX_ERROR_MESSAGE_LENGTH] = '\0';
+    }
+
+#define CODAC_BEGIN_ALLOW_THREADS(cursor) \
+    { PyThreadState *codac_thread_state = (codac_can_release_gil(cursor) ? PyEval_SaveThread() : NULL);
+#define CODAC_END_ALLOW_THREADS(result, error_message) \
+    if ((result) != 0) codac_copy_error_message(error_message); \
+    if (codac_thread_state != NULL) PyEval_RestoreThread(codac_thread_state); }
+%}
+
+
 /*
 ----------------------------------------------------------------------------------------
 - RENAME AND IGNORE                                                                    -
@@ -647,6 +695,7 @@ NUMPY_OUTPUT_HELPER(cursor_read_complex_array,coda_cursor_read_complex_double_pa
 %{
     PyObject *cursor_read_bits(const coda_cursor *cursor, int64_t bit_offset, int64_t bit_length)
     {
+        char error_message[CODAC_MAX_ERROR_MESSAGE_LENGTH + 1];
         int64_t byte_length;
         npy_intp tmp_byte_length;
         int tmp_result;
@@ -668,12 +717,14 @@ NUMPY_OUTPUT_HELPER(cursor_read_complex_array,coda_cursor_read_complex_double_pa
             return PyErr_NoMemory();
         }
     
+        CODAC_BEGIN_ALLOW_THREADS(cursor)
         tmp_result = coda_cursor_read_bits(cursor, (uint8_t *)PyArray_DATA((PyArrayObject *)tmp), bit_offset, bit_length);
+        CODAC_END_ALLOW_THREADS(tmp_result, error_message)
     
         if (tmp_result < 0)
         {
             Py_DECREF(tmp);
-            return PyErr_Format(codacError, "coda_cursor_read_bits(): %s", coda_errno_to_string(coda_errno));
+            return PyErr_Format(codacError, "coda_cursor_read_bits(): %s", error_message);
         }
         
         return tmp;
@@ -689,6 +740,7 @@ NUMPY_OUTPUT_HELPER(cursor_read_complex_array,coda_cursor_read_complex_double_pa
 %{
     PyObject *cursor_read_bytes(const coda_cursor *cursor, int64_t offset, int64_t length)
     {
+        char error_message[CODAC_MAX_ERROR_MESSAGE_LENGTH + 1];
         npy_intp tmp_length;
         int tmp_result;
         PyObject *tmp;
@@ -705,12 +757,14 @@ NUMPY_OUTPUT_HELPER(cursor_read_complex_array,coda_cursor_read_complex_double_pa
             return PyErr_NoMemory();
         }
     
+        CODAC_BEGIN_ALLOW_THREADS(cursor)
         tmp_result = coda_cursor_read_bytes(cursor, (uint8_t *)PyArray_DATA((PyArrayObject *)tmp), offset, length);
+        CODAC_END_ALLOW_THREADS(tmp_result, error_message)
     
         if (tmp_result < 0)
         {
             Py_DECREF(tmp);
-            return PyErr_Format(codacError, "coda_cursor_read_bytes(): %s", coda_errno_to_string(coda_errno));
+            return PyErr_Format(codacError, "coda_cursor_read_bytes(): %s", error_message);
         }
         
         return tmp;
@@ -718,6 +772,1009 @@ NUMPY_OUTPUT_HELPER(cursor_read_complex_array,coda_cursor_read_complex_double_pa
 %}
 %ignore coda_cursor_read_bytes;
 
+
+/*
+    helper function to read an array of records with a fixed layout (i.e. no variable sized arrays or strings, no
+    optional fields, and no unions) as a numpy structured array. nested records become nested structured types,
+    text becomes fixed length 'S' fields. scalar numeric fields are read with a single bulk gather per field. None
+    is returned if the array elements do not have a fixed layout. no associated function in the CODA C library
+    exists, i.e. this function is specific to the coda-python module.
+*/
+%{
+    /*
+        the layout of an array element is determined once from the CODA type of the array. this layout is used to
+        create the numpy structured dtype and to fill the resulting array.
+    */
+    typedef enum structured_kind_enum
+    {
+        structured_number,
+        structured_char,
+        structured_string,
+        structured_bytes,
+        structured_complex,
+        structured_record
+    } structured_kind;
+
+    typedef struct structured_node_struct
+    {
+        structured_kind kind;
+        coda_native_type read_type;     /* read type for numbers */
+        const char *name;               /* field name (NULL for the array element itself) */
+        long field_index;               /* index of the field in the parent record */
+        long offset;                    /* byte offset of the field within the parent record */
+        long size;                      /* byte size of a single element */
+        long alignment;                 /* byte alignment of a single element */
+        int num_dims;                   /* number of dimensions if the field is an array, -1 otherwise */
+        long dim[CODA_MAX_NUM_DIMS];
+        long num_elements;              /* number of elements if the field is an array, 1 otherwise */
+        int needs_fill;                 /* 0 if the data was already read with a bulk gather */
+        long num_fields;
+        struct structured_node_struct **field;
+    } structured_node;
+
+    static void structured_node_delete(structured_node *node)
+    {
+        long i;
+
+        if (node->field != NULL)
+        {
+            for (i = 0; i < node->num_fields; i++)
+            {
+                if (node->field[i] != NULL)
+                {
+                    structured_node_delete(node->field[i]);
+                }
+            }
+            free(node->field);
+        }
+        free(node);
+    }
+
+    static long structured_native_type_size(coda_native_type read_type)
+    {
+        switch (read_type)
+        {
+            case coda_native_type_int8:
+            case coda_native_type_uint8:
+                return 1;
+            case coda_native_type_int16:
+            case coda_native_type_uint16:
+                return 2;
+            case coda_native_type_int32:
+            case coda_native_type_uint32:
+            case coda_native_type_float:
+                return 4;
+            case coda_native_type_int64:
+            case coda_native_type_uint64:
+            case coda_native_type_double:
+                return 8;
+            default:
+                break;
+        }
+        return -1;
+    }
+
+    /*
+        returns 0 if the type has a fixed layout (*node will be set), 1 if it has not, and -1 on error.
+    */
+    static int structured_node_new(coda_type *type, int filter_record_fields, structured_node **node)
+    {
+        structured_node *new_node;
+        coda_type_class type_class;
+        long offset;
+        long i;
+        int result;
+
+        new_node = (structured_node *)malloc(sizeof(structured_node));
+        if (new_node == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (unsigned long)sizeof(structured_node), __FILE__, __LINE__);
+            return -1;
+        }
+        new_node->kind = structured_number;
+        new_node->read_type = coda_native_type_not_available;
+        new_node->name = NULL;
+        new_node->field_index = 0;
+        new_node->offset = 0;
+        new_node->size = 0;
+        new_node->alignment = 1;
+        new_node->num_dims = -1;
+        new_node->num_elements = 1;
+        new_node->needs_fill = 1;
+        new_node->num_fields = 0;
+        new_node->field = NULL;
+
+        if (coda_type_get_class(type, &type_class) != 0)
+        {
+            structured_node_delete(new_node);
+            return -1;
+        }
+        if (type_class == coda_array_class)
+        {
+            if (coda_type_get_array_dim(type, &new_node->num_dims, new_node->dim) != 0)
+            {
+                structured_node_delete(new_node);
+                return -1;
+            }
+            for (i = 0; i < new_node->num_dims; i++)
+            {
+                if (new_node->dim[i] <= 0)
+                {
+                    /* variable sized (or empty) arrays have no fixed layout */
+                    structured_node_delete(new_node);
+                    return 1;
+                }
+                new_node->num_elements *= new_node->dim[i];
+            }
+            if (coda_type_get_array_base_type(type, &type) != 0 || coda_type_get_class(type, &type_class) != 0)
+            {
+                structured_node_delete(new_node);
+                return -1;
+            }
+            if (type_class == coda_array_class)
+            {
+                structured_node_delete(new_node);
+                return 1;
+            }
+        }
+        while (type_class == coda_special_class && coda_get_option_bypass_special_types())
+        {
+            if (coda_type_get_special_base_type(type, &type) != 0 || coda_type_get_class(type, &type_class) != 0)
+            {
+                structured_node_delete(new_node);
+                return -1;
+            }
+        }
+
+        switch (type_class)
+        {
+            case coda_record_class:
+                {
+                    int is_union;
+
+                    new_node->kind = structured_record;
+                    if (coda_type_get_record_union_status(type, &is_union) != 0 ||
+                        coda_type_get_num_record_fields(type, &new_node->num_fields) != 0)
+                    {
+                        structured_node_delete(new_node);
+                        return -1;
+                    }
+                    if (is_union || new_node->num_fields == 0)
+                    {
+                        structured_node_delete(new_node);
+                        return 1;
+                    }
+                    new_node->field = (structured_node **)malloc(new_node->num_fields * sizeof(structured_node *));
+                    if (new_node->field == NULL)
+                    {
+                        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                                       (unsigned long)(new_node->num_fields * sizeof(structured_node *)),
+                                       __FILE__, __LINE__);
+                        new_node->num_fields = 0;
+                        structured_node_delete(new_node);
+                        return -1;
+                    }
+                    for (i = 0; i < new_node->num_fields; i++)
+                    {
+                        new_node->field[i] = NULL;
+                    }
+
+                    offset = 0;
+                    for (i = 0; i < new_node->num_fields; i++)
+                    {
+                        structured_node *field;
+                        coda_type *field_type;
+                        int available;
+
+                        if (filter_record_fields)
+                        {
+                            int hidden;
+
+                            if (coda_type_get_record_field_hidden_status(type, i, &hidden) != 0)
+                            {
+                                structured_node_delete(new_node);
+                                return -1;
+                            }
+                            if (hidden)
+                            {
+                                continue;
+                            }
+                        }
+                        if (coda_type_get_record_field_available_status(type, i, &available) != 0)
+                        {
+                            structured_node_delete(new_node);
+                            return -1;
+                        }
+                        if (available != 1)
+                        {
+                            /* optional fields have no fixed layout */
+                            structured_node_delete(new_node);
+                            return 1;
+                        }
+                        if (coda_type_get_record_field_type(type, i, &field_type) != 0)
+                        {
+                            structured_node_delete(new_node);
+                            return -1;
+                        }
+                        result = structured_node_new(field_type, filter_record_fields, &field);
+                        if (result != 0)
+                        {
+                            structured_node_delete(new_node);
+                            return result;
+                        }
+                        new_node->field[i] = field;
+                        if (coda_type_get_record_field_name(type, i, &field->name) != 0)
+                        {
+                            structured_node_delete(new_node);
+                            return -1;
+                        }
+                        field->field_index = i;
+                        field->offset = ((offset + field->alignment - 1) / field->alignment) * field->alignment;
+                        offset = field->offset + field->num_elements * field->size;
+                        if (field->alignment > new_node->alignment)
+                        {
+                            new_node->alignment = field->alignment;
+                        }
+                    }
+                    if (offset == 0)
+                    {
+                        /* all fields were filtered */
+                        structured_node_delete(new_node);
+                        return 1;
+                    }
+                    new_node->size = ((offset + new_node->alignment - 1) / new_node->alignment) * new_node->alignment;
+                }
+                break;
+            case coda_integer_class:
+            case coda_real_class:
+            case coda_text_class:
+            case coda_raw_class:
+                if (coda_type_get_read_type(type, &new_node->read_type) != 0)
+                {
+                    structured_node_delete(new_node);
+                    return -1;
+                }
+                if (new_node->read_type == coda_native_type_char)
+                {
+                    new_node->kind = structured_char;
+                    new_node->size = 1;
+                }
+                else if (new_node->read_type == coda_native_type_string)
+                {
+                    new_node->kind = structured_string;
+                    if (coda_type_get_string_length(type, &new_node->size) != 0)
+                    {
+                        structured_node_delete(new_node);
+                        return -1;
+                    }
+                }
+                else if (new_node->read_type == coda_native_type_bytes)
+                {
+                    int64_t bit_size;
+
+                    new_node->kind = structured_bytes;
+                    if (coda_type_get_bit_size(type, &bit_size) != 0)
+                    {
+                        structured_node_delete(new_node);
+                        return -1;
+                    }
+                    new_node->size = (bit_size >= 0 && (bit_size & 0x7) == 0) ? (long)(bit_size >> 3) : -1;
+                }
+                else
+                {
+                    new_node->kind = structured_number;
+                    new_node->size = structured_native_type_size(new_node->read_type);
+                    new_node->alignment = new_node->size;
+                }
+                if (new_node->size <= 0)
+                {
+                    /* strings and raw data without a fixed length have no fixed layout */
+                    structured_node_delete(new_node);
+                    return 1;
+                }
+                break;
+            case coda_special_class:
+                {
+                    coda_special_type special_type;
+
+                    if (coda_type_get_special_type(type, &special_type) != 0)
+                    {
+                        structured_node_delete(new_node);
+                        return -1;
+                    }
+                    if (special_type == coda_special_complex)
+                    {
+                        new_node->kind = structured_complex;
+                        new_node->size = 2 * sizeof(double);
+                        new_node->alignment = sizeof(double);
+                    }
+                    else if (special_type == coda_special_vsf_integer || special_type == coda_special_time)
+                    {
+                        new_node->kind = structured_number;
+                        new_node->read_type = coda_native_type_double;
+                        new_node->size = sizeof(double);
+                        new_node->alignment = sizeof(double);
+                    }
+                    else
+                    {
+                        structured_node_delete(new_node);
+                        return 1;
+                    }
+                }
+                break;
+            default:
+                structured_node_delete(new_node);
+                return 1;
+        }
+
+        *node = new_node;
+        return 0;
+    }
+
+    /*
+        returns a new reference to the numpy dtype specification of a single element of the node.
+    */
+    static PyObject *structured_node_get_dtype_spec(structured_node *node)
+    {
+        PyObject *names;
+        PyObject *formats;
+        PyObject *offsets;
+        PyObject *spec;
+        long i;
+
+        switch (node->kind)
+        {
+            case structured_number:
+                switch (node->read_type)
+                {
+                    case coda_native_type_int8:
+                        return Py_BuildValue("s", "i1");
+                    case coda_native_type_uint8:
+                        return Py_BuildValue("s", "u1");
+                    case coda_native_type_int16:
+                        return Py_BuildValue("s", "i2");
+                    case coda_native_type_uint16:
+                        return Py_BuildValue("s", "u2");
+                    case coda_native_type_int32:
+                        return Py_BuildValue("s", "i4");
+                    case coda_native_type_uint32:
+                        return Py_BuildValue("s", "u4");
+                    case coda_native_type_int64:
+                        return Py_BuildValue("s", "i8");
+                    case coda_native_type_uint64:
+                        return Py_BuildValue("s", "u8");
+                    case coda_native_type_float:
+                        return Py_BuildValue("s", "f4");
+                    default:
+                        return Py_BuildValue("s", "f8");
+                }
+            case structured_char:
+                return Py_BuildValue("s", "S1");
+            case structured_string:
+                {
+                    char format[32];
+
+                    sprintf(format, "S%ld", node->size);
+                    return Py_BuildValue("s", format);
+                }
+            case structured_bytes:
+                return Py_BuildValue("(s(l))", "u1", node->size);
+            case structured_complex:
+                return Py_BuildValue("s", "c16");
+            case structured_record:
+                break;
+        }
+
+        names = PyList_New(0);
+        formats = PyList_New(0);
+        offsets = PyList_New(0);
+        if (names == NULL || formats == NULL || offsets == NULL)
+        {
+            Py_XDECREF(names);
+            Py_XDECREF(formats);
+            Py_XDECREF(offsets);
+            return NULL;
+        }
+        for (i = 0; i < node->num_fields; i++)
+        {
+            structured_node *field = node->field[i];
+            PyObject *item;
+            int result;
+
+            if (field == NULL)
+            {
+                continue;
+            }
+            item = structured_node_get_dtype_spec(field);
+            if (item != NULL && field->num_dims >= 0)
+            {
+                PyObject *shape;
+                int k;
+
+                /* a rank-0 array is converted to a 1-dimensional array of size 1 */
+                shape = PyTuple_New(field->num_dims == 0 ? 1 : field->num_dims);
+                if (shape != NULL && field->num_dims == 0)
+                {
+                    PyTuple_SET_ITEM(shape, 0, PyLong_FromLong(1));
+                }
+                else if (shape != NULL)
+                {
+                    for (k = 0; k < field->num_dims; k++)
+                    {
+                        PyTuple_SET_ITEM(shape, k, PyLong_FromLong(field->dim[k]));
+                    }
+                }
+                if (shape != NULL)
+                {
+                    item = Py_BuildValue("(NN)", item, shape);
+                }
+                else
+                {
+                    Py_DECREF(item);
+                    item = NULL;
+                }
+            }
+            result = (item == NULL || PyList_Append(formats, item) != 0);
+            Py_XDECREF(item);
+            if (!result)
+            {
+                item = Py_BuildValue("s", field->name);
+                result = (item == NULL || PyList_Append(names, item) != 0);
+                Py_XDECREF(item);
+            }
+            if (!result)
+            {
+                item = PyLong_FromLong(field->offset);
+                result = (item == NULL || PyList_Append(offsets, item) != 0);
+                Py_XDECREF(item);
+            }
+            if (result)
+            {
+                Py_DECREF(names);
+                Py_DECREF(formats);
+                Py_DECREF(offsets);
+                return NULL;
+            }
+        }
+        spec = Py_BuildValue("{sNsNsNsl}", "names", names, "formats", formats, "offsets", offsets, "itemsize",
+                             node->size);
+
+        return spec;
+    }
+
+    static int structured_read_field_array(const coda_cursor *cursor, const char *path, coda_native_type read_type,
+                                           void *dst)
+    {
+        switch (read_type)
+        {
+            case coda_native_type_int8:
+                return coda_cursor_read_int8_field_array(cursor, path, (int8_t *)dst);
+            case coda_native_type_uint8:
+                return coda_cursor_read_uint8_field_array(cursor, path, (uint8_t *)dst);
+            case coda_native_type_int16:
+                return coda_cursor_read_int16_field_array(cursor, path, (int16_t *)dst);
+            case coda_native_type_uint16:
+                return coda_cursor_read_uint16_field_array(cursor, path, (uint16_t *)dst);
+            case coda_native_type_int32:
+                return coda_cursor_read_int32_field_array(cursor, path, (int32_t *)dst);
+            case coda_native_type_uint32:
+                return coda_cursor_read_uint32_field_array(cursor, path, (uint32_t *)dst);
+            case coda_native_type_int64:
+                return coda_cursor_read_int64_field_array(cursor, path, (int64_t *)dst);
+            case coda_native_type_uint64:
+                return coda_cursor_read_uint64_field_array(cursor, path, (uint64_t *)dst);
+            case coda_native_type_float:
+                return coda_cursor_read_float_field_array(cursor, path, (float *)dst);
+            default:
+                break;
+        }
+        return coda_cursor_read_double_field_array(cursor, path, (double *)dst);
+    }
+
+    static int structured_read_number(const coda_cursor *cursor, coda_native_type read_type, void *dst)
+    {
+        switch (read_type)
+        {
+            case coda_native_type_int8:
+                return coda_cursor_read_int8(cursor, (int8_t *)dst);
+            case coda_native_type_uint8:
+                return coda_cursor_read_uint8(cursor, (uint8_t *)dst);
+            case coda_native_type_int16:
+                return coda_cursor_read_int16(cursor, (int16_t *)dst);
+            case coda_native_type_uint16:
+                return coda_cursor_read_uint16(cursor, (uint16_t *)dst);
+            case coda_native_type_int32:
+                return coda_cursor_read_int32(cursor, (int32_t *)dst);
+            case coda_native_type_uint32:
+                return coda_cursor_read_uint32(cursor, (uint32_t *)dst);
+            case coda_native_type_int64:
+                return coda_cursor_read_int64(cursor, (int64_t *)dst);
+            case coda_native_type_uint64:
+                return coda_cursor_read_uint64(cursor, (uint64_t *)dst);
+            case coda_native_type_float:
+                return coda_cursor_read_float(cursor, (float *)dst);
+            default:
+                break;
+        }
+        return coda_cursor_read_double(cursor, (double *)dst);
+    }
+
+    static int structured_read_number_array(const coda_cursor *cursor, coda_native_type read_type, void *dst)
+    {
+        switch (read_type)
+        {
+            case coda_native_type_int8:
+                return coda_cursor_read_int8_array(cursor, (int8_t *)dst, coda_array_ordering_c);
+            case coda_native_type_uint8:
+                return coda_cursor_read_uint8_array(cursor, (uint8_t *)dst, coda_array_ordering_c);
+            case coda_native_type_int16:
+                return coda_cursor_read_int16_array(cursor, (int16_t *)dst, coda_array_ordering_c);
+            case coda_native_type_uint16:
+                return coda_cursor_read_uint16_array(cursor, (uint16_t *)dst, coda_array_ordering_c);
+            case coda_native_type_int32:
+                return coda_cursor_read_int32_array(cursor, (int32_t *)dst, coda_array_ordering_c);
+            case coda_native_type_uint32:
+                return coda_cursor_read_uint32_array(cursor, (uint32_t *)dst, coda_array_ordering_c);
+            case coda_native_type_int64:
+                return coda_cursor_read_int64_array(cursor, (int64_t *)dst, coda_array_ordering_c);
+            case coda_native_type_uint64:
+                return coda_cursor_read_uint64_array(cursor, (uint64_t *)dst, coda_array_ordering_c);
+            case coda_native_type_float:
+                return coda_cursor_read_float_array(cursor, (float *)dst, coda_array_ordering_c);
+            default:
+                break;
+        }
+        return coda_cursor_read_double_array(cursor, (double *)dst, coda_array_ordering_c);
+    }
+
+    /*
+        reads all scalar numeric fields that are reachable from the array element through records only using a
+        single bulk gather per field. the gathered fields are marked such that the per element pass skips them.
+    */
+    static int structured_node_gather(structured_node *node, const coda_cursor *cursor, const char *path, long offset,
+                                      char *data, long stride, long num_elements, char *buffer)
+    {
+        long i;
+        long j;
+
+        for (i = 0; i < node->num_fields; i++)
+        {
+            structured_node *field = node->field[i];
+            char *field_path;
+            int result = 0;
+
+            if (field == NULL || field->num_dims != -1 ||
+                (field->kind != structured_record && field->kind != structured_number))
+            {
+                continue;
+            }
+            field_path = (char *)malloc((path == NULL ? 0 : strlen(path) + 1) + strlen(field->name) + 1);
+            if (field_path == NULL)
+            {
+                coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                               (unsigned long)((path == NULL ? 0 : strlen(path) + 1) + strlen(field->name) + 1),
+                               __FILE__, __LINE__);
+                return -1;
+            }
+            if (path == NULL)
+            {
+                strcpy(field_path, field->name);
+            }
+            else
+            {
+                sprintf(field_path, "%s/%s", path, field->name);
+            }
+            if (field->kind == structured_record)
+            {
+                result = structured_node_gather(field, cursor, field_path, offset + field->offset, data, stride,
+                                                num_elements, buffer);
+            }
+            else
+            {
+                result = structured_read_field_array(cursor, field_path, field->read_type, buffer);
+                if (result == 0)
+                {
+                    for (j = 0; j < num_elements; j++)
+                    {
+                        memcpy(&data[j * stride + offset + field->offset], &buffer[j * field->size],
+                               field->size);
+                    }
+                    field->needs_fill = 0;
+                }
+            }
+            free(field_path);
+            if (result != 0)
+            {
+                return -1;
+            }
+        }
+
+        node->needs_fill = 0;
+        for (i = 0; i < node->num_fields; i++)
+        {
+            if (node->field[i] != NULL && node->field[i]->needs_fill)
+            {
+                node->needs_fill = 1;
+                break;
+            }
+        }
+
+        return 0;
+    }
+
+    static int structured_node_fill_array(structured_node *node, coda_cursor *cursor, char *dst, char *buffer);
+
+    /*
+        reads a single (non-array) element of the node at the cursor position into dst.
+    */
+    static int structured_node_fill_element(structured_node *node, coda_cursor *cursor, char *dst, char *buffer)
+    {
+        long i;
+
+        switch (node->kind)
+        {
+            case structured_number:
+                return structured_read_number(cursor, node->read_type, dst);
+            case structured_char:
+                return coda_cursor_read_char(cursor, dst);
+            case structured_string:
+                memset(buffer, 0, node->size + 1);
+                if (coda_cursor_read_string(cursor, buffer, node->size + 1) != 0)
+                {
+                    return -1;
+                }
+                memcpy(dst, buffer, node->size);
+                return 0;
+            case structured_bytes:
+                return coda_cursor_read_bytes(cursor, (uint8_t *)dst, 0, node->size);
+            case structured_complex:
+                return coda_cursor_read_complex_double_pair(cursor, (double *)dst);
+            case structured_record:
+                break;
+        }
+
+        for (i = 0; i < node->num_fields; i++)
+        {
+            structured_node *field = node->field[i];
+
+            if (field == NULL || !field->needs_fill)
+            {
+                continue;
+            }
+            if (coda_cursor_goto_record_field_by_index(cursor, field->field_index) != 0)
+            {
+                return -1;
+            }
+            if (field->num_dims == -1)
+            {
+                if (structured_node_fill_element(field, cursor, &dst[field->offset], buffer) != 0)
+                {
+                    return -1;
+                }
+            }
+            else
+            {
+                if (structured_node_fill_array(field, cursor, &dst[field->offset], buffer) != 0)
+                {
+                    return -1;
+                }
+            }
+            coda_cursor_goto_parent(cursor);
+        }
+
+        return 0;
+    }
+
+    /*
+        reads all elements of the array at the cursor position into dst.
+    */
+    static int structured_node_fill_array(structured_node *node, coda_cursor *cursor, char *dst, char *buffer)
+    {
+        long i;
+
+        switch (node->kind)
+        {
+            case structured_number:
+                return structured_read_number_array(cursor, node->read_type, dst);
+            case structured_char:
+                return coda_cursor_read_char_array(cursor, dst, coda_array_ordering_c);
+            case structured_complex:
+                return coda_cursor_read_complex_double_pairs_array(cursor, (double *)dst, coda_array_ordering_c);
+            default:
+                break;
+        }
+
+        if (coda_cursor_goto_first_array_element(cursor) != 0)
+        {
+            return -1;
+        }
+        for (i = 0; i < node->num_elements; i++)
+        {
+            if (structured_node_fill_element(node, cursor, &dst[i * node->size], buffer) != 0)
+            {
+                return -1;
+            }
+            if (i < node->num_elements - 1)
+            {
+                if (coda_cursor_goto_next_array_element(cursor) != 0)
+                {
+                    return -1;
+                }
+            }
+        }
+        coda_cursor_goto_parent(cursor);
+
+        return 0;
+    }
+
+    static long structured_node_get_max_size(structured_node *node)
+    {
+        long max_size = node->size;
+        long i;
+
+        for (i = 0; i < node->num_fields; i++)
+        {
+            if (node->field[i] != NULL)
+            {
+                long size = structured_node_get_max_size(node->field[i]);
+
+                if (size > max_size)
+                {
+                    max_size = size;
+                }
+            }
+        }
+
+        return max_size;
+    }
+%}
+%inline
+%{
+    PyObject *cursor_read_structured_array(const coda_cursor *cursor, int filter_record_fields)
+    {
+        char error_message[CODAC_MAX_ERROR_MESSAGE_LENGTH + 1];
+        structured_node *node = NULL;
+        coda_cursor element_cursor;
+        coda_type_class type_class;
+        coda_type *type;
+        PyArray_Descr *descr;
+        PyObject *spec;
+        PyObject *tmp;
+        npy_intp tmp_dims_int[CODA_MAX_NUM_DIMS];
+        long tmp_dims_long[CODA_MAX_NUM_DIMS];
+        int tmp_num_dims;
+        long num_elements;
+        char *data;
+        char *buffer;
+        long i;
+        int result;
+
+        if (coda_cursor_get_type(cursor, &type) != 0 || coda_type_get_class(type, &type_class) != 0)
+        {
+            return PyErr_Format(codacError, "cursor_read_structured_array(): %s", coda_errno_to_string(coda_errno));
+        }
+        if (type_class != coda_array_class)
+        {
+            PyErr_SetString(PyExc_ValueError, "cursor does not refer to an array");
+            return NULL;
+        }
+        if (coda_type_get_array_base_type(type, &type) != 0 || coda_type_get_class(type, &type_class) != 0)
+        {
+            return PyErr_Format(codacError, "cursor_read_structured_array(): %s", coda_errno_to_string(coda_errno));
+        }
+        result = (type_class == coda_record_class ? structured_node_new(type, filter_record_fields, &node) : 1);
+        if (result < 0)
+        {
+            return PyErr_Format(codacError, "cursor_read_structured_array(): %s", coda_errno_to_string(coda_errno));
+        }
+        if (result > 0)
+        {
+            /* the array elements have no fixed layout */
+            Py_INCREF(Py_None);
+            return Py_None;
+        }
+
+        if (coda_cursor_get_array_dim(cursor, &tmp_num_dims, tmp_dims_long) != 0 ||
+            coda_cursor_get_num_elements(cursor, &num_elements) != 0)
+        {
+            structured_node_delete(node);
+            return PyErr_Format(codacError, "cursor_read_structured_array(): %s", coda_errno_to_string(coda_errno));
+        }
+        for (i = 0; i < tmp_num_dims; i++)
+        {
+            tmp_dims_int[i] = tmp_dims_long[i];
+        }
+
+        /* convert a rank-0 array to a rank-1 array of size 1. */
+        if (tmp_num_dims == 0)
+        {
+            tmp_dims_int[tmp_num_dims++] = 1;
+        }
+
+        spec = structured_node_get_dtype_spec(node);
+        if (spec == NULL)
+        {
+            structured_node_delete(node);
+            return NULL;
+        }
+        result = PyArray_DescrConverter(spec, &descr);
+        Py_DECREF(spec);
+        if (!result)
+        {
+            structured_node_delete(node);
+            return NULL;
+        }
+
+        /* PyArray_Zeros() steals the reference to descr */
+        tmp = PyArray_Zeros(tmp_num_dims, tmp_dims_int, descr, 0);
+        if (tmp == NULL)
+        {
+            structured_node_delete(node);
+            return PyErr_NoMemory();
+        }
+        if (num_elements == 0)
+        {
+            structured_node_delete(node);
+            return tmp;
+        }
+        data = (char *)PyArray_DATA((PyArrayObject *)tmp);
+
+        /* scratch buffer for the bulk gather of a field and for reading fixed length strings */
+        i = structured_node_get_max_size(node) + 1;
+        if (i < num_elements * (long)sizeof(double))
+        {
+            i = num_elements * (long)sizeof(double);
+        }
+        buffer = (char *)malloc(i);
+        if (buffer == NULL)
+        {
+            structured_node_delete(node);
+            Py_DECREF(tmp);
+            return PyErr_NoMemory();
+        }
+
+        CODAC_BEGIN_ALLOW_THREADS(cursor)
+        result = structured_node_gather(node, cursor, NULL, 0, data, node->size, num_elements, buffer);
+        if (result == 0 && node->needs_fill)
+        {
+            element_cursor = *cursor;
+            result = coda_cursor_goto_first_array_element(&element_cursor);
+            for (i = 0; result == 0 && i < num_elements; i++)
+            {
+                result = structured_node_fill_element(node, &element_cursor, &data[i * node->size], buffer);
+                if (result == 0 && i < num_elements - 1)
+                {
+                    result = coda_cursor_goto_next_array_element(&element_cursor);
+                }
+            }
+        }
+        CODAC_END_ALLOW_THREADS(result, error_message)
+        free(buffer);
+        structured_node_delete(node);
+        if (result != 0)
+        {
+            Py_DECREF(tmp);
+            return PyErr_Format(codacError, "cursor_read_structured_array(): %s", error_message);
+        }
+
+        return tmp;
+    }
+%}
+
+
+/*
+    helper function to get a read-only numpy view on the data of an array of numbers, without copying the data. this
+    is only possible if coda_cursor_get_array_data_pointer() provides a pointer to the data (e.g. for a memory mapped
+    binary product); None is returned otherwise. the base object is referenced by the numpy array and should keep the
+    product open for as long as the view exists. no associated function in the CODA C library exists, i.e. this
+    function is specific to the coda-python module.
+*/
+%inline
+%{
+    PyObject *cursor_read_array_view(const coda_cursor *cursor, PyObject *base)
+    {
+        const void *data;
+        coda_type *type;
+        coda_native_type read_type;
+        npy_intp tmp_dims_int[CODA_MAX_NUM_DIMS];
+        long tmp_dims_long[CODA_MAX_NUM_DIMS];
+        int tmp_num_dims;
+        int type_num;
+        PyObject *tmp;
+        int i;
+
+        if (coda_cursor_get_array_data_pointer(cursor, &data) != 0)
+        {
+            return PyErr_Format(codacError, "cursor_read_array_view(): %s", coda_errno_to_string(coda_errno));
+        }
+        if (data == NULL)
+        {
+            /* the array data can not be accessed directly */
+            Py_INCREF(Py_None);
+            return Py_None;
+        }
+        if (coda_cursor_get_type(cursor, &type) != 0 || coda_type_get_array_base_type(type, &type) != 0 ||
+            coda_type_get_read_type(type, &read_type) != 0 ||
+            coda_cursor_get_array_dim(cursor, &tmp_num_dims, tmp_dims_long) != 0)
+        {
+            return PyErr_Format(codacError, "cursor_read_array_view(): %s", coda_errno_to_string(coda_errno));
+        }
+        switch (read_type)
+        {
+            case coda_native_type_int8:
+                type_num = NPY_INT8;
+                break;
+            case coda_native_type_uint8:
+                type_num = NPY_UINT8;
+                break;
+            case coda_native_type_int16:
+                type_num = NPY_INT16;
+                break;
+            case coda_native_type_uint16:
+                type_num = NPY_UINT16;
+                break;
+            case coda_native_type_int32:
+                type_num = NPY_INT32;
+                break;
+            case coda_native_type_uint32:
+                type_num = NPY_UINT32;
+                break;
+            case coda_native_type_int64:
+                type_num = NPY_INT64;
+                break;
+            case coda_native_type_uint64:
+                type_num = NPY_UINT64;
+                break;
+            case coda_native_type_float:
+                type_num = NPY_FLOAT32;
+                break;
+            default:
+                type_num = NPY_FLOAT64;
+                break;
+        }
+
+        for (i = 0; i < tmp_num_dims; i++)
+        {
+            tmp_dims_int[i] = tmp_dims_long[i];
+        }
+
+        /* convert a rank-0 array to a rank-1 array of size 1. */
+        if (tmp_num_dims == 0)
+        {
+            tmp_dims_int[tmp_num_dims++] = 1;
+        }
+
+        /* the array is created without the NPY_ARRAY_WRITEABLE flag, i.e. it is read-only */
+        tmp = PyArray_New(&PyArray_Type, tmp_num_dims, tmp_dims_int, type_num, NULL, (void *)data, 0, 0, NULL);
+        if (tmp == NULL)
+        {
+            return NULL;
+        }
+
+        /* keep the base object (which keeps the product open) alive for as long as the view exists */
+        Py_INCREF(base);
+        if (PyArray_SetBaseObject((PyArrayObject *)tmp, base) != 0)
+        {
+            Py_DECREF(tmp);
+            return NULL;
+        }
+
+        return tmp;
+    }
+%}
+%ignore coda_cursor_get_array_data_pointer;
+%ignore coda_cursor_read_int8_field_array;
+%ignore coda_cursor_read_uint8_field_array;
+%ignore coda_cursor_read_int16_field_array;
+%ignore coda_cursor_read_uint16_field_array;
+%ignore coda_cursor_read_int32_field_array;
+%ignore coda_cursor_read_uint32_field_array;
+%ignore coda_cursor_read_int64_field_array;
+%ignore coda_cursor_read_uint64_field_array;
+%ignore coda_cursor_read_float_field_array;
+%ignore coda_cursor_read_double_field_array;
+
 /*
 ----------------------------------------------------------------------------------------
 - GLOBAL EXCEPTION MECHANISM                                                           -
@@ -806,6 +1863,32 @@ int coda_expression_is_equal(const coda_expression *expr1, const coda_expression
 %typemap(out) int;
 %typemap(out) int = void;
 
+/*
+    release the GIL while evaluating expressions for a cursor.
+*/
+%define EXPRESSION_EVAL_EXCEPTION(__function_name)
+%exception __function_name
+{
+    char error_message[CODAC_MAX_ERROR_MESSAGE_LENGTH + 1];
+
+    CODAC_BEGIN_ALLOW_THREADS(arg2)
+    $action
+    CODAC_END_ALLOW_THREADS(result, error_message)
+
+    if (result < 0)
+    {
+        $cleanup
+        return PyErr_Format(codacError,"$name(): %s", error_message);
+    }
+}
+%enddef
+
+EXPRESSION_EVAL_EXCEPTION(coda_expression_eval_bool)
+EXPRESSION_EVAL_EXCEPTION(coda_expression_eval_integer)
+EXPRESSION_EVAL_EXCEPTION(coda_expression_eval_float)
+EXPRESSION_EVAL_EXCEPTION(coda_expression_eval_string)
+EXPRESSION_EVAL_EXCEPTION(coda_expression_eval_node)
+
 /*
  specially handle coda_(utc)string_to_time, since the first argument should
  not be handled as output argument (see coda_time_to_string rule further on)
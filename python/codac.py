@@ -216,6 +216,14 @@ def cursor_read_bytes(*args):
   return _codac.cursor_read_bytes(*args)
 cursor_read_bytes = _codac.cursor_read_bytes
 
+def cursor_read_structured_array(*args):
+  return _codac.cursor_read_structured_array(*args)
+cursor_read_structured_array = _codac.cursor_read_structured_array
+
+def cursor_read_array_view(*args):
+  return _codac.cursor_read_array_view(*args)
+cursor_read_array_view = _codac.cursor_read_array_view
+
 def done():
   return _codac.done()
 done = _codac.done
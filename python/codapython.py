@@ -30,10 +30,12 @@ POSSIBILITY OF SUCH DAMAGE.
 """
 
 from .codac import *
+from .codac import close as _close
 import numpy
 import copy
 import os
 import io
+import weakref
 
 #
 # EXCEPTION HIERARCHY
@@ -65,6 +67,59 @@ def _isIterable(maybeIterable):
         return True
 
 
+#
+# PRODUCT REFERENCES; KEEP PRODUCTS OPEN WHILE THERE ARE VIEWS ON THEIR DATA
+#
+class _ProductReference(object):
+    """
+    A _ProductReference is used as the base object of the read-only numpy views
+    that are returned by fetch() if the use_array_views option is enabled. If
+    close() is called for a product while there are still views on its data,
+    the actual closing of the product is postponed until all views (and thus
+    all references to the _ProductReference) are gone.
+    """
+
+    def __init__(self, product):
+        self._product = product
+        self._closePending = False
+
+    def __del__(self):
+        if self._closePending:
+            _close(self._product)
+
+
+# dictionary of weak references to the _ProductReference objects of open products.
+# the key is the address of the underlying coda_product.
+_productReferences = {}
+
+def _get_product_reference(product):
+    key = int(product)
+    reference = _productReferences.get(key)
+    if reference is not None:
+        reference = reference()
+    if reference is None:
+        reference = _ProductReference(product)
+        _productReferences[key] = weakref.ref(reference)
+    return reference
+
+
+def close(product):
+    """
+    Close a product that was opened with open().
+
+    If there are still numpy views on the data of the product (see
+    set_option_use_array_views()) the product is closed once the last view is gone.
+    """
+
+    reference = _productReferences.pop(int(product), None)
+    if reference is not None:
+        reference = reference()
+    if reference is not None:
+        reference._closePending = True
+    else:
+        _close(product)
+
+
 #
 # CLASS RECORD; REPRESENTS CODA RECORDS IN PYTHON
 #
@@ -481,6 +536,13 @@ def _fetch_subtree(cursor):
         arrayBaseType = type_get_array_base_type(nodeType)
         arrayBaseClass = type_get_class(arrayBaseType)
 
+        if (arrayBaseClass == coda_record_class) and _useStructuredArrays:
+            # an array of records with a fixed layout is read in one go as a numpy record array.
+            # for records without a fixed layout None is returned and we fall back to Record objects.
+            array = cursor_read_structured_array(cursor,_filterRecordFields)
+            if array is not None:
+                return array.view(numpy.recarray)
+
         if ((arrayBaseClass == coda_array_class)
             or (arrayBaseClass == coda_record_class)):
                 # neither an array of arrays nor an array of records can be read directly.
@@ -493,6 +555,12 @@ def _fetch_subtree(cursor):
             or (arrayBaseClass == coda_text_class)
             or (arrayBaseClass == coda_raw_class)):
 
+            if _useArrayViews and ((arrayBaseClass == coda_integer_class) or (arrayBaseClass == coda_real_class)):
+                # return a read-only view on the product data if the data can be accessed in memory as-is.
+                array = cursor_read_array_view(cursor,_get_product_reference(cursor_get_product_file(cursor)))
+                if array is not None:
+                    return array
+
             # scalar base type.
             arrayBaseReadType = type_get_read_type(arrayBaseType)
             return _readNativeTypeArrayFunctionDictionary[arrayBaseReadType](cursor)
@@ -991,6 +1059,28 @@ def set_option_filter_record_fields(enable):
 def get_option_filter_record_fields():
     return _filterRecordFields
 
+# _useStructuredArrays: if set to True, arrays of records with a fixed layout are returned as numpy record arrays.
+_useStructuredArrays = False
+
+def set_option_use_structured_arrays(enable):
+    global _useStructuredArrays
+
+    _useStructuredArrays = bool(enable)
+
+def get_option_use_structured_arrays():
+    return _useStructuredArrays
+
+# _useArrayViews: if set to True, arrays of numbers are returned as read-only views on the product data when possible.
+_useArrayViews = False
+
+def set_option_use_array_views(enable):
+    global _useArrayViews
+
+    _useArrayViews = bool(enable)
+
+def get_option_use_array_views():
+    return _useArrayViews
+
 #
 # MODULE INITIALIZATION
 #
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2007-2017 S[&]T, The Netherlands.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Check that a product that is opened from a zip file ('archive.zip#entry') is detected by the name of the entry
+ * (both for top-level entries and for entries in a subdirectory of the zip file).
+ * The test creates its own .codadef file and zip file in the current directory.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "coda.h"
+#include "testutil.h"
+
+#define DEFINITION_FILE "test_archive_detection.codadef"
+#define ARCHIVE_FILE "test_archive_detection.zip"
+
+static const char *index_xml =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<cd:ProductClass xmlns:cd=\"http://www.stcorp.nl/coda/definition/2008/07\" name=\"TEST\">\n"
+    " <cd:ProductType name=\"TEST_TYPE\">\n"
+    "  <cd:ProductDefinition id=\"TEST_DEFINITION\" format=\"binary\" version=\"1\">\n"
+    "   <cd:DetectionRule><cd:MatchFilename offset=\"0\">TEST_PRODUCT_</cd:MatchFilename></cd:DetectionRule>\n"
+    "  </cd:ProductDefinition>\n"
+    " </cd:ProductType>\n"
+    "</cd:ProductClass>\n";
+
+static const char *definition_xml =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<cd:ProductDefinition xmlns:cd=\"http://www.stcorp.nl/coda/definition/2008/07\" id=\"TEST_DEFINITION\" "
+    "format=\"binary\">\n"
+    " <cd:Record><cd:Field name=\"data\"><cd:Text><cd:ByteSize>4</cd:ByteSize></cd:Text></cd:Field></cd:Record>\n"
+    "</cd:ProductDefinition>\n";
+
+static int check_entry(const char *entry_name, const char *expected_filename)
+{
+    coda_product *product;
+    coda_expression *expr;
+    coda_cursor cursor;
+    const char *product_type;
+    char filename[256];
+    char *value;
+    long length;
+
+    sprintf(filename, "%s#%s", ARCHIVE_FILE, entry_name);
+    if (coda_open(filename, &product) != 0)
+    {
+        fprintf(stderr, "ERROR: could not open %s (%s)\n", filename, coda_errno_to_string(coda_errno));
+        return -1;
+    }
+    if (coda_get_product_type(product, &product_type) != 0 || product_type == NULL ||
+        strcmp(product_type, "TEST_TYPE") != 0)
+    {
+        fprintf(stderr, "ERROR: %s was not detected by its filename\n", filename);
+        coda_close(product);
+        return -1;
+    }
+
+    if (coda_expression_from_string("filename()", &expr) != 0)
+    {
+        fprintf(stderr, "ERROR: %s\n", coda_errno_to_string(coda_errno));
+        coda_close(product);
+        return -1;
+    }
+    if (coda_cursor_set_product(&cursor, product) != 0 ||
+        coda_expression_eval_string(expr, &cursor, &value, &length) != 0)
+    {
+        fprintf(stderr, "ERROR: could not evaluate filename() for %s (%s)\n", filename,
+                coda_errno_to_string(coda_errno));
+        coda_expression_delete(expr);
+        coda_close(product);
+        return -1;
+    }
+    coda_expression_delete(expr);
+    if (length != (long)strlen(expected_filename) || memcmp(value, expected_filename, length) != 0)
+    {
+        fprintf(stderr, "ERROR: filename() for %s returned '%.*s' instead of '%s'\n", filename, (int)length, value,
+                expected_filename);
+        coda_free(value);
+        coda_close(product);
+        return -1;
+    }
+    coda_free(value);
+    coda_close(product);
+
+    return 0;
+}
+
+int main(void)
+{
+    zip_entry definition_entry[2];
+    zip_entry archive_entry[2];
+    int result = 0;
+
+    definition_entry[0].name = "index.xml";
+    definition_entry[0].data = index_xml;
+    definition_entry[1].name = "products/TEST_DEFINITION.xml";
+    definition_entry[1].data = definition_xml;
+    if (write_zip_file(DEFINITION_FILE, 2, definition_entry) != 0)
+    {
+        return 1;
+    }
+
+    archive_entry[0].name = "TEST_PRODUCT_1.dat";
+    archive_entry[0].data = "DATA";
+    archive_entry[1].name = "dir/TEST_PRODUCT_2.dat";
+    archive_entry[1].data = "DATA";
+    if (write_zip_file(ARCHIVE_FILE, 2, archive_entry) != 0)
+    {
+        return 1;
+    }
+
+    if (coda_set_definition_path(DEFINITION_FILE) != 0 || coda_init() != 0)
+    {
+        fprintf(stderr, "ERROR: could not initialize CODA (%s)\n", coda_errno_to_string(coda_errno));
+        return 1;
+    }
+    if (check_entry("TEST_PRODUCT_1.dat", "TEST_PRODUCT_1.dat") != 0)
+    {
+        result = 1;
+    }
+    if (check_entry("dir/TEST_PRODUCT_2.dat", "TEST_PRODUCT_2.dat") != 0)
+    {
+        result = 1;
+    }
+    coda_done();
+
+    remove(DEFINITION_FILE);
+    remove(ARCHIVE_FILE);
+
+    return result;
+}
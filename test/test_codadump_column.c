@@ -0,0 +1,345 @@
+/*
+ * Copyright (C) 2007-2017 S[&]T, The Netherlands.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Check the 'column' mode of codadump by exporting a small binary product and comparing schema.json and the column
+ * files with the expected content. The product contains an array of records with a variable sized array field, such
+ * that the padding with fill values and the file with the actual dimension lengths are covered as well.
+ * The path of the codadump executable can be passed as argument (default: ./codadump).
+ * The test creates its own .codadef file and product file in the current directory.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "coda.h"
+#include "testutil.h"
+
+#define DEFINITION_FILE "test_codadump_column.codadef"
+#define PRODUCT_FILE "test_codadump_column.dat"
+#define OUTPUT_DIRECTORY "test_codadump_column.columns"
+
+#define NUM_RECORDS 4
+
+static const char *index_xml =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<cd:ProductClass xmlns:cd=\"http://www.stcorp.nl/coda/definition/2008/07\" name=\"TEST\">\n"
+    " <cd:ProductType name=\"TEST_TYPE\">\n"
+    "  <cd:ProductDefinition id=\"TEST_DEFINITION\" format=\"binary\" version=\"1\">\n"
+    "   <cd:DetectionRule><cd:MatchData offset=\"0\">CE01</cd:MatchData></cd:DetectionRule>\n"
+    "  </cd:ProductDefinition>\n"
+    " </cd:ProductType>\n"
+    "</cd:ProductClass>\n";
+
+static const char *definition_xml =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<cd:ProductDefinition xmlns:cd=\"http://www.stcorp.nl/coda/definition/2008/07\" id=\"TEST_DEFINITION\" "
+    "format=\"binary\">\n"
+    " <cd:Record>\n"
+    "  <cd:Field name=\"magic\"><cd:Text><cd:ByteSize>4</cd:ByteSize></cd:Text></cd:Field>\n"
+    "  <cd:Field name=\"data\"><cd:Array><cd:Dimension>4</cd:Dimension><cd:Record>\n"
+    "   <cd:Field name=\"a\"><cd:Integer><cd:Description>field a</cd:Description><cd:Unit>m</cd:Unit>"
+    "<cd:ByteSize>2</cd:ByteSize><cd:NativeType>int16</cd:NativeType></cd:Integer></cd:Field>\n"
+    "   <cd:Field name=\"b\"><cd:Float><cd:ByteSize>8</cd:ByteSize><cd:NativeType>double</cd:NativeType>"
+    "</cd:Float></cd:Field>\n"
+    "   <cd:Field name=\"t\"><cd:Text><cd:ByteSize>2</cd:ByteSize></cd:Text></cd:Field>\n"
+    "   <cd:Field name=\"n\"><cd:Integer><cd:ByteSize>1</cd:ByteSize><cd:NativeType>uint8</cd:NativeType>"
+    "</cd:Integer></cd:Field>\n"
+    "   <cd:Field name=\"values\"><cd:Array><cd:Dimension>int(../n)</cd:Dimension><cd:Integer>"
+    "<cd:ByteSize>2</cd:ByteSize><cd:NativeType>int16</cd:NativeType></cd:Integer></cd:Array></cd:Field>\n"
+    "  </cd:Record></cd:Array></cd:Field>\n"
+    " </cd:Record>\n"
+    "</cd:ProductDefinition>\n";
+
+static const char *expected_schema =
+    "{\n"
+    "  \"product\": \"" PRODUCT_FILE "\",\n"
+    "  \"byte_order\": \"little_endian\",\n"
+    "  \"columns\": [\n"
+    "    {\"name\": \"magic\",\n"
+    "     \"path\": \"/magic\",\n"
+    "     \"file\": \"magic.bin\",\n"
+    "     \"type\": \"char\",\n"
+    "     \"shape\": [4],\n"
+    "     \"fill_value\": 0},\n"
+    "    {\"name\": \"data.a\",\n"
+    "     \"path\": \"/data[]/a\",\n"
+    "     \"file\": \"data.a.bin\",\n"
+    "     \"type\": \"int16\",\n"
+    "     \"shape\": [4],\n"
+    "     \"fill_value\": -32768,\n"
+    "     \"unit\": \"m\",\n"
+    "     \"description\": \"field a\"},\n"
+    "    {\"name\": \"data.b\",\n"
+    "     \"path\": \"/data[]/b\",\n"
+    "     \"file\": \"data.b.bin\",\n"
+    "     \"type\": \"double\",\n"
+    "     \"shape\": [4],\n"
+    "     \"fill_value\": \"NaN\"},\n"
+    "    {\"name\": \"data.t\",\n"
+    "     \"path\": \"/data[]/t\",\n"
+    "     \"file\": \"data.t.bin\",\n"
+    "     \"type\": \"char\",\n"
+    "     \"shape\": [4, 2],\n"
+    "     \"fill_value\": 0},\n"
+    "    {\"name\": \"data.n\",\n"
+    "     \"path\": \"/data[]/n\",\n"
+    "     \"file\": \"data.n.bin\",\n"
+    "     \"type\": \"uint8\",\n"
+    "     \"shape\": [4],\n"
+    "     \"fill_value\": 255},\n"
+    "    {\"name\": \"data.values\",\n"
+    "     \"path\": \"/data[]/values[]\",\n"
+    "     \"file\": \"data.values.bin\",\n"
+    "     \"type\": \"int16\",\n"
+    "     \"shape\": [4, 3],\n"
+    "     \"fill_value\": -32768,\n"
+    "     \"variable_dims\": [{\"dim\": 1, \"file\": \"data.values.dim1.bin\", \"type\": \"int32\", \"shape\": [4]}]}\n"
+    "  ]\n"
+    "}\n";
+
+typedef struct column_data_struct
+{
+    const char *file;
+    unsigned char data[64];
+    long length;
+} column_data;
+
+static column_data column[7];
+static int num_columns = 0;
+
+static int16_t record_a(int i)
+{
+    return (int16_t)(-100 * i - 1);
+}
+
+static double record_b(int i)
+{
+    return i + 0.5;
+}
+
+static int16_t record_value(int i, int k)
+{
+    return (int16_t)(10 * i + k);
+}
+
+static void put_value(unsigned char **data, uint64_t value, int num_bytes, int big_endian)
+{
+    int k;
+
+    for (k = 0; k < num_bytes; k++)
+    {
+        *(*data)++ = (unsigned char)((value >> (8 * (big_endian ? num_bytes - 1 - k : k))) & 0xFF);
+    }
+}
+
+static uint64_t double_bits(double value)
+{
+    uint64_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static column_data *add_column(const char *file)
+{
+    column[num_columns].file = file;
+    column[num_columns].length = 0;
+    return &column[num_columns++];
+}
+
+/* write the product file and determine the expected content of each column file */
+static int write_product_file(void)
+{
+    unsigned char buffer[256];
+    unsigned char *data = buffer;
+    unsigned char *col;
+    int i;
+    int k;
+
+    memcpy(data, "CE01", 4);
+    data += 4;
+    for (i = 0; i < NUM_RECORDS; i++)
+    {
+        /* record i has i values */
+        put_value(&data, (uint16_t)record_a(i), 2, 1);
+        put_value(&data, double_bits(record_b(i)), 8, 1);
+        *data++ = (unsigned char)('A' + i);
+        *data++ = (unsigned char)('a' + i);
+        *data++ = (unsigned char)i;
+        for (k = 0; k < i; k++)
+        {
+            put_value(&data, (uint16_t)record_value(i, k), 2, 1);
+        }
+    }
+    if (write_data_file(PRODUCT_FILE, buffer, (long)(data - buffer)) != 0)
+    {
+        return -1;
+    }
+
+    col = add_column("magic.bin")->data;
+    memcpy(col, "CE01", 4);
+    column[num_columns - 1].length = 4;
+
+    col = add_column("data.a.bin")->data;
+    for (i = 0; i < NUM_RECORDS; i++)
+    {
+        put_value(&col, (uint16_t)record_a(i), 2, 0);
+    }
+    column[num_columns - 1].length = (long)(col - column[num_columns - 1].data);
+
+    col = add_column("data.b.bin")->data;
+    for (i = 0; i < NUM_RECORDS; i++)
+    {
+        put_value(&col, double_bits(record_b(i)), 8, 0);
+    }
+    column[num_columns - 1].length = (long)(col - column[num_columns - 1].data);
+
+    col = add_column("data.t.bin")->data;
+    for (i = 0; i < NUM_RECORDS; i++)
+    {
+        *col++ = (unsigned char)('A' + i);
+        *col++ = (unsigned char)('a' + i);
+    }
+    column[num_columns - 1].length = (long)(col - column[num_columns - 1].data);
+
+    col = add_column("data.n.bin")->data;
+    for (i = 0; i < NUM_RECORDS; i++)
+    {
+        *col++ = (unsigned char)i;
+    }
+    column[num_columns - 1].length = (long)(col - column[num_columns - 1].data);
+
+    /* the values are padded with the fill value up to the largest number of values (3) */
+    col = add_column("data.values.bin")->data;
+    for (i = 0; i < NUM_RECORDS; i++)
+    {
+        for (k = 0; k < NUM_RECORDS - 1; k++)
+        {
+            put_value(&col, k < i ? (uint16_t)record_value(i, k) : 0x8000, 2, 0);
+        }
+    }
+    column[num_columns - 1].length = (long)(col - column[num_columns - 1].data);
+
+    col = add_column("data.values.dim1.bin")->data;
+    for (i = 0; i < NUM_RECORDS; i++)
+    {
+        put_value(&col, (uint32_t)i, 4, 0);
+    }
+    column[num_columns - 1].length = (long)(col - column[num_columns - 1].data);
+
+    return 0;
+}
+
+static int check_file(const char *file, const void *expected_data, long expected_length)
+{
+    char filename[256];
+    char *data;
+    long length;
+    long i;
+
+    sprintf(filename, "%s/%s", OUTPUT_DIRECTORY, file);
+    if (read_data_file(filename, &data, &length) != 0)
+    {
+        return -1;
+    }
+    remove(filename);
+    if (length != expected_length)
+    {
+        fprintf(stderr, "ERROR: %s has %ld bytes instead of %ld\n", filename, length, expected_length);
+        free(data);
+        return -1;
+    }
+    for (i = 0; i < length; i++)
+    {
+        if (data[i] != ((const char *)expected_data)[i])
+        {
+            fprintf(stderr, "ERROR: byte %ld of %s is 0x%02x instead of 0x%02x\n", i, filename,
+                    (unsigned char)data[i], ((const unsigned char *)expected_data)[i]);
+            free(data);
+            return -1;
+        }
+    }
+    free(data);
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *codadump = argc > 1 ? argv[1] : "./codadump";
+    zip_entry definition_entry[2];
+    char command[1024];
+    int result = 0;
+    int i;
+
+    definition_entry[0].name = "index.xml";
+    definition_entry[0].data = index_xml;
+    definition_entry[1].name = "products/TEST_DEFINITION.xml";
+    definition_entry[1].data = definition_xml;
+    if (write_zip_file(DEFINITION_FILE, 2, definition_entry) != 0)
+    {
+        return 1;
+    }
+    if (write_product_file() != 0)
+    {
+        return 1;
+    }
+
+    sprintf(command, "\"%s\" -D %s column -s -o %s %s", codadump, DEFINITION_FILE, OUTPUT_DIRECTORY, PRODUCT_FILE);
+    if (system(command) != 0)
+    {
+        fprintf(stderr, "ERROR: command '%s' failed\n", command);
+        return 1;
+    }
+
+    if (check_file("schema.json", expected_schema, (long)strlen(expected_schema)) != 0)
+    {
+        result = 1;
+    }
+    for (i = 0; i < num_columns; i++)
+    {
+        if (check_file(column[i].file, column[i].data, column[i].length) != 0)
+        {
+            result = 1;
+        }
+    }
+
+    remove(OUTPUT_DIRECTORY);
+    remove(DEFINITION_FILE);
+    remove(PRODUCT_FILE);
+
+    return result;
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2007-2017 S[&]T, The Netherlands.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Check that the parallel export of 'codadump ascii' (-j option) produces exactly the same output as the serial
+ * export. The product contains an array of fixed size records and an array of variable size records that are both
+ * large enough to be split into multiple chunks. The export is also done for a truncated product, for which the
+ * export stops with a read error; the partial output and the error message should then be the same as well.
+ * The path of the codadump executable can be passed as argument (default: ./codadump).
+ * The test creates its own .codadef file and product files in the current directory.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "coda.h"
+#include "testutil.h"
+
+#define DEFINITION_FILE "test_codadump_parallel.codadef"
+#define PRODUCT_FILE "test_codadump_parallel.dat"
+#define TRUNCATED_PRODUCT_FILE "test_codadump_parallel_truncated.dat"
+#define SERIAL_OUTPUT_FILE "test_codadump_parallel_serial.txt"
+#define SERIAL_ERROR_FILE "test_codadump_parallel_serial.err"
+#define PARALLEL_OUTPUT_FILE "test_codadump_parallel.txt"
+#define PARALLEL_ERROR_FILE "test_codadump_parallel.err"
+
+/* this is more than twice the number of values in a chunk of the parallel export */
+#define NUM_RECORDS 40000
+
+static const char *index_xml =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<cd:ProductClass xmlns:cd=\"http://www.stcorp.nl/coda/definition/2008/07\" name=\"TEST\">\n"
+    " <cd:ProductType name=\"TEST_TYPE\">\n"
+    "  <cd:ProductDefinition id=\"TEST_DEFINITION\" format=\"binary\" version=\"1\">\n"
+    "   <cd:DetectionRule><cd:MatchData offset=\"0\">PA01</cd:MatchData></cd:DetectionRule>\n"
+    "  </cd:ProductDefinition>\n"
+    " </cd:ProductType>\n"
+    "</cd:ProductClass>\n";
+
+static const char *definition_xml =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<cd:ProductDefinition xmlns:cd=\"http://www.stcorp.nl/coda/definition/2008/07\" id=\"TEST_DEFINITION\" "
+    "format=\"binary\">\n"
+    " <cd:Record>\n"
+    "  <cd:Field name=\"magic\"><cd:Text><cd:ByteSize>4</cd:ByteSize></cd:Text></cd:Field>\n"
+    "  <cd:Field name=\"fixed\"><cd:Array><cd:Dimension>40000</cd:Dimension><cd:Record>\n"
+    "   <cd:Field name=\"a\"><cd:Integer><cd:ByteSize>4</cd:ByteSize><cd:NativeType>int32</cd:NativeType>"
+    "</cd:Integer></cd:Field>\n"
+    "   <cd:Field name=\"b\"><cd:Float><cd:ByteSize>8</cd:ByteSize><cd:NativeType>double</cd:NativeType>"
+    "</cd:Float></cd:Field>\n"
+    "   <cd:Field name=\"t\"><cd:Text><cd:ByteSize>3</cd:ByteSize></cd:Text></cd:Field>\n"
+    "  </cd:Record></cd:Array></cd:Field>\n"
+    "  <cd:Field name=\"variable\"><cd:Array><cd:Dimension>40000</cd:Dimension><cd:Record>\n"
+    "   <cd:Field name=\"n\"><cd:Integer><cd:ByteSize>1</cd:ByteSize><cd:NativeType>uint8</cd:NativeType>"
+    "</cd:Integer></cd:Field>\n"
+    "   <cd:Field name=\"values\"><cd:Array><cd:Dimension>int(../n)</cd:Dimension><cd:Integer>"
+    "<cd:ByteSize>2</cd:ByteSize><cd:NativeType>int16</cd:NativeType></cd:Integer></cd:Array></cd:Field>\n"
+    "  </cd:Record></cd:Array></cd:Field>\n"
+    " </cd:Record>\n"
+    "</cd:ProductDefinition>\n";
+
+static void put_big_endian(unsigned char **data, uint64_t value, int num_bytes)
+{
+    int k;
+
+    for (k = num_bytes - 1; k >= 0; k--)
+    {
+        *(*data)++ = (unsigned char)((value >> (8 * k)) & 0xFF);
+    }
+}
+
+static int write_product_files(void)
+{
+    unsigned char *buffer;
+    unsigned char *data;
+    long length;
+    int i;
+    int k;
+
+    buffer = malloc(4 + NUM_RECORDS * (15 + 1 + 3 * 2));
+    if (buffer == NULL)
+    {
+        fprintf(stderr, "ERROR: out of memory\n");
+        return -1;
+    }
+    data = buffer;
+    memcpy(data, "PA01", 4);
+    data += 4;
+    for (i = 0; i < NUM_RECORDS; i++)
+    {
+        double b = i / 3.0;
+        uint64_t b_bits;
+
+        memcpy(&b_bits, &b, sizeof(b));
+        put_big_endian(&data, (uint32_t)(7 * i - 100000), 4);
+        put_big_endian(&data, b_bits, 8);
+        *data++ = (unsigned char)('A' + i % 26);
+        *data++ = (unsigned char)('a' + i % 26);
+        *data++ = (unsigned char)('0' + i % 10);
+    }
+    for (i = 0; i < NUM_RECORDS; i++)
+    {
+        /* record i has i % 4 values */
+        *data++ = (unsigned char)(i % 4);
+        for (k = 0; k < i % 4; k++)
+        {
+            put_big_endian(&data, (uint16_t)((3 * i + k) % 30000), 2);
+        }
+    }
+    length = (long)(data - buffer);
+    if (write_data_file(PRODUCT_FILE, buffer, length) != 0 ||
+        write_data_file(TRUNCATED_PRODUCT_FILE, buffer, length - NUM_RECORDS) != 0)
+    {
+        free(buffer);
+        return -1;
+    }
+    free(buffer);
+
+    return 0;
+}
+
+static int compare_files(const char *filename1, const char *filename2)
+{
+    char *data1;
+    char *data2;
+    long length1;
+    long length2;
+    int result = 0;
+
+    if (read_data_file(filename1, &data1, &length1) != 0)
+    {
+        return -1;
+    }
+    if (read_data_file(filename2, &data2, &length2) != 0)
+    {
+        free(data1);
+        return -1;
+    }
+    if (length1 != length2 || memcmp(data1, data2, length1) != 0)
+    {
+        fprintf(stderr, "ERROR: %s differs from %s\n", filename1, filename2);
+        result = -1;
+    }
+    free(data1);
+    free(data2);
+
+    return result;
+}
+
+static int check_export(const char *codadump, const char *options, const char *product_file, int num_threads)
+{
+    char command[1024];
+    int serial_result;
+    int parallel_result;
+
+    sprintf(command, "\"%s\" -D %s ascii %s -o %s %s 2> %s", codadump, DEFINITION_FILE, options, SERIAL_OUTPUT_FILE,
+            product_file, SERIAL_ERROR_FILE);
+    serial_result = system(command);
+    sprintf(command, "\"%s\" -D %s ascii -j %d %s -o %s %s 2> %s", codadump, DEFINITION_FILE, num_threads, options,
+            PARALLEL_OUTPUT_FILE, product_file, PARALLEL_ERROR_FILE);
+    parallel_result = system(command);
+    if (parallel_result != serial_result)
+    {
+        fprintf(stderr, "ERROR: command '%s' returned %d instead of %d\n", command, parallel_result, serial_result);
+        return -1;
+    }
+    if (compare_files(PARALLEL_OUTPUT_FILE, SERIAL_OUTPUT_FILE) != 0 ||
+        compare_files(PARALLEL_ERROR_FILE, SERIAL_ERROR_FILE) != 0)
+    {
+        fprintf(stderr, "ERROR: output of command '%s' differs from the serial export\n", command);
+        return -1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *codadump = argc > 1 ? argv[1] : "./codadump";
+    zip_entry definition_entry[2];
+    int result = 0;
+
+#ifndef HAVE_PTHREAD
+    (void)codadump;
+    (void)definition_entry;
+    printf("parallel export is not available (POSIX threads not found)\n");
+    return 77;
+#else
+    definition_entry[0].name = "index.xml";
+    definition_entry[0].data = index_xml;
+    definition_entry[1].name = "products/TEST_DEFINITION.xml";
+    definition_entry[1].data = definition_xml;
+    if (write_zip_file(DEFINITION_FILE, 2, definition_entry) != 0)
+    {
+        return 1;
+    }
+    if (write_product_files() != 0)
+    {
+        return 1;
+    }
+
+    if (check_export(codadump, "", PRODUCT_FILE, 2) != 0)
+    {
+        result = 1;
+    }
+    if (check_export(codadump, "-i -l -q", PRODUCT_FILE, 3) != 0)
+    {
+        result = 1;
+    }
+    if (check_export(codadump, "-s ,", PRODUCT_FILE, 8) != 0)
+    {
+        result = 1;
+    }
+    if (check_export(codadump, "-i", TRUNCATED_PRODUCT_FILE, 4) != 0)
+    {
+        result = 1;
+    }
+
+    remove(SERIAL_OUTPUT_FILE);
+    remove(SERIAL_ERROR_FILE);
+    remove(PARALLEL_OUTPUT_FILE);
+    remove(PARALLEL_ERROR_FILE);
+    remove(DEFINITION_FILE);
+    remove(PRODUCT_FILE);
+    remove(TRUNCATED_PRODUCT_FILE);
+
+    return result;
+#endif
+}
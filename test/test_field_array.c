@@ -0,0 +1,344 @@
+/*
+ * Copyright (C) 2007-2017 S[&]T, The Netherlands.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Check that the coda_cursor_read_<type>_field_array() functions return the same values as navigating to the field
+ * of each array element separately. This is done both for an array of fixed size records (where the position of the
+ * field is calculated directly from the element size) and for an array of variable size records (where the path is
+ * replayed for each element). The test creates its own .codadef file and product file in the current directory.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "coda.h"
+#include "testutil.h"
+
+#define DEFINITION_FILE "test_field_array.codadef"
+#define PRODUCT_FILE "test_field_array.dat"
+
+#define NUM_FIXED 5
+#define NUM_VARIABLE 3
+
+static const char *index_xml =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<cd:ProductClass xmlns:cd=\"http://www.stcorp.nl/coda/definition/2008/07\" name=\"TEST\">\n"
+    " <cd:ProductType name=\"TEST_TYPE\">\n"
+    "  <cd:ProductDefinition id=\"TEST_DEFINITION\" format=\"binary\" version=\"1\">\n"
+    "   <cd:DetectionRule><cd:MatchData offset=\"0\">FA01</cd:MatchData></cd:DetectionRule>\n"
+    "  </cd:ProductDefinition>\n"
+    " </cd:ProductType>\n"
+    "</cd:ProductClass>\n";
+
+static const char *definition_xml =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<cd:ProductDefinition xmlns:cd=\"http://www.stcorp.nl/coda/definition/2008/07\" id=\"TEST_DEFINITION\" "
+    "format=\"binary\">\n"
+    " <cd:Record>\n"
+    "  <cd:Field name=\"magic\"><cd:Text><cd:ByteSize>4</cd:ByteSize></cd:Text></cd:Field>\n"
+    "  <cd:Field name=\"fixed\"><cd:Array><cd:Dimension>5</cd:Dimension><cd:Record>\n"
+    "   <cd:Field name=\"a\"><cd:Integer><cd:ByteSize>2</cd:ByteSize><cd:NativeType>int16</cd:NativeType>"
+    "</cd:Integer></cd:Field>\n"
+    "   <cd:Field name=\"b\"><cd:Float><cd:ByteSize>8</cd:ByteSize><cd:NativeType>double</cd:NativeType>"
+    "</cd:Float></cd:Field>\n"
+    "   <cd:Field name=\"c\"><cd:Array><cd:Dimension>3</cd:Dimension><cd:Integer><cd:ByteSize>1</cd:ByteSize>"
+    "<cd:NativeType>uint8</cd:NativeType></cd:Integer></cd:Array></cd:Field>\n"
+    "  </cd:Record></cd:Array></cd:Field>\n"
+    "  <cd:Field name=\"variable\"><cd:Array><cd:Dimension>3</cd:Dimension><cd:Record>\n"
+    "   <cd:Field name=\"n\"><cd:Integer><cd:ByteSize>1</cd:ByteSize><cd:NativeType>uint8</cd:NativeType>"
+    "</cd:Integer></cd:Field>\n"
+    "   <cd:Field name=\"values\"><cd:Array><cd:Dimension>int(../n)</cd:Dimension><cd:Integer>"
+    "<cd:ByteSize>2</cd:ByteSize><cd:NativeType>int16</cd:NativeType></cd:Integer></cd:Array></cd:Field>\n"
+    "   <cd:Field name=\"last\"><cd:Integer><cd:ByteSize>4</cd:ByteSize><cd:NativeType>int32</cd:NativeType>"
+    "</cd:Integer></cd:Field>\n"
+    "  </cd:Record></cd:Array></cd:Field>\n"
+    " </cd:Record>\n"
+    "</cd:ProductDefinition>\n";
+
+static int16_t fixed_a(int i)
+{
+    return (int16_t)(-100 * i - 1);
+}
+
+static double fixed_b(int i)
+{
+    return i + 0.25;
+}
+
+static uint8_t fixed_c(int i, int k)
+{
+    return (uint8_t)((k + 1) * i + 200);
+}
+
+static int16_t variable_value(int i, int k)
+{
+    return (int16_t)(10 * i + k - 5);
+}
+
+static int32_t variable_last(int i)
+{
+    return 100000 + i;
+}
+
+static void put_big_endian(unsigned char **data, uint64_t value, int num_bytes)
+{
+    int k;
+
+    for (k = num_bytes - 1; k >= 0; k--)
+    {
+        *(*data)++ = (unsigned char)((value >> (8 * k)) & 0xFF);
+    }
+}
+
+static int write_product_file(void)
+{
+    unsigned char buffer[256];
+    unsigned char *data = buffer;
+    int i;
+    int k;
+
+    memcpy(data, "FA01", 4);
+    data += 4;
+    for (i = 0; i < NUM_FIXED; i++)
+    {
+        double b = fixed_b(i);
+        uint64_t b_bits;
+
+        memcpy(&b_bits, &b, sizeof(b));
+        put_big_endian(&data, (uint16_t)fixed_a(i), 2);
+        put_big_endian(&data, b_bits, 8);
+        for (k = 0; k < 3; k++)
+        {
+            put_big_endian(&data, fixed_c(i, k), 1);
+        }
+    }
+    for (i = 0; i < NUM_VARIABLE; i++)
+    {
+        /* element i has i + 1 values */
+        put_big_endian(&data, i + 1, 1);
+        for (k = 0; k <= i; k++)
+        {
+            put_big_endian(&data, (uint16_t)variable_value(i, k), 2);
+        }
+        put_big_endian(&data, (uint32_t)variable_last(i), 4);
+    }
+
+    return write_data_file(PRODUCT_FILE, buffer, (long)(data - buffer));
+}
+
+/* compare the result of a gather with navigating to 'path' within each array element */
+static int check_field(const coda_cursor *array_cursor, const char *path, long num_elements, const double *expected)
+{
+    coda_cursor cursor;
+    int16_t int16_values[NUM_FIXED];
+    double double_values[NUM_FIXED];
+    long i;
+
+    if (coda_cursor_read_double_field_array(array_cursor, path, double_values) != 0)
+    {
+        fprintf(stderr, "ERROR: could not gather '%s' (%s)\n", path, coda_errno_to_string(coda_errno));
+        return -1;
+    }
+    if (coda_cursor_read_int16_field_array(array_cursor, path, int16_values) != 0)
+    {
+        fprintf(stderr, "ERROR: could not gather '%s' as int16 (%s)\n", path, coda_errno_to_string(coda_errno));
+        return -1;
+    }
+    for (i = 0; i < num_elements; i++)
+    {
+        double value;
+
+        cursor = *array_cursor;
+        if (coda_cursor_goto_array_element_by_index(&cursor, i) != 0 || coda_cursor_goto(&cursor, path) != 0 ||
+            coda_cursor_read_double(&cursor, &value) != 0)
+        {
+            fprintf(stderr, "ERROR: could not read '%s' of element %ld (%s)\n", path, i,
+                    coda_errno_to_string(coda_errno));
+            return -1;
+        }
+        if (value != expected[i] || double_values[i] != expected[i] || int16_values[i] != (int16_t)expected[i])
+        {
+            fprintf(stderr, "ERROR: '%s' of element %ld is %g (gather: %g, int16 gather: %d) instead of %g\n", path,
+                    i, value, double_values[i], (int)int16_values[i], expected[i]);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int check_product(coda_product *product)
+{
+    coda_cursor cursor;
+    double expected[NUM_FIXED];
+    double double_values[NUM_FIXED];
+    uint8_t uint8_values[NUM_FIXED];
+    int32_t int32_values[NUM_VARIABLE];
+    int result = 0;
+    int i;
+
+    if (coda_cursor_set_product(&cursor, product) != 0)
+    {
+        fprintf(stderr, "ERROR: %s\n", coda_errno_to_string(coda_errno));
+        return -1;
+    }
+
+    /* a gather needs a cursor that points to an array */
+    if (coda_cursor_read_double_field_array(&cursor, "magic", double_values) == 0)
+    {
+        fprintf(stderr, "ERROR: gather on a record did not fail\n");
+        result = -1;
+    }
+
+    /* array of fixed size records */
+    if (coda_cursor_goto(&cursor, "/fixed") != 0)
+    {
+        fprintf(stderr, "ERROR: %s\n", coda_errno_to_string(coda_errno));
+        return -1;
+    }
+    for (i = 0; i < NUM_FIXED; i++)
+    {
+        expected[i] = fixed_a(i);
+    }
+    if (check_field(&cursor, "a", NUM_FIXED, expected) != 0)
+    {
+        result = -1;
+    }
+    if (coda_cursor_read_double_field_array(&cursor, "b", double_values) != 0)
+    {
+        fprintf(stderr, "ERROR: could not gather 'b' (%s)\n", coda_errno_to_string(coda_errno));
+        result = -1;
+    }
+    for (i = 0; i < NUM_FIXED; i++)
+    {
+        if (double_values[i] != fixed_b(i))
+        {
+            fprintf(stderr, "ERROR: 'b' of element %d is %g instead of %g\n", i, double_values[i], fixed_b(i));
+            result = -1;
+        }
+    }
+    if (coda_cursor_read_uint8_field_array(&cursor, "c[2]", uint8_values) != 0)
+    {
+        fprintf(stderr, "ERROR: could not gather 'c[2]' (%s)\n", coda_errno_to_string(coda_errno));
+        result = -1;
+    }
+    for (i = 0; i < NUM_FIXED; i++)
+    {
+        if (uint8_values[i] != fixed_c(i, 2))
+        {
+            fprintf(stderr, "ERROR: 'c[2]' of element %d is %d instead of %d\n", i, (int)uint8_values[i],
+                    (int)fixed_c(i, 2));
+            result = -1;
+        }
+    }
+
+    /* the path has to stay within the array element */
+    if (coda_cursor_read_double_field_array(&cursor, "/variable[0]/last", double_values) == 0)
+    {
+        fprintf(stderr, "ERROR: gather of a path outside the array element did not fail\n");
+        result = -1;
+    }
+
+    /* array of variable size records */
+    if (coda_cursor_goto(&cursor, "/variable") != 0)
+    {
+        fprintf(stderr, "ERROR: %s\n", coda_errno_to_string(coda_errno));
+        return -1;
+    }
+    for (i = 0; i < NUM_VARIABLE; i++)
+    {
+        expected[i] = variable_value(i, 0);
+    }
+    if (check_field(&cursor, "values[0]", NUM_VARIABLE, expected) != 0)
+    {
+        result = -1;
+    }
+    if (coda_cursor_read_int32_field_array(&cursor, "last", int32_values) != 0)
+    {
+        fprintf(stderr, "ERROR: could not gather 'last' (%s)\n", coda_errno_to_string(coda_errno));
+        result = -1;
+    }
+    for (i = 0; i < NUM_VARIABLE; i++)
+    {
+        if (int32_values[i] != variable_last(i))
+        {
+            fprintf(stderr, "ERROR: 'last' of element %d is %ld instead of %ld\n", i, (long)int32_values[i],
+                    (long)variable_last(i));
+            result = -1;
+        }
+    }
+
+    return result;
+}
+
+int main(void)
+{
+    zip_entry definition_entry[2];
+    coda_product *product;
+    int result;
+
+    definition_entry[0].name = "index.xml";
+    definition_entry[0].data = index_xml;
+    definition_entry[1].name = "products/TEST_DEFINITION.xml";
+    definition_entry[1].data = definition_xml;
+    if (write_zip_file(DEFINITION_FILE, 2, definition_entry) != 0)
+    {
+        return 1;
+    }
+    if (write_product_file() != 0)
+    {
+        return 1;
+    }
+
+    if (coda_set_definition_path(DEFINITION_FILE) != 0 || coda_init() != 0)
+    {
+        fprintf(stderr, "ERROR: could not initialize CODA (%s)\n", coda_errno_to_string(coda_errno));
+        return 1;
+    }
+    if (coda_open(PRODUCT_FILE, &product) != 0)
+    {
+        fprintf(stderr, "ERROR: could not open %s (%s)\n", PRODUCT_FILE, coda_errno_to_string(coda_errno));
+        coda_done();
+        return 1;
+    }
+    result = check_product(product) != 0;
+    coda_close(product);
+    coda_done();
+
+    remove(DEFINITION_FILE);
+    remove(PRODUCT_FILE);
+
+    return result;
+}
@@ -0,0 +1,299 @@
+/*
+ * Copyright (C) 2007-2017 S[&]T, The Netherlands.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Check the formatting of floating point values by codadump (json/yaml modes).
+ * Each value should be printed with the least number of significant digits that converts back to exactly the same
+ * value. This is checked for random double and float values (including subnormal values), both for the Grisu3
+ * algorithm and for the printf/strtod based fallback that is used for values that Grisu3 can not handle.
+ * The static functions of codadump-output.c are tested directly by including the source file.
+ */
+
+#include "../tools/codadump/codadump-output.c"
+
+FILE *ascii_output = NULL;
+
+#define NUM_RANDOM_VALUES 20000
+
+typedef struct expected_output_struct
+{
+    double value;
+    int is_float;
+    const char *str;
+} expected_output;
+
+static const expected_output expected[] = {
+    {0.1, 0, "0.1"},
+    {0.3, 0, "0.3"},
+    {-2.5, 0, "-2.5"},
+    {100.0, 0, "100"},
+    {-0.0, 0, "-0"},
+    {123456.75, 0, "123456.75"},
+    {0.0001, 0, "0.0001"},
+    {1e-5, 0, "1e-05"},
+    {2.0 / 3.0, 0, "0.6666666666666666"},
+    {1e16, 0, "1e+16"},
+    {1.5e16, 0, "1.5e+16"},
+    {1.7976931348623157e308, 0, "1.7976931348623157e+308"},
+    {2.2250738585072014e-308, 0, "2.2250738585072014e-308"},
+    {4.9406564584124654e-324, 0, "5e-324"},
+    {0.1f, 1, "0.1"},
+    {16777216.0f, 1, "1.6777216e+07"},
+    {3.4028235e38f, 1, "3.4028235e+38"},
+    {1.17549435e-38f, 1, "1.1754944e-38"},
+    {1.4e-45f, 1, "1e-45"}
+};
+
+#define NUM_EXPECTED ((int)(sizeof(expected) / sizeof(expected[0])))
+
+static uint64_t random_state = 0x2545F4914F6CDD1DULL;
+
+static uint64_t random_bits(void)
+{
+    /* xorshift64 */
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+    return random_state;
+}
+
+static const char *format_real(double value, int is_float)
+{
+    static char str[64];
+
+    output_length = 0;
+    output_real(value, is_float);
+    assert(output_length < (long)sizeof(str));
+    memcpy(str, output_buffer, output_length);
+    str[output_length] = '\0';
+    output_length = 0;
+
+    return str;
+}
+
+/* the smallest number of significant digits with which printf produces a value that converts back to value */
+static int get_shortest_precision(double value, int is_float)
+{
+    char str[32];
+    int precision;
+
+    for (precision = 1; precision < 17; precision++)
+    {
+        double result;
+
+        sprintf(str, "%.*e", precision - 1, value);
+        result = strtod(str, NULL);
+        if (is_float ? (float)result == (float)value : result == value)
+        {
+            break;
+        }
+    }
+
+    return precision;
+}
+
+/* the number of significant digits in a formatted value */
+static int get_num_significant_digits(const char *str)
+{
+    int num_digits = 0;
+    int num_trailing_zeros = 0;
+
+    while (*str != '\0' && *str != 'e' && (*str < '1' || *str > '9'))
+    {
+        str++;
+    }
+    while (*str != '\0' && *str != 'e')
+    {
+        if (*str >= '0' && *str <= '9')
+        {
+            num_digits++;
+            num_trailing_zeros = (*str == '0') ? num_trailing_zeros + 1 : 0;
+        }
+        str++;
+    }
+
+    return num_digits - num_trailing_zeros;
+}
+
+static int check_value(double value, int is_float)
+{
+    const char *str = format_real(value, is_float);
+    double result = strtod(str, NULL);
+
+    if (is_float ? (float)result != (float)value : result != value)
+    {
+        fprintf(stderr, "ERROR: %s value %.17g was printed as '%s', which does not convert back\n",
+                is_float ? "float" : "double", value, str);
+        return -1;
+    }
+    if (value != (double)(int64_t)value && get_num_significant_digits(str) != get_shortest_precision(value, is_float))
+    {
+        fprintf(stderr, "ERROR: %s value %.17g was printed as '%s' instead of with %d significant digits\n",
+                is_float ? "float" : "double", value, str, get_shortest_precision(value, is_float));
+        return -1;
+    }
+
+    return 0;
+}
+
+/* compare the digits of Grisu3 with those of the printf/strtod fallback */
+static int check_fallback(double value, int is_float, int *num_grisu3_failures)
+{
+    char grisu3_digits[MAX_NUM_DIGITS];
+    char digits[MAX_NUM_DIGITS];
+    int grisu3_num_digits;
+    int grisu3_exponent;
+    int num_digits;
+    int exponent;
+
+    if (value < 0)
+    {
+        value = -value;
+    }
+    if (value == 0)
+    {
+        return 0;
+    }
+
+    get_round_trip_digits(value, is_float, digits, &num_digits, &exponent);
+    while (num_digits > 1 && digits[num_digits - 1] == '0')
+    {
+        num_digits--;
+    }
+    if (num_digits != get_shortest_precision(value, is_float))
+    {
+        fprintf(stderr, "ERROR: fallback for %s value %.17g returned %.*se%d\n", is_float ? "float" : "double", value,
+                num_digits, digits, exponent);
+        return -1;
+    }
+
+    if (!grisu3(value, is_float, grisu3_digits, &grisu3_num_digits, &grisu3_exponent))
+    {
+        (*num_grisu3_failures)++;
+        return 0;
+    }
+    while (grisu3_num_digits > 1 && grisu3_digits[grisu3_num_digits - 1] == '0')
+    {
+        grisu3_num_digits--;
+    }
+    if (grisu3_num_digits != num_digits || grisu3_exponent != exponent ||
+        memcmp(grisu3_digits, digits, num_digits) != 0)
+    {
+        fprintf(stderr, "ERROR: Grisu3 for %s value %.17g returned %.*se%d instead of %.*se%d\n",
+                is_float ? "float" : "double", value, grisu3_num_digits, grisu3_digits, grisu3_exponent, num_digits,
+                digits, exponent);
+        return -1;
+    }
+
+    return 0;
+}
+
+static double random_double(int subnormal)
+{
+    uint64_t bits = random_bits();
+    double value;
+
+    if (subnormal)
+    {
+        /* clear the exponent */
+        bits &= ~((uint64_t)0x7ff << 52);
+    }
+    else if (((bits >> 52) & 0x7ff) == 0x7ff)
+    {
+        /* no NaN or Inf */
+        bits ^= (uint64_t)1 << 52;
+    }
+    memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
+
+static double random_float(int subnormal)
+{
+    uint32_t bits = (uint32_t)(random_bits() >> 32);
+    float value;
+
+    if (subnormal)
+    {
+        bits &= ~((uint32_t)0xff << 23);
+    }
+    else if (((bits >> 23) & 0xff) == 0xff)
+    {
+        bits ^= (uint32_t)1 << 23;
+    }
+    memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
+
+int main(void)
+{
+    int num_grisu3_failures = 0;
+    int num_errors = 0;
+    int i;
+
+    for (i = 0; i < NUM_EXPECTED; i++)
+    {
+        const char *str = format_real(expected[i].value, expected[i].is_float);
+
+        if (strcmp(str, expected[i].str) != 0)
+        {
+            fprintf(stderr, "ERROR: %s value %.17g was printed as '%s' instead of '%s'\n",
+                    expected[i].is_float ? "float" : "double", expected[i].value, str, expected[i].str);
+            num_errors++;
+        }
+    }
+
+    for (i = 0; i < NUM_RANDOM_VALUES && num_errors < 10; i++)
+    {
+        int subnormal = (i % 4 == 0);
+        double value;
+
+        value = random_double(subnormal);
+        if (check_value(value, 0) != 0 || check_fallback(value, 0, &num_grisu3_failures) != 0)
+        {
+            num_errors++;
+        }
+        value = random_float(subnormal);
+        if (check_value(value, 1) != 0 || check_fallback(value, 1, &num_grisu3_failures) != 0)
+        {
+            num_errors++;
+        }
+    }
+
+    /* make sure that the values that Grisu3 rejects (and thus the fallback in output_real()) were covered */
+    if (num_grisu3_failures == 0)
+    {
+        fprintf(stderr, "ERROR: none of the values needed the printf/strtod fallback\n");
+        num_errors++;
+    }
+
+    return num_errors > 0;
+}
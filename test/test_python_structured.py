@@ -0,0 +1,187 @@
+"""
+Copyright (C) 2007-2017 S[&]T, The Netherlands.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+"""
+
+
+# Check that coda.fetch() returns the same data for an array of records when
+# the option to use numpy record arrays (structured arrays) is enabled as when
+# the records are returned as Record objects. The product contains an array of
+# records with a fixed layout (scalar fields, a text field, an array field and
+# a nested record) and an array of records with a variable layout (for which
+# Record objects should still be returned).
+#
+# Usage: test_python_structured.py [<CODA python module> <CODA python directory>]
+#
+# The CODA python package is assembled in a temporary directory from the
+# python module (_codac) and the python files of the CODA python directory.
+# If no arguments are given, the paths are taken from the environment
+# variables CODA_PYTHON_MODULE and CODA_PYTHON_DIR.
+
+import os
+import shutil
+import struct
+import sys
+import tempfile
+import zipfile
+
+NUM_RECORDS = 50
+
+index_xml = """<?xml version="1.0" encoding="UTF-8"?>
+<cd:ProductClass xmlns:cd="http://www.stcorp.nl/coda/definition/2008/07" name="TEST">
+ <cd:ProductType name="TEST_TYPE">
+  <cd:ProductDefinition id="TEST_DEFINITION" format="binary" version="1">
+   <cd:DetectionRule><cd:MatchData offset="0">PY01</cd:MatchData></cd:DetectionRule>
+  </cd:ProductDefinition>
+ </cd:ProductType>
+</cd:ProductClass>
+"""
+
+definition_xml = """<?xml version="1.0" encoding="UTF-8"?>
+<cd:ProductDefinition xmlns:cd="http://www.stcorp.nl/coda/definition/2008/07" id="TEST_DEFINITION" format="binary">
+ <cd:Record>
+  <cd:Field name="magic"><cd:Text><cd:ByteSize>4</cd:ByteSize></cd:Text></cd:Field>
+  <cd:Field name="fixed"><cd:Array><cd:Dimension>50</cd:Dimension><cd:Record>
+   <cd:Field name="a"><cd:Integer><cd:ByteSize>2</cd:ByteSize><cd:NativeType>int16</cd:NativeType></cd:Integer></cd:Field>
+   <cd:Field name="b"><cd:Float><cd:ByteSize>8</cd:ByteSize><cd:NativeType>double</cd:NativeType></cd:Float></cd:Field>
+   <cd:Field name="t"><cd:Text><cd:ByteSize>3</cd:ByteSize></cd:Text></cd:Field>
+   <cd:Field name="c"><cd:Array><cd:Dimension>2</cd:Dimension><cd:Integer><cd:ByteSize>4</cd:ByteSize><cd:NativeType>int32</cd:NativeType></cd:Integer></cd:Array></cd:Field>
+   <cd:Field name="nested"><cd:Record>
+    <cd:Field name="x"><cd:Integer><cd:ByteSize>1</cd:ByteSize><cd:NativeType>uint8</cd:NativeType></cd:Integer></cd:Field>
+    <cd:Field name="y"><cd:Float><cd:ByteSize>4</cd:ByteSize><cd:NativeType>float</cd:NativeType></cd:Float></cd:Field>
+   </cd:Record></cd:Field>
+  </cd:Record></cd:Array></cd:Field>
+  <cd:Field name="variable"><cd:Array><cd:Dimension>50</cd:Dimension><cd:Record>
+   <cd:Field name="n"><cd:Integer><cd:ByteSize>1</cd:ByteSize><cd:NativeType>uint8</cd:NativeType></cd:Integer></cd:Field>
+   <cd:Field name="values"><cd:Array><cd:Dimension>int(../n)</cd:Dimension><cd:Integer><cd:ByteSize>2</cd:ByteSize><cd:NativeType>int16</cd:NativeType></cd:Integer></cd:Array></cd:Field>
+  </cd:Record></cd:Array></cd:Field>
+ </cd:Record>
+</cd:ProductDefinition>
+"""
+
+
+def write_files(directory):
+    definition_file = os.path.join(directory, "TEST.codadef")
+    with zipfile.ZipFile(definition_file, "w") as zf:
+        zf.writestr("index.xml", index_xml)
+        zf.writestr("products/TEST_DEFINITION.xml", definition_xml)
+
+    data = b"PY01"
+    for i in range(NUM_RECORDS):
+        text = bytes([ord("A") + i % 26, ord("a") + i % 26, ord("0") + i % 10])
+        data += struct.pack(">hd", -100 * i - 1, i / 3.0) + text
+        data += struct.pack(">iiBf", 1000 * i, -1000 * i, i, i + 0.5)
+    for i in range(NUM_RECORDS):
+        # record i has i % 4 values
+        data += struct.pack(">B%dh" % (i % 4), i % 4, *[10 * i + k for k in range(i % 4)])
+    product_file = os.path.join(directory, "test_python_structured.dat")
+    with open(product_file, "wb") as f:
+        f.write(data)
+
+    return definition_file, product_file
+
+
+def create_package(directory, module, python_dir):
+    package_dir = os.path.join(directory, "coda")
+    os.mkdir(package_dir)
+    for filename in ("__init__.py", "codac.py", "codapython.py"):
+        shutil.copy(os.path.join(python_dir, filename), package_dir)
+    shutil.copy(module, package_dir)
+    sys.path.insert(0, directory)
+
+
+def check(condition, message):
+    if not condition:
+        raise AssertionError(message)
+
+
+def check_product(coda, numpy, product_file):
+    product = coda.open(product_file)
+    try:
+        coda.set_option_use_structured_arrays(False)
+        records = coda.fetch(product, "fixed")
+        variable_records = coda.fetch(product, "variable")
+
+        coda.set_option_use_structured_arrays(True)
+        array = coda.fetch(product, "fixed")
+        check(isinstance(array, numpy.recarray), "array of fixed layout records is not a numpy.recarray")
+        check(array.shape == (NUM_RECORDS,), "record array has shape %s" % (array.shape,))
+        check(array.dtype.names == ("a", "b", "t", "c", "nested"), "record array has fields %s" % (array.dtype.names,))
+        check(array.dtype["a"] == numpy.int16 and array.dtype["b"] == numpy.float64, "wrong numeric field types")
+        check(array.dtype["t"] == numpy.dtype("S3"), "text field has type %s" % array.dtype["t"])
+        check(array.dtype["c"].shape == (2,), "array field has shape %s" % (array.dtype["c"].shape,))
+        check(array.dtype["nested"].names == ("x", "y"), "nested record has fields %s" % (array.dtype["nested"].names,))
+        for i in range(NUM_RECORDS):
+            record = records[i]
+            check(array[i].a == record.a and array.a[i] == record.a, "field a of record %d differs" % i)
+            check(array[i].b == record.b, "field b of record %d differs" % i)
+            check(array[i].t == record.t.encode("ascii"), "field t of record %d differs" % i)
+            check(numpy.array_equal(array[i].c, record.c), "field c of record %d differs" % i)
+            check(array[i].nested.x == record.nested.x, "field nested.x of record %d differs" % i)
+            check(array["nested"]["y"][i] == record.nested.y, "field nested.y of record %d differs" % i)
+
+        # a single record and records with a variable layout are still returned as Record objects
+        check(isinstance(coda.fetch(product, "fixed", 3), coda.Record), "single record is not a Record")
+        array = coda.fetch(product, "variable")
+        check(array.dtype == numpy.object_ and isinstance(array[0], coda.Record),
+              "array of variable layout records is not returned as Record objects")
+        for i in range(NUM_RECORDS):
+            check(array[i].n == variable_records[i].n, "field n of variable record %d differs" % i)
+    finally:
+        coda.set_option_use_structured_arrays(False)
+        coda.close(product)
+
+
+def main():
+    if len(sys.argv) > 2:
+        module, python_dir = sys.argv[1], sys.argv[2]
+    else:
+        module, python_dir = os.environ["CODA_PYTHON_MODULE"], os.environ["CODA_PYTHON_DIR"]
+
+    directory = tempfile.mkdtemp()
+    try:
+        definition_file, product_file = write_files(directory)
+        create_package(directory, module, python_dir)
+        os.environ["CODA_DEFINITION"] = definition_file
+
+        import numpy
+        import coda
+
+        check_product(coda, numpy, product_file)
+    except AssertionError as e:
+        print("ERROR: %s" % e)
+        return 1
+    finally:
+        shutil.rmtree(directory)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2007-2017 S[&]T, The Netherlands.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "testutil.h"
+
+static unsigned long crc32_of_data(const char *data, long length)
+{
+    unsigned long crc = 0xFFFFFFFFUL;
+    long i;
+    int k;
+
+    for (i = 0; i < length; i++)
+    {
+        crc ^= (unsigned char)data[i];
+        for (k = 0; k < 8; k++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1)));
+        }
+    }
+
+    return crc ^ 0xFFFFFFFFUL;
+}
+
+static void write_uint16(FILE *f, unsigned long value)
+{
+    fputc((int)(value & 0xFF), f);
+    fputc((int)((value >> 8) & 0xFF), f);
+}
+
+static void write_uint32(FILE *f, unsigned long value)
+{
+    write_uint16(f, value & 0xFFFF);
+    write_uint16(f, (value >> 16) & 0xFFFF);
+}
+
+/* write the shared part of a local file header and central directory entry (from 'version needed' onwards) */
+static void write_entry_header(FILE *f, const zip_entry *entry)
+{
+    long length = (long)strlen(entry->data);
+
+    write_uint16(f, 20);        /* version needed to extract */
+    write_uint16(f, 0); /* flags */
+    write_uint16(f, 0); /* compression method (stored) */
+    write_uint16(f, 0); /* modification time */
+    write_uint16(f, 0x21);      /* modification date (1980-01-01) */
+    write_uint32(f, crc32_of_data(entry->data, length));
+    write_uint32(f, length);    /* compressed size */
+    write_uint32(f, length);    /* uncompressed size */
+    write_uint16(f, strlen(entry->name));
+    write_uint16(f, 0); /* extra field length */
+}
+
+/* write a zip file with uncompressed entries */
+int write_zip_file(const char *filename, int num_entries, const zip_entry *entry)
+{
+    unsigned long offset[8];
+    unsigned long directory_offset;
+    FILE *f;
+    int i;
+
+    if (num_entries > 8)
+    {
+        fprintf(stderr, "ERROR: too many zip entries for %s\n", filename);
+        return -1;
+    }
+
+    f = fopen(filename, "wb");
+    if (f == NULL)
+    {
+        fprintf(stderr, "ERROR: could not create %s\n", filename);
+        return -1;
+    }
+    for (i = 0; i < num_entries; i++)
+    {
+        offset[i] = (unsigned long)ftell(f);
+        write_uint32(f, 0x04034b50);
+        write_entry_header(f, &entry[i]);
+        fputs(entry[i].name, f);
+        fputs(entry[i].data, f);
+    }
+    directory_offset = (unsigned long)ftell(f);
+    for (i = 0; i < num_entries; i++)
+    {
+        write_uint32(f, 0x02014b50);
+        write_uint16(f, 20);    /* version made by */
+        write_entry_header(f, &entry[i]);
+        write_uint16(f, 0);     /* file comment length */
+        write_uint16(f, 0);     /* disk number start */
+        write_uint16(f, 0);     /* internal file attributes */
+        write_uint32(f, 0);     /* external file attributes */
+        write_uint32(f, offset[i]);
+        fputs(entry[i].name, f);
+    }
+    write_uint32(f, 0x06054b50);
+    write_uint16(f, 0); /* number of this disk */
+    write_uint16(f, 0); /* disk with the start of the central directory */
+    write_uint16(f, num_entries);
+    write_uint16(f, num_entries);
+    write_uint32(f, (unsigned long)ftell(f) - 12 - directory_offset);
+    write_uint32(f, directory_offset);
+    write_uint16(f, 0); /* comment length */
+    if (fclose(f) != 0)
+    {
+        fprintf(stderr, "ERROR: could not write %s\n", filename);
+        return -1;
+    }
+
+    return 0;
+}
+
+int write_data_file(const char *filename, const void *data, long length)
+{
+    FILE *f;
+
+    f = fopen(filename, "wb");
+    if (f == NULL)
+    {
+        fprintf(stderr, "ERROR: could not create %s\n", filename);
+        return -1;
+    }
+    if ((long)fwrite(data, 1, length, f) != length)
+    {
+        fprintf(stderr, "ERROR: could not write %s\n", filename);
+        fclose(f);
+        return -1;
+    }
+    if (fclose(f) != 0)
+    {
+        fprintf(stderr, "ERROR: could not write %s\n", filename);
+        return -1;
+    }
+
+    return 0;
+}
+
+int read_data_file(const char *filename, char **data, long *length)
+{
+    FILE *f;
+    long size = 0;
+    long n;
+
+    f = fopen(filename, "rb");
+    if (f == NULL)
+    {
+        fprintf(stderr, "ERROR: could not open %s\n", filename);
+        return -1;
+    }
+    *data = NULL;
+    *length = 0;
+    do
+    {
+        if (*length == size)
+        {
+            char *new_data;
+
+            size = 2 * size + 4096;
+            new_data = realloc(*data, size);
+            if (new_data == NULL)
+            {
+                fprintf(stderr, "ERROR: out of memory\n");
+                free(*data);
+                fclose(f);
+                return -1;
+            }
+            *data = new_data;
+        }
+        n = (long)fread(&(*data)[*length], 1, size - *length, f);
+        *length += n;
+    } while (n > 0);
+    if (ferror(f))
+    {
+        fprintf(stderr, "ERROR: could not read %s\n", filename);
+        free(*data);
+        fclose(f);
+        return -1;
+    }
+    fclose(f);
+
+    return 0;
+}
@@ -34,12 +34,16 @@
 #endif
 
 #include <assert.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
 #include "coda.h"
+#ifndef WIN32
+#include "workerpool.h"
+#endif
 
 /* internal CODA functions */
 int coda_cursor_print_path(const coda_cursor *cursor, int (*print) (const char *, ...));
@@ -50,6 +54,14 @@ int option_verbose;
 int option_quick;
 int option_require_definition;
 int found_errors;
+long num_files;
+long num_files_with_errors;
+
+/* if output_to_buffer is set, all output is collected in output_buffer instead of being written to stdout */
+int output_to_buffer;
+char *output_buffer;
+long output_length;
+long output_size;
 
 static void print_version()
 {
@@ -73,6 +85,10 @@ static void print_help()
     printf("                    (do not traverse the full product)\n");
     printf("            -V, --verbose\n");
     printf("                    show more information while performing the check\n");
+    printf("            -j, --jobs <n>\n");
+    printf("                    check up to <n> files in parallel using separate worker\n");
+    printf("                    processes (results are still reported in the order of\n");
+    printf("                    the files)\n");
     printf("            --no-mmap\n");
     printf("                    disable the use of mmap when opening files\n");
     printf("\n");
@@ -95,17 +111,64 @@ static void print_help()
     printf("\n");
 }
 
+static int output(const char *format, ...)
+{
+    va_list ap;
+    int length;
+
+    if (!output_to_buffer)
+    {
+        va_start(ap, format);
+        length = vprintf(format, ap);
+        va_end(ap);
+        return length;
+    }
+
+    va_start(ap, format);
+    length = vsnprintf(NULL, 0, format, ap);
+    va_end(ap);
+    if (length < 0)
+    {
+        return length;
+    }
+    if (output_length + length + 1 > output_size)
+    {
+        char *new_buffer;
+        long new_size;
+
+        new_size = 2 * output_size;
+        if (new_size < output_length + length + 1)
+        {
+            new_size = output_length + length + 1 + 1024;
+        }
+        new_buffer = realloc(output_buffer, new_size);
+        if (new_buffer == NULL)
+        {
+            fprintf(stderr, "ERROR: out of memory\n");
+            exit(1);
+        }
+        output_buffer = new_buffer;
+        output_size = new_size;
+    }
+    va_start(ap, format);
+    vsnprintf(&output_buffer[output_length], length + 1, format, ap);
+    va_end(ap);
+    output_length += length;
+
+    return length;
+}
+
 static void print_error(coda_cursor *cursor, const char *error, void *userdata)
 {
     (void)userdata;     /* prevent unused warning */
 
-    printf("  ERROR: %s", error);
+    output("  ERROR: %s", error);
     if (cursor != NULL)
     {
-        printf(" at ");
-        coda_cursor_print_path(cursor, printf);
+        output(" at ");
+        coda_cursor_print_path(cursor, output);
     }
-    printf("\n");
+    output("\n");
     found_errors = 1;
 }
 
@@ -119,11 +182,12 @@ static void check_file(char *filename)
     int version;
     int result;
 
-    printf("%s\n", filename);
+    found_errors = 0;
+    output("%s\n", filename);
 
     if (coda_recognize_file(filename, &file_size, &format, &product_class, &product_type, &version) != 0)
     {
-        printf("  ERROR: %s\n\n", coda_errno_to_string(coda_errno));
+        output("  ERROR: %s\n\n", coda_errno_to_string(coda_errno));
         coda_set_error(CODA_SUCCESS, NULL);
         found_errors = 1;
         return;
@@ -131,19 +195,19 @@ static void check_file(char *filename)
 
     if (option_require_definition && (product_class == NULL || product_class == NULL))
     {
-        printf("  ERROR: could not determine product type\n\n");
+        output("  ERROR: could not determine product type\n\n");
         found_errors = 1;
         return;
     }
 
     if (option_verbose)
     {
-        printf("  product format: %s", coda_type_get_format_name(format));
+        output("  product format: %s", coda_type_get_format_name(format));
         if (product_class != NULL && product_type != NULL)
         {
-            printf(" %s/%s v%d", product_class, product_type, version);
+            output(" %s/%s v%d", product_class, product_type, version);
         }
-        printf("\n");
+        output("\n");
     }
 
     result = coda_open(filename, &product);
@@ -158,14 +222,26 @@ static void check_file(char *filename)
     }
     if (result != 0)
     {
-        printf("  ERROR: %s\n\n", coda_errno_to_string(coda_errno));
+        output("  ERROR: %s\n\n", coda_errno_to_string(coda_errno));
         found_errors = 1;
         return;
     }
 
+    if (!option_quick)
+    {
+        /* a full check reads all data of the product from start to end */
+        if (coda_set_product_access_pattern(product, coda_access_pattern_sequential) != 0)
+        {
+            output("  ERROR: %s\n\n", coda_errno_to_string(coda_errno));
+            found_errors = 1;
+            coda_close(product);
+            return;
+        }
+    }
+
     if (coda_product_check(product, !option_quick, print_error, NULL) != 0)
     {
-        printf("  ERROR: %s\n\n", coda_errno_to_string(coda_errno));
+        output("  ERROR: %s\n\n", coda_errno_to_string(coda_errno));
         found_errors = 1;
         coda_close(product);
         return;
@@ -173,18 +249,152 @@ static void check_file(char *filename)
 
     if (coda_close(product) != 0)
     {
-        printf("  ERROR: %s\n", coda_errno_to_string(coda_errno));
+        output("  ERROR: %s\n", coda_errno_to_string(coda_errno));
         found_errors = 1;
         return;
     }
 
-    printf("\n");
+    output("\n");
+}
+
+/* read the next (non-empty) filename from stdin; returns 0 on success and -1 if there are no more filenames */
+static int read_filename(char *filename)
+{
+    char c;
+
+    do
+    {
+        int k;
+
+        k = 0;
+        for (;;)
+        {
+            c = getchar();
+            if (c == '\r')
+            {
+                char c2;
+
+                c2 = getchar();
+                /* test for '\r\n' combination */
+                if (c2 != '\n')
+                {
+                    /* if the second char is not '\n' put it back in the read buffer */
+                    ungetc(c2, stdin);
+                }
+            }
+            if (c == EOF || c == '\n' || c == '\r')
+            {
+                filename[k] = '\0';
+                break;
+            }
+            filename[k] = c;
+            k++;
+            assert(k < 1000);
+        }
+        if (k > 0)
+        {
+            return 0;
+        }
+    } while (c != EOF);
+
+    return -1;
 }
 
+static void add_to_summary(int file_has_errors)
+{
+    num_files++;
+    if (file_has_errors)
+    {
+        num_files_with_errors++;
+    }
+}
+
+#ifndef WIN32
+
+/* Parallel checking of files.
+ * Since the CODA library itself is not thread-safe, files are checked by the worker processes of a worker_pool (see
+ * tools/common/workerpool.h). Each request is a filename and the reply of the worker contains the found_errors flag
+ * followed by the output of the check. The pool passes the replies to check_files_result() in the order of the files,
+ * such that the output is identical to that of a serial run.
+ */
+
+static int check_files_request(const char *filename, char **reply, long *reply_length, void *userdata)
+{
+    (void)userdata;
+
+    output_to_buffer = 1;
+    output_length = 0;
+    check_file((char *)filename);
+
+    *reply_length = (long)sizeof(found_errors) + output_length;
+    *reply = malloc(*reply_length);
+    if (*reply == NULL)
+    {
+        return -1;
+    }
+    memcpy(*reply, &found_errors, sizeof(found_errors));
+    if (output_length > 0)
+    {
+        memcpy(&(*reply)[sizeof(found_errors)], output_buffer, output_length);
+    }
+
+    return 0;
+}
+
+static int check_files_result(const char *filename, const char *reply, long reply_length, void *userdata)
+{
+    int file_has_errors;
+
+    (void)userdata;
+
+    if (reply == NULL || reply_length < (long)sizeof(file_has_errors))
+    {
+        printf("%s\n  ERROR: worker process terminated unexpectedly\n\n", filename);
+        fflush(stdout);
+        add_to_summary(1);
+        return 0;
+    }
+    memcpy(&file_has_errors, reply, sizeof(file_has_errors));
+    fwrite(&reply[sizeof(file_has_errors)], 1, reply_length - sizeof(file_has_errors), stdout);
+    fflush(stdout);
+    add_to_summary(file_has_errors);
+
+    return 0;
+}
+
+static void check_files_parallel(int num_jobs, int option_stdin, int argc, char *argv[], int i)
+{
+    worker_pool *pool;
+
+    pool = worker_pool_new(num_jobs, check_files_request, check_files_result, NULL);
+    if (option_stdin)
+    {
+        char filename[1000];
+
+        while (read_filename(filename) == 0)
+        {
+            worker_pool_submit(pool, filename);
+        }
+    }
+    else
+    {
+        while (i < argc)
+        {
+            worker_pool_submit(pool, argv[i]);
+            i++;
+        }
+    }
+    worker_pool_finish(pool);
+    worker_pool_delete(pool);
+}
+
+#endif
+
 int main(int argc, char *argv[])
 {
     int option_stdin;
     int option_use_mmap;
+    int num_jobs;
     int i;
 
     option_stdin = 0;
@@ -192,6 +402,7 @@ int main(int argc, char *argv[])
     option_quick = 0;
     option_use_mmap = 1;
     option_require_definition = 0;
+    num_jobs = 1;
 
     if (argc == 1 || strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0)
     {
@@ -239,6 +450,18 @@ int main(int argc, char *argv[])
         {
             option_require_definition = 1;
         }
+        else if ((strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "--jobs") == 0) && i + 1 < argc &&
+                 argv[i + 1][0] != '-')
+        {
+            num_jobs = atoi(argv[i + 1]);
+            if (num_jobs < 1)
+            {
+                fprintf(stderr, "ERROR: invalid number of jobs\n");
+                print_help();
+                exit(1);
+            }
+            i++;
+        }
         else if (strcmp(argv[i], "--no-mmap") == 0)
         {
             option_use_mmap = 0;
@@ -281,52 +504,32 @@ int main(int argc, char *argv[])
     /* Set mmap based on the chosen option */
     coda_set_option_use_mmap(option_use_mmap);
 
-    if (option_stdin)
+    if (num_jobs > 1)
+    {
+#ifdef WIN32
+        fprintf(stderr, "ERROR: parallel checking of files is not supported on this platform\n");
+        exit(1);
+#else
+        check_files_parallel(num_jobs, option_stdin, argc, argv, i);
+#endif
+    }
+    else if (option_stdin)
     {
         char filename[1000];
-        char c;
 
-        do
+        while (read_filename(filename) == 0)
         {
-            int k;
-
-            k = 0;
-            for (;;)
-            {
-                c = getchar();
-                if (c == '\r')
-                {
-                    char c2;
-
-                    c2 = getchar();
-                    /* test for '\r\n' combination */
-                    if (c2 != '\n')
-                    {
-                        /* if the second char is not '\n' put it back in the read buffer */
-                        ungetc(c2, stdin);
-                    }
-                }
-                if (c == EOF || c == '\n' || c == '\r')
-                {
-                    filename[k] = '\0';
-                    break;
-                }
-                filename[k] = c;
-                k++;
-                assert(k < 1000);
-            }
-            if (k > 0)
-            {
-                check_file(filename);
-                fflush(NULL);
-            }
-        } while (c != EOF);
+            check_file(filename);
+            add_to_summary(found_errors);
+            fflush(NULL);
+        }
     }
     else
     {
         while (i < argc)
         {
             check_file(argv[i]);
+            add_to_summary(found_errors);
             fflush(NULL);
             i++;
         }
@@ -334,7 +537,12 @@ int main(int argc, char *argv[])
 
     coda_done();
 
-    if (found_errors)
+    if (option_verbose && num_jobs > 1)
+    {
+        printf("%ld files checked, %ld files with errors\n", num_files, num_files_with_errors);
+    }
+
+    if (num_files_with_errors > 0)
     {
         exit(1);
     }
@@ -31,11 +31,183 @@
 
 #include "codadump.h"
 
+#include <errno.h>
+#include <stdarg.h>
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+/* The output of a data element is collected in a buffer. In serial mode the buffer is written to ascii_output each
+ * time it exceeds ASCII_FLUSH_SIZE bytes.
+ *
+ * If multiple threads are used (ascii_num_threads > 1), the outermost array of a data element is split into chunks of
+ * consecutive array elements. Each chunk is formatted by one of the worker threads into its own buffer and the main
+ * thread writes the buffers to ascii_output in order, which results in the same output as in serial mode.
+ * Each worker thread uses its own product handle (a CODA product should not be used by more than one thread at the
+ * same time) and worker i formats chunks i, i + n, i + 2n, ... (with n the number of workers), such that it only needs
+ * to move its cursor forward. At most ASCII_CHUNKS_PER_WORKER chunks per worker are kept in memory.
+ */
+#define ASCII_FLUSH_SIZE (64 * 1024)
+#define ASCII_CHUNK_NUM_VALUES 16384
+#define ASCII_CHUNKS_PER_WORKER 4
+
+typedef struct ascii_buffer
+{
+    char *data;
+    long length;
+    long size;
+} ascii_buffer_t;
+
+typedef struct ascii_writer
+{
+    coda_cursor cursor;
+    array_info_t array_info[CODA_CURSOR_MAXDEPTH];      /* local copy, since global_index and index get updated */
+    ascii_buffer_t *output;
+    int flush;  /* write output to ascii_output when the buffer is full (only for the main thread) */
+} ascii_writer_t;
+
+#ifdef HAVE_PTHREAD
+typedef struct ascii_chunk
+{
+    ascii_buffer_t buffer;
+    int status; /* 0: not formatted yet, 1: formatted, -1: formatting failed */
+    int error_number;
+    char *error_message;
+} ascii_chunk_t;
+
+typedef struct ascii_parallel_info
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    int depth;
+    int record_depth;
+    int local_dim[MAX_NUM_DIMS];
+    int random_access;  /* can array elements be accessed by index without walking all preceding elements? */
+    long num_elements;
+    long chunk_size;
+    long num_chunks;
+    int num_workers;
+    int num_slots;
+    ascii_chunk_t *slot;        /* chunk k is stored in slot k % num_slots */
+    long next_write;    /* index of the next chunk to be written to ascii_output */
+    int abort;
+} ascii_parallel_info_t;
+
+typedef struct ascii_worker
+{
+    pthread_t thread;
+    int id;
+    ascii_parallel_info_t *info;
+    ascii_writer_t writer;
+} ascii_worker_t;
+
+static coda_product **worker_product = NULL;
+static int num_worker_products = 0;
+#endif
+
 static int first_write_of_data = 1;
 
-static void write_data(FILE *f, int depth, int array_depth, int record_depth);
+static int write_data(ascii_writer_t *writer, int depth, int array_depth, int record_depth);
+
+static void write_output(const char *data, long length)
+{
+    if (length > 0 && fwrite(data, 1, length, ascii_output) != (size_t)length)
+    {
+        fprintf(stderr, "ERROR: could not write output (%s)\n", strerror(errno));
+        exit(1);
+    }
+}
+
+static void flush_writer(ascii_writer_t *writer)
+{
+    write_output(writer->output->data, writer->output->length);
+    writer->output->length = 0;
+}
+
+static int reserve(ascii_writer_t *writer, long length)
+{
+    ascii_buffer_t *buffer = writer->output;
+
+    if (buffer->length + length > buffer->size)
+    {
+        long new_size;
+        char *new_data;
+
+        new_size = (buffer->size == 0 ? ASCII_FLUSH_SIZE : buffer->size);
+        while (buffer->length + length > new_size)
+        {
+            new_size *= 2;
+        }
+        new_data = realloc(buffer->data, new_size);
+        if (new_data == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)new_size, __FILE__, __LINE__);
+            return -1;
+        }
+        buffer->data = new_data;
+        buffer->size = new_size;
+    }
+    return 0;
+}
+
+static int write_string(ascii_writer_t *writer, const char *str)
+{
+    long length = (long)strlen(str);
+
+    if (reserve(writer, length) != 0)
+    {
+        return -1;
+    }
+    memcpy(&writer->output->data[writer->output->length], str, length);
+    writer->output->length += length;
+    return 0;
+}
+
+static int write_char(ascii_writer_t *writer, char c)
+{
+    if (reserve(writer, 1) != 0)
+    {
+        return -1;
+    }
+    writer->output->data[writer->output->length++] = c;
+    return 0;
+}
 
-static void write_index(FILE *f)
+static int write_printf(ascii_writer_t *writer, const char *templ, ...)
+{
+    ascii_buffer_t *buffer = writer->output;
+    va_list ap;
+    int length;
+
+    if (buffer->data == NULL && reserve(writer, 1) != 0)
+    {
+        return -1;
+    }
+    va_start(ap, templ);
+    length = vsnprintf(&buffer->data[buffer->length], buffer->size - buffer->length, templ, ap);
+    va_end(ap);
+    if (length < 0)
+    {
+        return 0;
+    }
+    if (length >= buffer->size - buffer->length)
+    {
+        /* the result did not fit in the remaining space of the buffer */
+        if (reserve(writer, length + 1) != 0)
+        {
+            return -1;
+        }
+        va_start(ap, templ);
+        vsnprintf(&buffer->data[buffer->length], buffer->size - buffer->length, templ, ap);
+        va_end(ap);
+    }
+    buffer->length += length;
+    return 0;
+}
+
+static int write_index(ascii_writer_t *writer)
 {
     int array_id;
     int i;
@@ -47,33 +219,40 @@ static void write_index(FILE *f)
 
         if (coda_type_get_class(traverse_info.type[i], &type_class) != 0)
         {
-            handle_coda_error();
+            return -1;
         }
         if (type_class == coda_array_class)
         {
             int j;
 
-            for (j = 0; j < traverse_info.array_info[array_id].num_dims; j++)
+            for (j = 0; j < writer->array_info[array_id].num_dims; j++)
             {
-                fprintf(f, "%ld%s", (long)traverse_info.array_info[array_id].index[j], ascii_col_sep);
+                if (write_printf(writer, "%ld%s", (long)writer->array_info[array_id].index[j], ascii_col_sep) != 0)
+                {
+                    return -1;
+                }
             }
             array_id++;
         }
     }
+    return 0;
 }
 
-static void write_basic_data(FILE *f, int depth)
+static int write_basic_data(ascii_writer_t *writer, int depth)
 {
     coda_type_class type_class;
 
     if (show_index)
     {
-        write_index(f);
+        if (write_index(writer) != 0)
+        {
+            return -1;
+        }
     }
 
     if (coda_type_get_class(traverse_info.type[depth], &type_class) != 0)
     {
-        handle_coda_error();
+        return -1;
     }
     switch (type_class)
     {
@@ -86,7 +265,7 @@ static void write_basic_data(FILE *f, int depth)
 
                 if (coda_type_get_read_type(traverse_info.type[depth], &read_type) != 0)
                 {
-                    handle_coda_error();
+                    return -1;
                 }
                 switch (read_type)
                 {
@@ -94,18 +273,24 @@ static void write_basic_data(FILE *f, int depth)
                         {
                             char data;
 
-                            if (coda_cursor_read_char(&traverse_info.cursor, &data) != 0)
+                            if (coda_cursor_read_char(&writer->cursor, &data) != 0)
                             {
-                                handle_coda_error();
+                                return -1;
                             }
 
                             if (show_quotes)
                             {
-                                fprintf(f, "'%c'", data);
+                                if (write_printf(writer, "'%c'", data) != 0)
+                                {
+                                    return -1;
+                                }
                             }
                             else
                             {
-                                fprintf(f, "%c", data);
+                                if (write_printf(writer, "%c", data) != 0)
+                                {
+                                    return -1;
+                                }
                             }
                         }
                         break;
@@ -113,10 +298,11 @@ static void write_basic_data(FILE *f, int depth)
                         {
                             long length;
                             char *data;
+                            int result;
 
-                            if (coda_cursor_get_string_length(&traverse_info.cursor, &length) != 0)
+                            if (coda_cursor_get_string_length(&writer->cursor, &length) != 0)
                             {
-                                handle_coda_error();
+                                return -1;
                             }
                             data = (char *)malloc(length + 1);
                             if (data == NULL)
@@ -124,23 +310,28 @@ static void write_basic_data(FILE *f, int depth)
                                 coda_set_error(CODA_ERROR_OUT_OF_MEMORY,
                                                "out of memory (could not allocate %lu bytes) (%s:%u)",
                                                (long)length + 1, __FILE__, __LINE__);
-                                handle_coda_error();
+                                return -1;
                             }
-                            if (coda_cursor_read_string(&traverse_info.cursor, data, length + 1) != 0)
+                            if (coda_cursor_read_string(&writer->cursor, data, length + 1) != 0)
                             {
-                                handle_coda_error();
+                                free(data);
+                                return -1;
                             }
 
                             if (show_quotes)
                             {
-                                fprintf(f, "\"%s\"", data);
+                                result = write_printf(writer, "\"%s\"", data);
                             }
                             else
                             {
-                                fprintf(f, "%s", data);
+                                result = write_string(writer, data);
                             }
 
                             free(data);
+                            if (result != 0)
+                            {
+                                return -1;
+                            }
                         }
                         break;
                     case coda_native_type_bytes:
@@ -148,11 +339,12 @@ static void write_basic_data(FILE *f, int depth)
                             int64_t bit_size;
                             int64_t byte_size;
                             uint8_t *data;
+                            int result = 0;
                             int i;
 
-                            if (coda_cursor_get_bit_size(&traverse_info.cursor, &bit_size) != 0)
+                            if (coda_cursor_get_bit_size(&writer->cursor, &bit_size) != 0)
                             {
-                                handle_coda_error();
+                                return -1;
                             }
                             byte_size = (bit_size >> 3) + (bit_size & 0x7 ? 1 : 0);
                             data = (uint8_t *)malloc((size_t)byte_size);
@@ -161,14 +353,15 @@ static void write_basic_data(FILE *f, int depth)
                                 coda_set_error(CODA_ERROR_OUT_OF_MEMORY,
                                                "out of memory (could not allocate %lu bytes) (%s:%u)",
                                                (long)byte_size, __FILE__, __LINE__);
-                                handle_coda_error();
+                                return -1;
                             }
-                            if (coda_cursor_read_bits(&traverse_info.cursor, data, 0, bit_size) != 0)
+                            if (coda_cursor_read_bits(&writer->cursor, data, 0, bit_size) != 0)
                             {
-                                handle_coda_error();
+                                free(data);
+                                return -1;
                             }
 
-                            for (i = 0; i < byte_size; i++)
+                            for (i = 0; result == 0 && i < byte_size; i++)
                             {
                                 char c;
 
@@ -176,42 +369,46 @@ static void write_basic_data(FILE *f, int depth)
                                 switch (c)
                                 {
                                     case '\a':
-                                        fprintf(f, "\\a");
+                                        result = write_string(writer, "\\a");
                                         break;
                                     case '\b':
-                                        fprintf(f, "\\b");
+                                        result = write_string(writer, "\\b");
                                         break;
                                     case '\t':
-                                        fprintf(f, "\\t");
+                                        result = write_string(writer, "\\t");
                                         break;
                                     case '\n':
-                                        fprintf(f, "\\n");
+                                        result = write_string(writer, "\\n");
                                         break;
                                     case '\v':
-                                        fprintf(f, "\\v");
+                                        result = write_string(writer, "\\v");
                                         break;
                                     case '\f':
-                                        fprintf(f, "\\f");
+                                        result = write_string(writer, "\\f");
                                         break;
                                     case '\r':
-                                        fprintf(f, "\\r");
+                                        result = write_string(writer, "\\r");
                                         break;
                                     case '\\':
-                                        fprintf(f, "\\\\");
+                                        result = write_string(writer, "\\\\");
                                         break;
                                     default:
                                         if (c >= 32 && c <= 126)
                                         {
-                                            fprintf(f, "%c", c);
+                                            result = write_char(writer, c);
                                         }
                                         else
                                         {
-                                            fprintf(f, "\\%03o", (int)(unsigned char)c);
+                                            result = write_printf(writer, "\\%03o", (int)(unsigned char)c);
                                         }
                                 }
                             }
 
                             free(data);
+                            if (result != 0)
+                            {
+                                return -1;
+                            }
                         }
                         break;
                     case coda_native_type_int8:
@@ -220,12 +417,15 @@ static void write_basic_data(FILE *f, int depth)
                         {
                             int32_t data;
 
-                            if (coda_cursor_read_int32(&traverse_info.cursor, &data) != 0)
+                            if (coda_cursor_read_int32(&writer->cursor, &data) != 0)
                             {
-                                handle_coda_error();
+                                return -1;
                             }
 
-                            fprintf(f, "%ld", (long)data);
+                            if (write_printf(writer, "%ld", (long)data) != 0)
+                            {
+                                return -1;
+                            }
                         }
                         break;
                     case coda_native_type_uint8:
@@ -234,12 +434,15 @@ static void write_basic_data(FILE *f, int depth)
                         {
                             uint32_t data;
 
-                            if (coda_cursor_read_uint32(&traverse_info.cursor, &data) != 0)
+                            if (coda_cursor_read_uint32(&writer->cursor, &data) != 0)
                             {
-                                handle_coda_error();
+                                return -1;
                             }
 
-                            fprintf(f, "%lu", (unsigned long)data);
+                            if (write_printf(writer, "%lu", (unsigned long)data) != 0)
+                            {
+                                return -1;
+                            }
                         }
                         break;
                     case coda_native_type_int64:
@@ -247,13 +450,16 @@ static void write_basic_data(FILE *f, int depth)
                             int64_t data;
                             char s[21];
 
-                            if (coda_cursor_read_int64(&traverse_info.cursor, &data) != 0)
+                            if (coda_cursor_read_int64(&writer->cursor, &data) != 0)
                             {
-                                handle_coda_error();
+                                return -1;
                             }
 
                             coda_str64(data, s);
-                            fprintf(f, "%s", s);
+                            if (write_string(writer, s) != 0)
+                            {
+                                return -1;
+                            }
                         }
                         break;
                     case coda_native_type_uint64:
@@ -261,13 +467,16 @@ static void write_basic_data(FILE *f, int depth)
                             uint64_t data;
                             char s[21];
 
-                            if (coda_cursor_read_uint64(&traverse_info.cursor, &data) != 0)
+                            if (coda_cursor_read_uint64(&writer->cursor, &data) != 0)
                             {
-                                handle_coda_error();
+                                return -1;
                             }
 
                             coda_str64u(data, s);
-                            fprintf(f, "%s", s);
+                            if (write_string(writer, s) != 0)
+                            {
+                                return -1;
+                            }
                         }
                         break;
                     case coda_native_type_float:
@@ -275,18 +484,14 @@ static void write_basic_data(FILE *f, int depth)
                         {
                             double data;
 
-                            if (coda_cursor_read_double(&traverse_info.cursor, &data) != 0)
+                            if (coda_cursor_read_double(&writer->cursor, &data) != 0)
                             {
-                                handle_coda_error();
+                                return -1;
                             }
 
-                            if (read_type == coda_native_type_float)
+                            if (write_printf(writer, read_type == coda_native_type_float ? "%.7g" : "%.16g", data) != 0)
                             {
-                                fprintf(f, "%.7g", data);
-                            }
-                            else
-                            {
-                                fprintf(f, "%.16g", data);
+                                return -1;
                             }
                         }
                         break;
@@ -302,7 +507,7 @@ static void write_basic_data(FILE *f, int depth)
 
                 if (coda_type_get_special_type(traverse_info.type[depth], &special_type) != 0)
                 {
-                    handle_coda_error();
+                    return -1;
                 }
                 switch (special_type)
                 {
@@ -314,9 +519,9 @@ static void write_basic_data(FILE *f, int depth)
                         {
                             double data;
 
-                            if (coda_cursor_read_double(&traverse_info.cursor, &data) != 0)
+                            if (coda_cursor_read_double(&writer->cursor, &data) != 0)
                             {
-                                handle_coda_error();
+                                return -1;
                             }
                             if ((special_type == coda_special_time) && show_time_as_string)
                             {
@@ -330,21 +535,20 @@ static void write_basic_data(FILE *f, int depth)
                                 {
                                     if (coda_time_double_to_string(data, "yyyy-MM-dd HH:mm:ss.SSSSSS", str) != 0)
                                     {
-                                        handle_coda_error();
+                                        return -1;
                                     }
                                 }
-                                if (show_quotes)
+                                if (write_printf(writer, show_quotes ? "\"%s\"" : "%s", str) != 0)
                                 {
-                                    fprintf(f, "\"%s\"", str);
-                                }
-                                else
-                                {
-                                    fprintf(f, "%s", str);
+                                    return -1;
                                 }
                             }
                             else
                             {
-                                fprintf(f, "%.16g", data);
+                                if (write_printf(writer, "%.16g", data) != 0)
+                                {
+                                    return -1;
+                                }
                             }
                         }
                         break;
@@ -352,12 +556,15 @@ static void write_basic_data(FILE *f, int depth)
                         {
                             double data[2];
 
-                            if (coda_cursor_read_complex_double_pair(&traverse_info.cursor, data) != 0)
+                            if (coda_cursor_read_complex_double_pair(&writer->cursor, data) != 0)
                             {
-                                handle_coda_error();
+                                return -1;
                             }
 
-                            fprintf(f, "%g%s%g", data[0], ascii_col_sep, data[1]);
+                            if (write_printf(writer, "%g%s%g", data[0], ascii_col_sep, data[1]) != 0)
+                            {
+                                return -1;
+                            }
                         }
                         break;
                 }
@@ -368,29 +575,418 @@ static void write_basic_data(FILE *f, int depth)
             assert(0);
             exit(1);
     }
-    fprintf(f, "\n");
+    if (write_char(writer, '\n') != 0)
+    {
+        return -1;
+    }
+    if (writer->flush && writer->output->length >= ASCII_FLUSH_SIZE)
+    {
+        flush_writer(writer);
+    }
+    return 0;
+}
+
+/* write the array elements [first, last) of the array at array_depth
+ * (the cursor should point to element 'first' and array_info->index should contain the indices for element 'first')
+ */
+static int write_array_elements(ascii_writer_t *writer, int depth, int array_depth, int record_depth, long first,
+                                long last, const int *local_dim)
+{
+    array_info_t *array_info;
+    int has_var_dim_sub_array;
+    long i;
+
+    array_info = &writer->array_info[array_depth];
+    has_var_dim_sub_array = (dim_info.last_var_size_dim >= array_info->dim_id + array_info->num_dims);
+
+    for (i = first; i < last; i++)
+    {
+        /* write data for current array element */
+        if (write_data(writer, depth + 1, array_depth + 1, record_depth) != 0)
+        {
+            return -1;
+        }
+
+        if (i < last - 1)
+        {
+            /* jump to next array element */
+            if (coda_cursor_goto_next_array_element(&writer->cursor) != 0)
+            {
+                return -1;
+            }
+            if (has_var_dim_sub_array && array_depth < traverse_info.num_arrays - 1)
+            {
+                writer->array_info[array_depth + 1].global_index++;
+            }
+            if (show_index)
+            {
+                int k = array_info->num_dims - 1;
+
+                while (k >= 0)
+                {
+                    array_info->index[k]++;
+                    if (array_info->index[k] == local_dim[k])
+                    {
+                        array_info->index[k--] = 0;
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    return 0;
 }
 
-static void write_data(FILE *f, int depth, int array_depth, int record_depth)
+#ifdef HAVE_PTHREAD
+static int open_worker_products()
+{
+    int i;
+
+    if (worker_product != NULL)
+    {
+        return 0;
+    }
+    worker_product = (coda_product **)malloc(ascii_num_threads * sizeof(coda_product *));
+    if (worker_product == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)ascii_num_threads * sizeof(coda_product *), __FILE__, __LINE__);
+        return -1;
+    }
+    /* each worker needs its own product handle with its own file access state; codadump never enables the product
+     * cache, so each coda_open() below opens the file anew instead of sharing a cached product */
+    assert(coda_get_option_product_cache_size() == 0);
+    /* coda_open() can not be called from multiple threads at the same time, so we open all products up front */
+    for (i = 0; i < ascii_num_threads; i++)
+    {
+        if (coda_open(traverse_info.file_name, &worker_product[i]) != 0)
+        {
+            return -1;
+        }
+        num_worker_products++;
+        if (coda_set_product_access_pattern(worker_product[i], coda_access_pattern_sequential) != 0)
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void *ascii_worker_main(void *arg)
+{
+    ascii_worker_t *worker = (ascii_worker_t *)arg;
+    ascii_parallel_info_t *info = worker->info;
+    ascii_writer_t *writer = &worker->writer;
+    int has_var_dim_sub_array;
+    int32_t base_global_index = 0;
+    long current = -1;  /* index of the array element the cursor points to (-1 if the cursor points to the array) */
+    long k;
+
+    has_var_dim_sub_array = (dim_info.last_var_size_dim >= writer->array_info[0].dim_id +
+                             writer->array_info[0].num_dims) && traverse_info.num_arrays > 1;
+    if (has_var_dim_sub_array)
+    {
+        base_global_index = writer->array_info[1].global_index;
+    }
+
+    for (k = worker->id; k < info->num_chunks; k += info->num_workers)
+    {
+        ascii_chunk_t *chunk = &info->slot[k % info->num_slots];
+        long first = k * info->chunk_size;
+        long last = first + info->chunk_size;
+        long index;
+        int result = 0;
+        int i;
+
+        if (last > info->num_elements)
+        {
+            last = info->num_elements;
+        }
+
+        pthread_mutex_lock(&info->mutex);
+        while (!info->abort && k >= info->next_write + info->num_slots)
+        {
+            pthread_cond_wait(&info->cond, &info->mutex);
+        }
+        if (info->abort)
+        {
+            pthread_mutex_unlock(&info->mutex);
+            break;
+        }
+        pthread_mutex_unlock(&info->mutex);
+
+        writer->output = &chunk->buffer;
+        writer->output->length = 0;
+
+        /* move the cursor to the first element of the chunk */
+        if (current == -1 || info->random_access)
+        {
+            if (current != -1)
+            {
+                coda_cursor_goto_parent(&writer->cursor);
+            }
+            result = coda_cursor_goto_array_element_by_index(&writer->cursor, first);
+        }
+        else
+        {
+            while (result == 0 && current < first)
+            {
+                result = coda_cursor_goto_next_array_element(&writer->cursor);
+                current++;
+            }
+        }
+        current = first;
+
+        if (result == 0)
+        {
+            index = first;
+            for (i = writer->array_info[0].num_dims - 1; i >= 0; i--)
+            {
+                writer->array_info[0].index[i] = index % info->local_dim[i];
+                index /= info->local_dim[i];
+            }
+            if (has_var_dim_sub_array)
+            {
+                writer->array_info[1].global_index = base_global_index + (int32_t)first;
+            }
+            result = write_array_elements(writer, info->depth, 0, info->record_depth, first, last, info->local_dim);
+            current = last - 1;
+        }
+
+        pthread_mutex_lock(&info->mutex);
+        if (result != 0)
+        {
+            chunk->status = -1;
+            /* the CODA error state is kept per thread, so pass the error of this worker on to the main thread */
+            chunk->error_number = coda_errno;
+            chunk->error_message = strdup(coda_errno_to_string(coda_errno));
+        }
+        else
+        {
+            chunk->status = 1;
+        }
+        pthread_cond_broadcast(&info->cond);
+        pthread_mutex_unlock(&info->mutex);
+        if (result != 0)
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/* write all elements of the outermost array using multiple threads
+ * returns 1 if the array is not suited for a parallel export (the caller should then write the array itself)
+ */
+static int write_array_parallel(ascii_writer_t *writer, int depth, int record_depth, long num_elements,
+                                const int *local_dim)
+{
+    ascii_parallel_info_t info;
+    ascii_worker_t *worker;
+    array_info_t *array_info;
+    coda_format format;
+    coda_type *base_type;
+    int64_t bit_size;
+    int64_t values_per_element = 1;
+    long failed_chunk = -1;
+    long k;
+    int i;
+
+    if (coda_get_product_format(traverse_info.pf, &format) != 0)
+    {
+        return -1;
+    }
+    if (format == coda_format_hdf4 || format == coda_format_hdf5)
+    {
+        /* the HDF4 and HDF5 libraries are not thread-safe */
+        return 1;
+    }
+
+    array_info = &writer->array_info[0];
+    if (array_info->dim_id + array_info->num_dims < dim_info.num_dims)
+    {
+        values_per_element = dim_info.array_size[array_info->dim_id + array_info->num_dims];
+    }
+    info.chunk_size = (long)(ASCII_CHUNK_NUM_VALUES / (values_per_element > 0 ? values_per_element : 1));
+    if (info.chunk_size < 1)
+    {
+        info.chunk_size = 1;
+    }
+    info.num_chunks = (num_elements + info.chunk_size - 1) / info.chunk_size;
+    if (info.num_chunks < 2)
+    {
+        return 1;
+    }
+
+    if (open_worker_products() != 0)
+    {
+        return -1;
+    }
+
+    if (coda_type_get_array_base_type(traverse_info.type[depth], &base_type) != 0 ||
+        coda_type_get_bit_size(base_type, &bit_size) != 0)
+    {
+        return -1;
+    }
+    info.random_access = ((format != coda_format_ascii && format != coda_format_binary) || bit_size >= 0);
+    info.depth = depth;
+    info.record_depth = record_depth;
+    for (i = 0; i < array_info->num_dims; i++)
+    {
+        info.local_dim[i] = local_dim[i];
+    }
+    info.num_elements = num_elements;
+    info.num_workers = (info.num_chunks < ascii_num_threads ? (int)info.num_chunks : ascii_num_threads);
+    info.num_slots = ASCII_CHUNKS_PER_WORKER * info.num_workers;
+    info.next_write = 0;
+    info.abort = 0;
+    info.slot = (ascii_chunk_t *)malloc(info.num_slots * sizeof(ascii_chunk_t));
+    worker = (ascii_worker_t *)malloc(info.num_workers * sizeof(ascii_worker_t));
+    if (info.slot == NULL || worker == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(info.num_slots * sizeof(ascii_chunk_t) + info.num_workers * sizeof(ascii_worker_t)),
+                       __FILE__, __LINE__);
+        free(info.slot);
+        free(worker);
+        return -1;
+    }
+    for (i = 0; i < info.num_slots; i++)
+    {
+        info.slot[i].buffer.data = NULL;
+        info.slot[i].buffer.length = 0;
+        info.slot[i].buffer.size = 0;
+        info.slot[i].status = 0;
+        info.slot[i].error_message = NULL;
+    }
+
+    /* position the cursor of each worker at the array (the path to the outermost array only consists of records) */
+    for (i = 0; i < info.num_workers; i++)
+    {
+        int j;
+
+        worker[i].id = i;
+        worker[i].info = &info;
+        memcpy(worker[i].writer.array_info, writer->array_info, traverse_info.num_arrays * sizeof(array_info_t));
+        worker[i].writer.output = NULL;
+        worker[i].writer.flush = 0;
+        if (coda_cursor_set_product(&worker[i].writer.cursor, worker_product[i]) != 0)
+        {
+            free(info.slot);
+            free(worker);
+            return -1;
+        }
+        for (j = 0; j < record_depth; j++)
+        {
+            if (coda_cursor_goto_record_field_by_index(&worker[i].writer.cursor, traverse_info.parent_index[j]) != 0)
+            {
+                free(info.slot);
+                free(worker);
+                return -1;
+            }
+        }
+    }
+
+    pthread_mutex_init(&info.mutex, NULL);
+    pthread_cond_init(&info.cond, NULL);
+    for (i = 0; i < info.num_workers; i++)
+    {
+        if (pthread_create(&worker[i].thread, NULL, ascii_worker_main, &worker[i]) != 0)
+        {
+            fprintf(stderr, "ERROR: could not create thread\n");
+            exit(1);
+        }
+    }
+
+    /* write the chunks in order */
+    flush_writer(writer);
+    for (k = 0; k < info.num_chunks; k++)
+    {
+        ascii_chunk_t *chunk = &info.slot[k % info.num_slots];
+
+        pthread_mutex_lock(&info.mutex);
+        while (chunk->status == 0)
+        {
+            pthread_cond_wait(&info.cond, &info.mutex);
+        }
+        pthread_mutex_unlock(&info.mutex);
+
+        /* for a failed chunk we still write the data up to the error (just as in serial mode) */
+        write_output(chunk->buffer.data, chunk->buffer.length);
+        if (chunk->status < 0)
+        {
+            failed_chunk = k;
+            break;
+        }
+
+        pthread_mutex_lock(&info.mutex);
+        chunk->status = 0;
+        info.next_write++;
+        pthread_cond_broadcast(&info.cond);
+        pthread_mutex_unlock(&info.mutex);
+    }
+    if (failed_chunk >= 0)
+    {
+        pthread_mutex_lock(&info.mutex);
+        info.abort = 1;
+        pthread_cond_broadcast(&info.cond);
+        pthread_mutex_unlock(&info.mutex);
+    }
+    for (i = 0; i < info.num_workers; i++)
+    {
+        pthread_join(worker[i].thread, NULL);
+    }
+    pthread_cond_destroy(&info.cond);
+    pthread_mutex_destroy(&info.mutex);
+
+    if (failed_chunk >= 0)
+    {
+        ascii_chunk_t *chunk = &info.slot[failed_chunk % info.num_slots];
+
+        coda_set_error(chunk->error_number, "%s", chunk->error_message != NULL ? chunk->error_message : "");
+    }
+    for (i = 0; i < info.num_slots; i++)
+    {
+        if (info.slot[i].buffer.data != NULL)
+        {
+            free(info.slot[i].buffer.data);
+        }
+        if (info.slot[i].error_message != NULL)
+        {
+            free(info.slot[i].error_message);
+        }
+    }
+    free(info.slot);
+    free(worker);
+
+    return (failed_chunk >= 0 ? -1 : 0);
+}
+#endif
+
+static int write_data(ascii_writer_t *writer, int depth, int array_depth, int record_depth)
 {
     coda_type_class type_class;
 
     if (coda_type_get_class(traverse_info.type[depth], &type_class) != 0)
     {
-        handle_coda_error();
+        return -1;
     }
     switch (type_class)
     {
         case coda_array_class:
             {
                 array_info_t *array_info;
-                int number_of_elements;
+                long number_of_elements;
                 int has_var_dim_sub_array;
                 int local_dim[MAX_NUM_DIMS];
                 int dim_id;
                 int i;
 
-                array_info = &traverse_info.array_info[array_depth];
+                array_info = &writer->array_info[array_depth];
                 dim_id = array_info->dim_id;
 
                 if (array_depth == 0)
@@ -402,7 +998,7 @@ static void write_data(FILE *f, int depth, int array_depth, int record_depth)
                 if (has_var_dim_sub_array && array_depth < traverse_info.num_arrays - 1)
                 {
                     /* Set the index for the var_dim list(s) for the next array */
-                    traverse_info.array_info[array_depth + 1].global_index =
+                    writer->array_info[array_depth + 1].global_index =
                         array_info->global_index * array_info->num_elements;
                 }
 
@@ -424,83 +1020,99 @@ static void write_data(FILE *f, int depth, int array_depth, int record_depth)
                 if (number_of_elements == 0)
                 {
                     /* array is empty */
-                    return;
+                    return 0;
                 }
 
-                /* traverse array */
-                if (coda_cursor_goto_first_array_element(&traverse_info.cursor) != 0)
-                {
-                    handle_coda_error();
-                }
-                for (i = 0; i < number_of_elements; i++)
+#ifdef HAVE_PTHREAD
+                if (array_depth == 0 && ascii_num_threads > 1)
                 {
-                    /* write data for current array element */
-                    write_data(f, depth + 1, array_depth + 1, record_depth);
+                    int result;
 
-                    if (i < number_of_elements - 1)
+                    result = write_array_parallel(writer, depth, record_depth, number_of_elements, local_dim);
+                    if (result <= 0)
                     {
-                        /* jump to next array element */
-                        if (coda_cursor_goto_next_array_element(&traverse_info.cursor) != 0)
-                        {
-                            handle_coda_error();
-                        }
-                        if (has_var_dim_sub_array && array_depth < traverse_info.num_arrays - 1)
-                        {
-                            traverse_info.array_info[array_depth + 1].global_index++;
-                        }
-                        if (show_index)
-                        {
-                            int k = array_info->num_dims - 1;
-
-                            while (k >= 0)
-                            {
-                                array_info->index[k]++;
-                                if (array_info->index[k] == local_dim[k])
-                                {
-                                    array_info->index[k--] = 0;
-                                }
-                                else
-                                {
-                                    break;
-                                }
-                            }
-                        }
+                        return result;
                     }
                 }
-                coda_cursor_goto_parent(&traverse_info.cursor);
+#endif
+
+                /* traverse array */
+                if (coda_cursor_goto_first_array_element(&writer->cursor) != 0)
+                {
+                    return -1;
+                }
+                if (write_array_elements(writer, depth, array_depth, record_depth, 0, number_of_elements,
+                                         local_dim) != 0)
+                {
+                    return -1;
+                }
+                coda_cursor_goto_parent(&writer->cursor);
             }
             break;
         case coda_record_class:
             {
                 int available;
 
-                if (coda_cursor_get_record_field_available_status(&traverse_info.cursor,
+                if (coda_cursor_get_record_field_available_status(&writer->cursor,
                                                                   traverse_info.parent_index[record_depth],
                                                                   &available) != 0)
                 {
-                    handle_coda_error();
+                    return -1;
                 }
                 /* if the field is not available just don't print it */
                 if (available)
                 {
-                    if (coda_cursor_goto_record_field_by_index(&traverse_info.cursor,
+                    if (coda_cursor_goto_record_field_by_index(&writer->cursor,
                                                                traverse_info.parent_index[record_depth]) != 0)
                     {
-                        handle_coda_error();
+                        return -1;
+                    }
+                    if (write_data(writer, depth + 1, array_depth, record_depth + 1) != 0)
+                    {
+                        return -1;
                     }
-                    write_data(f, depth + 1, array_depth, record_depth + 1);
-                    coda_cursor_goto_parent(&traverse_info.cursor);
+                    coda_cursor_goto_parent(&writer->cursor);
                 }
             }
             break;
         default:
-            write_basic_data(f, depth);
-            break;
+            return write_basic_data(writer, depth);
+    }
+    return 0;
+}
+
+void ascii_info_init()
+{
+#ifdef HAVE_PTHREAD
+    worker_product = NULL;
+    num_worker_products = 0;
+#endif
+}
+
+void ascii_info_done()
+{
+#ifdef HAVE_PTHREAD
+    if (worker_product != NULL)
+    {
+        int i;
+
+        for (i = 0; i < num_worker_products; i++)
+        {
+            coda_close(worker_product[i]);
+        }
+        free(worker_product);
+        worker_product = NULL;
+        num_worker_products = 0;
     }
+#endif
 }
 
 void export_data_element_to_ascii()
 {
+    ascii_buffer_t buffer = { NULL, 0, 0 };
+    ascii_writer_t writer;
+    int result;
+
     if (first_write_of_data)
     {
         first_write_of_data = 0;
@@ -523,5 +1135,18 @@ void export_data_element_to_ascii()
         return;
     }
 
-    write_data(ascii_output, 0, 0, 0);
+    writer.cursor = traverse_info.cursor;
+    memcpy(writer.array_info, traverse_info.array_info, traverse_info.num_arrays * sizeof(array_info_t));
+    writer.output = &buffer;
+    writer.flush = 1;
+    result = write_data(&writer, 0, 0, 0);
+    flush_writer(&writer);
+    if (buffer.data != NULL)
+    {
+        free(buffer.data);
+    }
+    if (result != 0)
+    {
+        handle_coda_error();
+    }
 }
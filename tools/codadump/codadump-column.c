@@ -0,0 +1,1041 @@
+/*
+ * Copyright (C) 2007-2017 S[&]T, The Netherlands.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "codadump.h"
+
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+/* The column export writes each data element of the product (i.e. each field that 'codadump list' shows) as a raw
+ * binary file containing all values in C array ordering, using the same flattening of nested arrays as the HDF4 export.
+ * Positions that have no data in the product (because of variable sized dimensions or fields that are not available)
+ * are set to a fill value. All values are stored in little endian byte order. A 'schema.json' file in the output
+ * directory describes the name, data type, and shape of each column file.
+ */
+
+#define MAX_BULK_READ_ELEMENTS 65536
+#define FILL_BLOCK_SIZE 65536
+
+typedef struct column_info
+{
+    char *filename;     /* name of the file that is being written */
+    int num_columns;
+
+    /* properties of the column that is being written */
+    FILE *f;
+    coda_native_type data_type;
+    int element_size;
+    int64_t position;   /* number of elements that have been written */
+    unsigned char fill_block[FILL_BLOCK_SIZE];
+    unsigned char *data;
+    long data_size;
+
+    /* path to the data element within each parent record (i.e. the field names separated by '/') */
+    char *field_path;
+    long field_path_offset[CODA_CURSOR_MAXDEPTH];
+} column_info_t;
+
+static column_info_t column_info;
+
+static void create_directory(const char *dirname)
+{
+    int result;
+
+#ifdef WIN32
+    result = CreateDirectory(dirname, NULL) ? 0 : (GetLastError() == ERROR_ALREADY_EXISTS ? 0 : -1);
+#else
+    result = mkdir(dirname, 0777);
+    if (result != 0 && errno == EEXIST)
+    {
+        struct stat statbuf;
+
+        result = (stat(dirname, &statbuf) == 0 && (statbuf.st_mode & S_IFDIR)) ? 0 : -1;
+    }
+#endif
+    if (result != 0)
+    {
+        fprintf(stderr, "ERROR: could not create output directory \"%s\"\n", dirname);
+        exit(1);
+    }
+}
+
+static FILE *open_file(const char *name, const char *extension)
+{
+    FILE *f;
+
+    if (column_info.filename != NULL)
+    {
+        free(column_info.filename);
+    }
+    column_info.filename = malloc(strlen(output_file_name) + strlen(name) + strlen(extension) + 2);
+    if (column_info.filename == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       strlen(output_file_name) + strlen(name) + strlen(extension) + 2, __FILE__, __LINE__);
+        handle_coda_error();
+    }
+    sprintf(column_info.filename, "%s/%s%s", output_file_name, name, extension);
+    f = fopen(column_info.filename, "wb");
+    if (f == NULL)
+    {
+        fprintf(stderr, "ERROR: could not create output file \"%s\" (%s)\n", column_info.filename, strerror(errno));
+        exit(1);
+    }
+    return f;
+}
+
+static void close_file(FILE *f)
+{
+    if (fclose(f) != 0)
+    {
+        fprintf(stderr, "ERROR: could not write output file \"%s\" (%s)\n", column_info.filename, strerror(errno));
+        exit(1);
+    }
+}
+
+void column_info_init()
+{
+    create_directory(output_file_name);
+
+    column_info.filename = NULL;
+    column_info.num_columns = 0;
+    column_info.f = NULL;
+    column_info.data = NULL;
+    column_info.data_size = 0;
+
+    /* the schema is written using the buffered output functions */
+    ascii_output = open_file("schema", ".json");
+    output_string("{\n  \"product\": \"");
+    output_escaped(traverse_info.file_name, (long)strlen(traverse_info.file_name));
+    output_string("\",\n  \"byte_order\": \"little_endian\",\n  \"columns\": [");
+}
+
+void column_info_done()
+{
+    output_string(column_info.num_columns > 0 ? "\n  ]\n}\n" : "]\n}\n");
+    output_flush();
+    close_file(ascii_output);
+    ascii_output = NULL;
+
+    if (column_info.data != NULL)
+    {
+        free(column_info.data);
+    }
+    free(column_info.filename);
+    column_info.filename = NULL;
+}
+
+static void ensure_data_size(long size)
+{
+    if (size > column_info.data_size)
+    {
+        unsigned char *data;
+
+        data = realloc(column_info.data, size);
+        if (data == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)size, __FILE__, __LINE__);
+            handle_coda_error();
+        }
+        column_info.data = data;
+        column_info.data_size = size;
+    }
+}
+
+/* determine the data type that is used to store the values of a data element in a column file */
+static coda_native_type get_column_data_type(coda_type *type)
+{
+    coda_type_class type_class;
+
+    if (coda_type_get_class(type, &type_class) != 0)
+    {
+        handle_coda_error();
+    }
+    if (type_class == coda_special_class)
+    {
+        coda_special_type special_type;
+
+        if (coda_type_get_special_type(type, &special_type) != 0)
+        {
+            handle_coda_error();
+        }
+        /* vsf integer and time values are stored as double; complex values as pairs of doubles */
+        return special_type == coda_special_no_data ? coda_native_type_not_available : coda_native_type_double;
+    }
+    else
+    {
+        coda_native_type read_type;
+
+        if (coda_type_get_read_type(type, &read_type) != 0)
+        {
+            handle_coda_error();
+        }
+        switch (read_type)
+        {
+            case coda_native_type_string:
+                /* strings are stored as fixed length (zero padded) character arrays */
+                return coda_native_type_char;
+            case coda_native_type_bytes:
+                return coda_native_type_uint8;
+            default:
+                return read_type;
+        }
+    }
+}
+
+static int get_element_size(coda_native_type data_type)
+{
+    switch (data_type)
+    {
+        case coda_native_type_int8:
+        case coda_native_type_uint8:
+        case coda_native_type_char:
+            return 1;
+        case coda_native_type_int16:
+        case coda_native_type_uint16:
+            return 2;
+        case coda_native_type_int32:
+        case coda_native_type_uint32:
+        case coda_native_type_float:
+            return 4;
+        case coda_native_type_int64:
+        case coda_native_type_uint64:
+        case coda_native_type_double:
+            return 8;
+        default:
+            assert(0);
+            exit(1);
+    }
+}
+
+static void init_fill_block()
+{
+    int i;
+
+    switch (column_info.data_type)
+    {
+        case coda_native_type_char:
+        case coda_native_type_uint8:
+        case coda_native_type_uint16:
+        case coda_native_type_uint32:
+        case coda_native_type_uint64:
+            /* unsigned types use the maximum value (and characters use 0) */
+            memset(column_info.fill_block, column_info.data_type == coda_native_type_char ? 0 : 0xFF,
+                   FILL_BLOCK_SIZE);
+            break;
+        case coda_native_type_int8:
+        case coda_native_type_int16:
+        case coda_native_type_int32:
+        case coda_native_type_int64:
+            /* signed types use the minimum value */
+            memset(column_info.fill_block, 0, FILL_BLOCK_SIZE);
+            for (i = column_info.element_size - 1; i < FILL_BLOCK_SIZE; i += column_info.element_size)
+            {
+                column_info.fill_block[i] = 0x80;
+            }
+            break;
+        case coda_native_type_float:
+            {
+                float value = (float)coda_NaN();
+
+                for (i = 0; i < FILL_BLOCK_SIZE; i += 4)
+                {
+                    memcpy(&column_info.fill_block[i], &value, 4);
+                }
+            }
+            break;
+        case coda_native_type_double:
+            {
+                double value = coda_NaN();
+
+                for (i = 0; i < FILL_BLOCK_SIZE; i += 8)
+                {
+                    memcpy(&column_info.fill_block[i], &value, 8);
+                }
+            }
+            break;
+        default:
+            assert(0);
+            exit(1);
+    }
+#ifdef WORDS_BIGENDIAN
+    if (column_info.data_type == coda_native_type_float || column_info.data_type == coda_native_type_double)
+    {
+        int j;
+
+        for (i = 0; i < FILL_BLOCK_SIZE; i += column_info.element_size)
+        {
+            for (j = 0; j < column_info.element_size / 2; j++)
+            {
+                unsigned char c = column_info.fill_block[i + j];
+
+                column_info.fill_block[i + j] = column_info.fill_block[i + column_info.element_size - 1 - j];
+                column_info.fill_block[i + column_info.element_size - 1 - j] = c;
+            }
+        }
+    }
+#endif
+}
+
+static void write_bytes(const void *data, size_t size)
+{
+    if (fwrite(data, 1, size, column_info.f) != size)
+    {
+        fprintf(stderr, "ERROR: could not write output file \"%s\" (%s)\n", column_info.filename, strerror(errno));
+        exit(1);
+    }
+}
+
+/* write fill values up to (but not including) the element at the given offset */
+static void write_fill_values(int64_t offset)
+{
+    int64_t num_bytes;
+
+    assert(offset >= column_info.position);
+    num_bytes = (offset - column_info.position) * column_info.element_size;
+    while (num_bytes > 0)
+    {
+        size_t size = num_bytes > FILL_BLOCK_SIZE ? FILL_BLOCK_SIZE : (size_t)num_bytes;
+
+        write_bytes(column_info.fill_block, size);
+        num_bytes -= size;
+    }
+    column_info.position = offset;
+}
+
+/* write num_elements values from column_info.data at the given element offset in the column */
+static void write_values(int64_t offset, long num_elements)
+{
+#ifdef WORDS_BIGENDIAN
+    if (column_info.element_size > 1)
+    {
+        long size = num_elements * column_info.element_size;
+        long i;
+        int j;
+
+        for (i = 0; i < size; i += column_info.element_size)
+        {
+            for (j = 0; j < column_info.element_size / 2; j++)
+            {
+                unsigned char c = column_info.data[i + j];
+
+                column_info.data[i + j] = column_info.data[i + column_info.element_size - 1 - j];
+                column_info.data[i + column_info.element_size - 1 - j] = c;
+            }
+        }
+    }
+#endif
+    write_fill_values(offset);
+    write_bytes(column_info.data, (size_t)num_elements * column_info.element_size);
+    column_info.position += num_elements;
+}
+
+/* read a single value (or a string/raw/complex value as a whole) at the cursor into column_info.data */
+static long read_value(int depth, int array_depth)
+{
+    coda_type_class type_class;
+    int result = 0;
+
+    if (coda_type_get_class(traverse_info.type[depth], &type_class) != 0)
+    {
+        handle_coda_error();
+    }
+    if (type_class == coda_special_class)
+    {
+        coda_special_type special_type;
+
+        if (coda_type_get_special_type(traverse_info.type[depth], &special_type) != 0)
+        {
+            handle_coda_error();
+        }
+        if (special_type == coda_special_complex)
+        {
+            if (coda_cursor_read_complex_double_pair(&traverse_info.cursor, (double *)column_info.data) != 0)
+            {
+                handle_coda_error();
+            }
+            return 2;
+        }
+        if (coda_cursor_read_double(&traverse_info.cursor, (double *)column_info.data) != 0)
+        {
+            handle_coda_error();
+        }
+        return 1;
+    }
+
+    if (type_class == coda_text_class || type_class == coda_raw_class)
+    {
+        coda_native_type read_type;
+
+        if (coda_type_get_read_type(traverse_info.type[depth], &read_type) != 0)
+        {
+            handle_coda_error();
+        }
+        if (read_type == coda_native_type_string || read_type == coda_native_type_bytes)
+        {
+            long length = dim_info.dim[traverse_info.array_info[array_depth].dim_id];
+
+            /* the data is padded with zeros up to the maximum length */
+            memset(column_info.data, 0, length + 1);
+            if (read_type == coda_native_type_string)
+            {
+                result = coda_cursor_read_string(&traverse_info.cursor, (char *)column_info.data, length + 1);
+            }
+            else
+            {
+                int64_t bit_size;
+
+                if (coda_cursor_get_bit_size(&traverse_info.cursor, &bit_size) != 0)
+                {
+                    handle_coda_error();
+                }
+                result = coda_cursor_read_bits(&traverse_info.cursor, column_info.data, 0, bit_size);
+            }
+            if (result != 0)
+            {
+                handle_coda_error();
+            }
+            return length;
+        }
+    }
+
+    switch (column_info.data_type)
+    {
+        case coda_native_type_int8:
+            result = coda_cursor_read_int8(&traverse_info.cursor, (int8_t *)column_info.data);
+            break;
+        case coda_native_type_uint8:
+            result = coda_cursor_read_uint8(&traverse_info.cursor, (uint8_t *)column_info.data);
+            break;
+        case coda_native_type_int16:
+            result = coda_cursor_read_int16(&traverse_info.cursor, (int16_t *)column_info.data);
+            break;
+        case coda_native_type_uint16:
+            result = coda_cursor_read_uint16(&traverse_info.cursor, (uint16_t *)column_info.data);
+            break;
+        case coda_native_type_int32:
+            result = coda_cursor_read_int32(&traverse_info.cursor, (int32_t *)column_info.data);
+            break;
+        case coda_native_type_uint32:
+            result = coda_cursor_read_uint32(&traverse_info.cursor, (uint32_t *)column_info.data);
+            break;
+        case coda_native_type_int64:
+            result = coda_cursor_read_int64(&traverse_info.cursor, (int64_t *)column_info.data);
+            break;
+        case coda_native_type_uint64:
+            result = coda_cursor_read_uint64(&traverse_info.cursor, (uint64_t *)column_info.data);
+            break;
+        case coda_native_type_float:
+            result = coda_cursor_read_float(&traverse_info.cursor, (float *)column_info.data);
+            break;
+        case coda_native_type_double:
+            result = coda_cursor_read_double(&traverse_info.cursor, (double *)column_info.data);
+            break;
+        case coda_native_type_char:
+            result = coda_cursor_read_char(&traverse_info.cursor, (char *)column_info.data);
+            break;
+        default:
+            assert(0);
+            exit(1);
+    }
+    if (result != 0)
+    {
+        handle_coda_error();
+    }
+    return 1;
+}
+
+static int read_partial_array(long offset, long length)
+{
+    switch (column_info.data_type)
+    {
+        case coda_native_type_int8:
+            return coda_cursor_read_int8_partial_array(&traverse_info.cursor, offset, length,
+                                                       (int8_t *)column_info.data);
+        case coda_native_type_uint8:
+            return coda_cursor_read_uint8_partial_array(&traverse_info.cursor, offset, length,
+                                                        (uint8_t *)column_info.data);
+        case coda_native_type_int16:
+            return coda_cursor_read_int16_partial_array(&traverse_info.cursor, offset, length,
+                                                        (int16_t *)column_info.data);
+        case coda_native_type_uint16:
+            return coda_cursor_read_uint16_partial_array(&traverse_info.cursor, offset, length,
+                                                         (uint16_t *)column_info.data);
+        case coda_native_type_int32:
+            return coda_cursor_read_int32_partial_array(&traverse_info.cursor, offset, length,
+                                                        (int32_t *)column_info.data);
+        case coda_native_type_uint32:
+            return coda_cursor_read_uint32_partial_array(&traverse_info.cursor, offset, length,
+                                                         (uint32_t *)column_info.data);
+        case coda_native_type_int64:
+            return coda_cursor_read_int64_partial_array(&traverse_info.cursor, offset, length,
+                                                        (int64_t *)column_info.data);
+        case coda_native_type_uint64:
+            return coda_cursor_read_uint64_partial_array(&traverse_info.cursor, offset, length,
+                                                         (uint64_t *)column_info.data);
+        case coda_native_type_float:
+            return coda_cursor_read_float_partial_array(&traverse_info.cursor, offset, length,
+                                                        (float *)column_info.data);
+        case coda_native_type_double:
+            return coda_cursor_read_double_partial_array(&traverse_info.cursor, offset, length,
+                                                         (double *)column_info.data);
+        default:
+            break;
+    }
+    assert(0);
+    exit(1);
+}
+
+static int read_field_array(const char *path)
+{
+    switch (column_info.data_type)
+    {
+        case coda_native_type_int8:
+            return coda_cursor_read_int8_field_array(&traverse_info.cursor, path, (int8_t *)column_info.data);
+        case coda_native_type_uint8:
+            return coda_cursor_read_uint8_field_array(&traverse_info.cursor, path, (uint8_t *)column_info.data);
+        case coda_native_type_int16:
+            return coda_cursor_read_int16_field_array(&traverse_info.cursor, path, (int16_t *)column_info.data);
+        case coda_native_type_uint16:
+            return coda_cursor_read_uint16_field_array(&traverse_info.cursor, path, (uint16_t *)column_info.data);
+        case coda_native_type_int32:
+            return coda_cursor_read_int32_field_array(&traverse_info.cursor, path, (int32_t *)column_info.data);
+        case coda_native_type_uint32:
+            return coda_cursor_read_uint32_field_array(&traverse_info.cursor, path, (uint32_t *)column_info.data);
+        case coda_native_type_int64:
+            return coda_cursor_read_int64_field_array(&traverse_info.cursor, path, (int64_t *)column_info.data);
+        case coda_native_type_uint64:
+            return coda_cursor_read_uint64_field_array(&traverse_info.cursor, path, (uint64_t *)column_info.data);
+        case coda_native_type_float:
+            return coda_cursor_read_float_field_array(&traverse_info.cursor, path, (float *)column_info.data);
+        case coda_native_type_double:
+            return coda_cursor_read_double_field_array(&traverse_info.cursor, path, (double *)column_info.data);
+        default:
+            break;
+    }
+    assert(0);
+    exit(1);
+}
+
+/* Try to write the data for all elements of the array at the cursor with a single bulk read.
+ * This is possible if the data element is a (single) numerical value that is either the array element itself or a
+ * (statically available) field within a record that is the array element.
+ * Returns 1 if the data was written, 0 otherwise.
+ */
+static int write_array_bulk(int depth, int array_depth, int record_depth, int64_t offset, const int *local_dim,
+                            long num_elements)
+{
+    array_info_t *array_info = &traverse_info.array_info[array_depth];
+    coda_type_class type_class;
+    int i;
+
+    if (array_info->dim_id + array_info->num_dims != dim_info.num_dims ||
+        column_info.data_type == coda_native_type_char)
+    {
+        /* the data element is not a single numerical value */
+        return 0;
+    }
+    for (i = 1; i < array_info->num_dims; i++)
+    {
+        if (local_dim[i] != dim_info.dim[array_info->dim_id + i])
+        {
+            /* the array elements are not stored contiguously in the column */
+            return 0;
+        }
+    }
+    for (i = depth + 1; i < traverse_info.current_depth; i++)
+    {
+        if (coda_type_get_class(traverse_info.type[i], &type_class) != 0)
+        {
+            handle_coda_error();
+        }
+        if (type_class != coda_record_class || traverse_info.field_available_status[i] == -1)
+        {
+            return 0;
+        }
+    }
+
+    if (depth + 1 == traverse_info.current_depth)
+    {
+        long chunk_offset;
+
+        if (coda_type_get_class(traverse_info.type[depth + 1], &type_class) != 0)
+        {
+            handle_coda_error();
+        }
+        if (type_class == coda_special_class)
+        {
+            /* use the generic approach for special types */
+            return 0;
+        }
+        ensure_data_size(MAX_BULK_READ_ELEMENTS * column_info.element_size);
+        for (chunk_offset = 0; chunk_offset < num_elements; chunk_offset += MAX_BULK_READ_ELEMENTS)
+        {
+            long length = num_elements - chunk_offset;
+
+            if (length > MAX_BULK_READ_ELEMENTS)
+            {
+                length = MAX_BULK_READ_ELEMENTS;
+            }
+            if (read_partial_array(chunk_offset, length) != 0)
+            {
+                handle_coda_error();
+            }
+            write_values(offset + chunk_offset, length);
+        }
+    }
+    else
+    {
+        ensure_data_size(num_elements * column_info.element_size);
+        if (read_field_array(&column_info.field_path[column_info.field_path_offset[record_depth]]) != 0)
+        {
+            handle_coda_error();
+        }
+        write_values(offset, num_elements);
+    }
+
+    return 1;
+}
+
+static void write_data(int depth, int array_depth, int record_depth, int64_t offset)
+{
+    coda_type_class type_class;
+
+    if (coda_type_get_class(traverse_info.type[depth], &type_class) != 0)
+    {
+        handle_coda_error();
+    }
+    switch (type_class)
+    {
+        case coda_record_class:
+            {
+                int available;
+
+                if (coda_cursor_get_record_field_available_status(&traverse_info.cursor,
+                                                                  traverse_info.parent_index[record_depth],
+                                                                  &available) != 0)
+                {
+                    handle_coda_error();
+                }
+                /* if the field is not available, the data will be set to fill values */
+                if (available)
+                {
+                    if (coda_cursor_goto_record_field_by_index(&traverse_info.cursor,
+                                                               traverse_info.parent_index[record_depth]) != 0)
+                    {
+                        handle_coda_error();
+                    }
+                    write_data(depth + 1, array_depth, record_depth + 1, offset);
+                    coda_cursor_goto_parent(&traverse_info.cursor);
+                }
+            }
+            break;
+        case coda_array_class:
+            {
+                array_info_t *array_info;
+                int64_t stride[MAX_NUM_DIMS];
+                int index[MAX_NUM_DIMS];
+                int local_dim[MAX_NUM_DIMS];
+                int has_var_dim_sub_array;
+                long number_of_elements;
+                int dim_id;
+                long i;
+                int k;
+
+                array_info = &traverse_info.array_info[array_depth];
+                dim_id = array_info->dim_id;
+
+                if (array_depth == 0)
+                {
+                    array_info->global_index = 0;
+                }
+                has_var_dim_sub_array = (dim_info.last_var_size_dim >= dim_id + array_info->num_dims);
+                if (has_var_dim_sub_array && array_depth < traverse_info.num_arrays - 1)
+                {
+                    /* Set the index for the var_dim list(s) for the next array */
+                    traverse_info.array_info[array_depth + 1].global_index =
+                        array_info->global_index * array_info->num_elements;
+                }
+
+                /* calculate local dimensions and number of array elements */
+                number_of_elements = 1;
+                for (k = 0; k < array_info->num_dims; k++)
+                {
+                    if (dim_info.is_var_size_dim[dim_id + k])
+                    {
+                        local_dim[k] = dim_info.var_dim[dim_id + k][array_info->global_index];
+                    }
+                    else
+                    {
+                        local_dim[k] = dim_info.dim[dim_id + k];
+                    }
+                    number_of_elements *= local_dim[k];
+                    stride[k] = (dim_id + k + 1 < dim_info.num_dims ? dim_info.array_size[dim_id + k + 1] : 1);
+                    index[k] = 0;
+                }
+                if (number_of_elements == 0)
+                {
+                    /* array is empty */
+                    return;
+                }
+
+                if (write_array_bulk(depth, array_depth, record_depth, offset, local_dim, number_of_elements))
+                {
+                    return;
+                }
+
+                if (coda_cursor_goto_first_array_element(&traverse_info.cursor) != 0)
+                {
+                    handle_coda_error();
+                }
+                for (i = 0; i < number_of_elements; i++)
+                {
+                    int64_t element_offset = offset;
+
+                    for (k = 0; k < array_info->num_dims; k++)
+                    {
+                        element_offset += index[k] * stride[k];
+                    }
+                    write_data(depth + 1, array_depth + 1, record_depth, element_offset);
+
+                    if (i < number_of_elements - 1)
+                    {
+                        /* increase current position */
+                        k = array_info->num_dims - 1;
+                        index[k]++;
+                        while (index[k] == local_dim[k])
+                        {
+                            index[k] = 0;
+                            k--;
+                            index[k]++;
+                        }
+                        if (coda_cursor_goto_next_array_element(&traverse_info.cursor) != 0)
+                        {
+                            handle_coda_error();
+                        }
+                        if (has_var_dim_sub_array && array_depth < traverse_info.num_arrays - 1)
+                        {
+                            traverse_info.array_info[array_depth + 1].global_index++;
+                        }
+                    }
+                }
+                coda_cursor_goto_parent(&traverse_info.cursor);
+            }
+            break;
+        default:
+            write_values(offset, read_value(depth, array_depth));
+            break;
+    }
+}
+
+/* write an int32 column with the actual lengths of a variable sized dimension */
+static void write_dim_column(const char *name, int dim_id)
+{
+    char extension[32];
+    int64_t num_elements;
+    int i;
+
+    num_elements = dim_info.var_dim_num_dims[dim_id] > 0 ?
+        dim_info.num_elements[dim_info.var_dim_num_dims[dim_id] - 1] : 1;
+    sprintf(extension, ".dim%d.bin", dim_id);
+    column_info.f = open_file(name, extension);
+#ifdef WORDS_BIGENDIAN
+    {
+        int64_t j;
+
+        for (j = 0; j < num_elements; j++)
+        {
+            uint32_t value = (uint32_t)dim_info.var_dim[dim_id][j];
+
+            value = ((value & 0xff) << 24) | ((value & 0xff00) << 8) | ((value >> 8) & 0xff00) | (value >> 24);
+            write_bytes(&value, 4);
+        }
+    }
+#else
+    write_bytes(dim_info.var_dim[dim_id], (size_t)num_elements * sizeof(int32_t));
+#endif
+    close_file(column_info.f);
+    column_info.f = NULL;
+
+    output_string("{\"dim\": ");
+    output_int64(dim_id);
+    output_string(", \"file\": \"");
+    output_string(name);
+    output_string(extension);
+    output_string("\", \"type\": \"int32\", \"shape\": [");
+    for (i = 0; i < dim_info.var_dim_num_dims[dim_id]; i++)
+    {
+        if (i > 0)
+        {
+            output_string(", ");
+        }
+        output_int64(dim_info.dim[i]);
+    }
+    output_string("]}");
+}
+
+static void print_column_path()
+{
+    int record_id = 0;
+    int i;
+
+    for (i = 0; i < traverse_info.current_depth; i++)
+    {
+        coda_type_class type_class;
+
+        if (coda_type_get_class(traverse_info.type[i], &type_class) != 0)
+        {
+            handle_coda_error();
+        }
+        if (type_class == coda_record_class)
+        {
+            output_char('/');
+            output_string(traverse_info.field_name[record_id]);
+            record_id++;
+        }
+        else if (type_class == coda_array_class)
+        {
+            output_string(i == 0 ? "/[]" : "[]");
+        }
+    }
+    if (traverse_info.current_depth == 0)
+    {
+        output_char('/');
+    }
+}
+
+static void print_type_property(const char *key, const char *value)
+{
+    if (value != NULL && value[0] != '\0')
+    {
+        output_string(",\n     \"");
+        output_string(key);
+        output_string("\": \"");
+        output_escaped(value, (long)strlen(value));
+        output_char('"');
+    }
+}
+
+void export_data_element_to_column()
+{
+    coda_type *type = traverse_info.type[traverse_info.current_depth];
+    char *name;
+    int64_t num_elements;
+    int64_t filled_num_elements;
+    long length;
+    int i;
+
+    column_info.data_type = get_column_data_type(type);
+    if (column_info.data_type == coda_native_type_not_available)
+    {
+        return;
+    }
+    column_info.element_size = get_element_size(column_info.data_type);
+    if (dim_info.num_dims > 0)
+    {
+        num_elements = dim_info.num_elements[dim_info.num_dims - 1];
+        filled_num_elements = dim_info.filled_num_elements[dim_info.num_dims - 1];
+    }
+    else
+    {
+        num_elements = 1;
+        filled_num_elements = 1;
+    }
+
+    if (verbosity > 0)
+    {
+        char s[21];
+
+        print_full_field_name(stdout, 2, 1);
+        coda_str64(num_elements * column_info.element_size, s);
+        printf(" '%s' (%s bytes)\n", coda_type_get_native_type_name(column_info.data_type), s);
+    }
+
+    if (filled_num_elements == 0)
+    {
+        fprintf(stderr, "WARNING: field \"");
+        print_full_field_name(stderr, 0, 0);
+        fprintf(stderr, "\" ignored because it contains no elements.\n");
+        return;
+    }
+
+    /* the column name is the list of field names separated by '.' (and the field path uses '/' as separator) */
+    length = 5;
+    for (i = 0; i < traverse_info.num_records; i++)
+    {
+        length += (long)strlen(traverse_info.field_name[i]) + 1;
+    }
+    name = malloc(2 * length);
+    if (name == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)", 2 * length,
+                       __FILE__, __LINE__);
+        handle_coda_error();
+    }
+    column_info.field_path = &name[length];
+    length = 0;
+    for (i = 0; i < traverse_info.num_records; i++)
+    {
+        column_info.field_path_offset[i] = length;
+        strcpy(&name[length], traverse_info.field_name[i]);
+        strcpy(&column_info.field_path[length], traverse_info.field_name[i]);
+        length += (long)strlen(traverse_info.field_name[i]);
+        name[length] = '.';
+        column_info.field_path[length] = '/';
+        length++;
+    }
+    if (length > 0)
+    {
+        name[length - 1] = '\0';
+        column_info.field_path[length - 1] = '\0';
+    }
+    else
+    {
+        strcpy(name, "data");
+    }
+
+    /* write the data */
+    column_info.f = open_file(name, ".bin");
+    column_info.position = 0;
+    init_fill_block();
+    length = 16;
+    if (dim_info.num_dims > 0 && dim_info.dim[dim_info.num_dims - 1] >= length)
+    {
+        /* room for reading strings and raw data */
+        length = dim_info.dim[dim_info.num_dims - 1] + 1;
+    }
+    ensure_data_size(length);
+    write_data(0, 0, 0, 0);
+    write_fill_values(num_elements);
+    close_file(column_info.f);
+    column_info.f = NULL;
+
+    /* add the column to the schema */
+    output_string(column_info.num_columns > 0 ? ",\n    {\"name\": \"" : "\n    {\"name\": \"");
+    output_string(name);
+    output_string("\",\n     \"path\": \"");
+    print_column_path();
+    output_string("\",\n     \"file\": \"");
+    output_string(name);
+    output_string(".bin\",\n     \"type\": \"");
+    output_string(coda_type_get_native_type_name(column_info.data_type));
+    output_string("\",\n     \"shape\": [");
+    for (i = 0; i < dim_info.num_dims; i++)
+    {
+        if (i > 0)
+        {
+            output_string(", ");
+        }
+        output_int64(dim_info.dim[i]);
+    }
+    output_string("],\n     \"fill_value\": ");
+    switch (column_info.data_type)
+    {
+        case coda_native_type_float:
+        case coda_native_type_double:
+            output_string("\"NaN\"");
+            break;
+        case coda_native_type_char:
+            output_char('0');
+            break;
+        case coda_native_type_int8:
+            output_int64(INT8_MIN);
+            break;
+        case coda_native_type_int16:
+            output_int64(INT16_MIN);
+            break;
+        case coda_native_type_int32:
+            output_int64(INT32_MIN);
+            break;
+        case coda_native_type_int64:
+            output_int64(INT64_MIN);
+            break;
+        case coda_native_type_uint8:
+            output_uint64(UINT8_MAX);
+            break;
+        case coda_native_type_uint16:
+            output_uint64(UINT16_MAX);
+            break;
+        case coda_native_type_uint32:
+            output_uint64(UINT32_MAX);
+            break;
+        case coda_native_type_uint64:
+            output_uint64(UINT64_MAX);
+            break;
+        default:
+            assert(0);
+            exit(1);
+    }
+    {
+        const char *unit;
+        const char *description;
+
+        if (coda_type_get_unit(type, &unit) != 0)
+        {
+            handle_coda_error();
+        }
+        print_type_property("unit", unit);
+        if (coda_type_get_description(type, &description) != 0)
+        {
+            handle_coda_error();
+        }
+        print_type_property("description", description);
+    }
+    if (dim_info.is_var_size)
+    {
+        int first = 1;
+
+        output_string(",\n     \"variable_dims\": [");
+        for (i = 0; i < dim_info.num_dims; i++)
+        {
+            if (dim_info.is_var_size_dim[i])
+            {
+                if (!first)
+                {
+                    output_string(",\n                       ");
+                }
+                write_dim_column(name, i);
+                first = 0;
+            }
+        }
+        output_char(']');
+    }
+    output_char('}');
+    column_info.num_columns++;
+
+    free(name);
+    column_info.field_path = NULL;
+}
@@ -673,6 +673,14 @@ void print_debug_data(const char *product_class, const char *product_type, int f
         handle_coda_error();
     }
     print_offsets = (format == coda_format_ascii || format == coda_format_binary || format == coda_format_xml);
+    if (starting_path == NULL)
+    {
+        /* the full product will be dumped from start to end */
+        if (coda_set_product_access_pattern(pf, coda_access_pattern_sequential) != 0)
+        {
+            handle_coda_error();
+        }
+    }
 
     if (coda_cursor_set_product(&cursor, pf) != 0)
     {
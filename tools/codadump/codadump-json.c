@@ -31,65 +31,137 @@
 
 #include "codadump.h"
 
-#include <stdarg.h>
+#define MAX_BULK_READ_ELEMENTS 65536
 
 static int show_attributes = 0;
 
-static int ff_printf(const char *templ, ...)
-{
-    int result;
-    va_list ap;
-
-    va_start(ap, templ);
-    result = vfprintf(ascii_output, templ, ap);
-    va_end(ap);
-
-    return result;
-}
-
-static void print_escaped(const char *data, long length)
+/* print an array of numbers using bulk reads of the array elements
+ * returns 1 if the array was printed and 0 if the elements need to be printed individually
+ */
+static int print_numeric_array(coda_cursor *cursor, long num_elements)
 {
+    coda_native_type read_type;
+    coda_type_class type_class;
+    coda_type *type;
+    void *data;
+    long length;
+    long offset;
     long i;
 
-    for (i = 0; i < length; i++)
+    if (coda_cursor_get_type(cursor, &type) != 0)
+    {
+        handle_coda_error();
+    }
+    if (coda_type_get_array_base_type(type, &type) != 0)
+    {
+        handle_coda_error();
+    }
+    if (coda_type_get_class(type, &type_class) != 0)
+    {
+        handle_coda_error();
+    }
+    if (type_class != coda_integer_class && type_class != coda_real_class)
+    {
+        return 0;
+    }
+    if (show_attributes)
     {
-        char c;
+        int has_attributes;
 
-        c = data[i];
-        switch (c)
+        if (coda_type_has_attributes(type, &has_attributes) != 0)
         {
-            case '\b':
-                ff_printf("\\b");
-                break;
-            case '\f':
-                ff_printf("\\f");
-                break;
-            case '\n':
-                ff_printf("\\n");
-                break;
-            case '\r':
-                ff_printf("\\r");
-                break;
-            case '\t':
-                ff_printf("\\t");
-                break;
-            case '"':
-                ff_printf("\\\"");
+            handle_coda_error();
+        }
+        if (has_attributes)
+        {
+            return 0;
+        }
+    }
+    if (coda_type_get_read_type(type, &read_type) != 0)
+    {
+        handle_coda_error();
+    }
+    if (read_type == coda_native_type_not_available)
+    {
+        return 0;
+    }
+
+    length = (num_elements < MAX_BULK_READ_ELEMENTS ? num_elements : MAX_BULK_READ_ELEMENTS);
+    data = malloc(length * sizeof(double));
+    if (data == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(length * sizeof(double)), __FILE__, __LINE__);
+        handle_coda_error();
+    }
+    for (offset = 0; offset < num_elements; offset += length)
+    {
+        if (offset + length > num_elements)
+        {
+            length = num_elements - offset;
+        }
+        switch (read_type)
+        {
+            case coda_native_type_int8:
+            case coda_native_type_int16:
+            case coda_native_type_int32:
+            case coda_native_type_int64:
+                if (coda_cursor_read_int64_partial_array(cursor, offset, length, (int64_t *)data) != 0)
+                {
+                    handle_coda_error();
+                }
+                for (i = 0; i < length; i++)
+                {
+                    if (offset + i > 0)
+                    {
+                        output_char(',');
+                    }
+                    output_int64(((int64_t *)data)[i]);
+                }
                 break;
-            case '\\':
-                ff_printf("\\\\");
+            case coda_native_type_uint8:
+            case coda_native_type_uint16:
+            case coda_native_type_uint32:
+            case coda_native_type_uint64:
+                if (coda_cursor_read_uint64_partial_array(cursor, offset, length, (uint64_t *)data) != 0)
+                {
+                    handle_coda_error();
+                }
+                for (i = 0; i < length; i++)
+                {
+                    if (offset + i > 0)
+                    {
+                        output_char(',');
+                    }
+                    output_uint64(((uint64_t *)data)[i]);
+                }
                 break;
             default:
-                if (c >= 32 && c <= 126)
+                if (coda_cursor_read_double_partial_array(cursor, offset, length, (double *)data) != 0)
                 {
-                    ff_printf("%c", c);
+                    handle_coda_error();
                 }
-                else
+                for (i = 0; i < length; i++)
                 {
-                    ff_printf("\\u%02x", (int)(unsigned char)c);
+                    if (offset + i > 0)
+                    {
+                        output_char(',');
+                    }
+                    if (read_type == coda_native_type_float)
+                    {
+                        output_float(((double *)data)[i]);
+                    }
+                    else
+                    {
+                        output_double(((double *)data)[i]);
+                    }
                 }
+                break;
         }
     }
+    free(data);
+
+    return 1;
 }
 
 static void print_data(coda_cursor *cursor)
@@ -105,14 +177,14 @@ static void print_data(coda_cursor *cursor)
         }
         if (has_attributes)
         {
-            ff_printf("{\"attr\":");
+            output_string("{\"attr\":");
             if (coda_cursor_goto_attributes(cursor) != 0)
             {
                 handle_coda_error();
             }
             print_data(cursor);
             coda_cursor_goto_parent(cursor);
-            ff_printf(",\"data\":");
+            output_string(",\"data\":");
         }
     }
 
@@ -127,7 +199,7 @@ static void print_data(coda_cursor *cursor)
             {
                 long num_fields;
 
-                ff_printf("{");
+                output_char('{');
                 if (coda_cursor_get_num_elements(cursor, &num_fields) != 0)
                 {
                     handle_coda_error();
@@ -163,7 +235,9 @@ static void print_data(coda_cursor *cursor)
                         {
                             handle_coda_error();
                         }
-                        ff_printf("\"%s\":", field_name);
+                        output_char('"');
+                        output_string(field_name);
+                        output_string("\":");
                         print_data(cursor);
                         coda_cursor_goto_parent(cursor);
                     }
@@ -188,7 +262,7 @@ static void print_data(coda_cursor *cursor)
                             {
                                 if (!first_field)
                                 {
-                                    ff_printf(",");
+                                    output_char(',');
                                 }
                                 else
                                 {
@@ -198,7 +272,9 @@ static void print_data(coda_cursor *cursor)
                                 {
                                     handle_coda_error();
                                 }
-                                ff_printf("\"%s\":", field_name);
+                                output_char('"');
+                                output_string(field_name);
+                                output_string("\":");
                                 print_data(cursor);
                             }
                             if (i < num_fields - 1)
@@ -212,7 +288,7 @@ static void print_data(coda_cursor *cursor)
                         coda_cursor_goto_parent(cursor);
                     }
                 }
-                ff_printf("}");
+                output_char('}');
             }
             break;
         case coda_array_class:
@@ -221,7 +297,7 @@ static void print_data(coda_cursor *cursor)
                 int num_dims;
                 long num_elements;
 
-                ff_printf("[");
+                output_char('[');
                 if (coda_cursor_get_array_dim(cursor, &num_dims, dim) != 0)
                 {
                     handle_coda_error();
@@ -235,7 +311,7 @@ static void print_data(coda_cursor *cursor)
                     {
                         num_elements *= dim[i];
                     }
-                    if (num_elements > 0)
+                    if (num_elements > 0 && !print_numeric_array(cursor, num_elements))
                     {
                         if (coda_cursor_goto_first_array_element(cursor) != 0)
                         {
@@ -246,7 +322,7 @@ static void print_data(coda_cursor *cursor)
                             print_data(cursor);
                             if (i < num_elements - 1)
                             {
-                                ff_printf(",");
+                                output_char(',');
                                 if (coda_cursor_goto_next_array_element(cursor) != 0)
                                 {
                                     handle_coda_error();
@@ -256,7 +332,7 @@ static void print_data(coda_cursor *cursor)
                         coda_cursor_goto_parent(cursor);
                     }
                 }
-                ff_printf("]");
+                output_char(']');
             }
             break;
         case coda_integer_class:
@@ -281,9 +357,9 @@ static void print_data(coda_cursor *cursor)
                                 handle_coda_error();
                             }
 
-                            ff_printf("\"");
-                            print_escaped(&data, 1);
-                            ff_printf("\"");
+                            output_char('"');
+                            output_escaped(&data, 1);
+                            output_char('"');
                         }
                         break;
                     case coda_native_type_string:
@@ -308,9 +384,9 @@ static void print_data(coda_cursor *cursor)
                                 handle_coda_error();
                             }
 
-                            ff_printf("\"");
-                            print_escaped(data, length);
-                            ff_printf("\"", length);
+                            output_char('"');
+                            output_escaped(data, length);
+                            output_char('"');
 
                             free(data);
                         }
@@ -339,9 +415,9 @@ static void print_data(coda_cursor *cursor)
                                 handle_coda_error();
                             }
 
-                            ff_printf("\"");
-                            print_escaped((char *)data, (long)byte_size);
-                            ff_printf("\"");
+                            output_char('"');
+                            output_escaped((char *)data, (long)byte_size);
+                            output_char('"');
 
                             free(data);
                         }
@@ -357,7 +433,7 @@ static void print_data(coda_cursor *cursor)
                                 handle_coda_error();
                             }
 
-                            ff_printf("%ld", (long)data);
+                            output_int64(data);
                         }
                         break;
                     case coda_native_type_uint8:
@@ -371,35 +447,31 @@ static void print_data(coda_cursor *cursor)
                                 handle_coda_error();
                             }
 
-                            ff_printf("%lu", (unsigned long)data);
+                            output_uint64(data);
                         }
                         break;
                     case coda_native_type_int64:
                         {
                             int64_t data;
-                            char s[21];
 
                             if (coda_cursor_read_int64(cursor, &data) != 0)
                             {
                                 handle_coda_error();
                             }
 
-                            coda_str64(data, s);
-                            ff_printf("%s", s);
+                            output_int64(data);
                         }
                         break;
                     case coda_native_type_uint64:
                         {
                             uint64_t data;
-                            char s[21];
 
                             if (coda_cursor_read_uint64(cursor, &data) != 0)
                             {
                                 handle_coda_error();
                             }
 
-                            coda_str64u(data, s);
-                            ff_printf("%s", s);
+                            output_uint64(data);
                         }
                         break;
                     case coda_native_type_float:
@@ -414,16 +486,16 @@ static void print_data(coda_cursor *cursor)
 
                             if (read_type == coda_native_type_float)
                             {
-                                ff_printf("%.7g", data);
+                                output_float(data);
                             }
                             else
                             {
-                                ff_printf("%.16g", data);
+                                output_double(data);
                             }
                         }
                         break;
                     case coda_native_type_not_available:
-                        ff_printf("null");
+                        output_string("null");
                         break;
                 }
             }
@@ -440,7 +512,7 @@ static void print_data(coda_cursor *cursor)
                 switch (special_type)
                 {
                     case coda_special_no_data:
-                        ff_printf("null");
+                        output_string("null");
                         break;
                     case coda_special_vsf_integer:
                         {
@@ -451,7 +523,7 @@ static void print_data(coda_cursor *cursor)
                                 handle_coda_error();
                             }
 
-                            ff_printf("%.16g", data);
+                            output_double(data);
                         }
                         break;
                     case coda_special_time:
@@ -465,17 +537,19 @@ static void print_data(coda_cursor *cursor)
                             }
                             if (coda_isNaN(data) || coda_isInf(data))
                             {
-                                ff_printf("%.16g", data);
+                                output_double(data);
                             }
                             else
                             {
                                 if (coda_time_double_to_string(data, "yyyy-MM-dd'T'HH:mm:ss.SSSSSS", str) != 0)
                                 {
-                                    ff_printf("\"{--invalid time value--}\"");
+                                    output_string("\"{--invalid time value--}\"");
                                 }
                                 else
                                 {
-                                    ff_printf("\"%s\"", str);
+                                    output_char('"');
+                                    output_string(str);
+                                    output_char('"');
                                 }
                             }
                         }
@@ -489,7 +563,7 @@ static void print_data(coda_cursor *cursor)
                                 handle_coda_error();
                             }
 
-                            ff_printf("\"%g + %gi\"", re, im);
+                            output_printf("\"%g + %gi\"", re, im);
                         }
                         break;
                 }
@@ -499,12 +573,45 @@ static void print_data(coda_cursor *cursor)
 
     if (has_attributes)
     {
-        ff_printf("}");
+        output_char('}');
     }
 }
 
-void print_json_data(int include_attributes)
+/* print each element of an array on a separate line */
+static void print_ndjson_data(coda_cursor *cursor)
 {
+    long num_elements;
+    long i;
+
+    if (coda_cursor_get_num_elements(cursor, &num_elements) != 0)
+    {
+        handle_coda_error();
+    }
+    if (num_elements > 0)
+    {
+        if (coda_cursor_goto_first_array_element(cursor) != 0)
+        {
+            handle_coda_error();
+        }
+        for (i = 0; i < num_elements; i++)
+        {
+            print_data(cursor);
+            output_char('\n');
+            if (i < num_elements - 1)
+            {
+                if (coda_cursor_goto_next_array_element(cursor) != 0)
+                {
+                    handle_coda_error();
+                }
+            }
+        }
+        coda_cursor_goto_parent(cursor);
+    }
+}
+
+void print_json_data(int include_attributes, int ndjson)
+{
+    coda_type_class type_class;
     coda_product *pf;
     coda_cursor cursor;
     int result;
@@ -525,6 +632,14 @@ void print_json_data(int include_attributes)
     {
         handle_coda_error();
     }
+    if (starting_path == NULL)
+    {
+        /* the full product will be dumped from start to end */
+        if (coda_set_product_access_pattern(pf, coda_access_pattern_sequential) != 0)
+        {
+            handle_coda_error();
+        }
+    }
 
     if (coda_cursor_set_product(&cursor, pf) != 0)
     {
@@ -540,8 +655,20 @@ void print_json_data(int include_attributes)
     }
 
     coda_set_option_perform_boundary_checks(0);
-    print_data(&cursor);
-    ff_printf("\n");
+    if (coda_cursor_get_type_class(&cursor, &type_class) != 0)
+    {
+        handle_coda_error();
+    }
+    if (ndjson && type_class == coda_array_class)
+    {
+        print_ndjson_data(&cursor);
+    }
+    else
+    {
+        print_data(&cursor);
+        output_char('\n');
+    }
+    output_flush();
 
     coda_close(pf);
 }
@@ -0,0 +1,692 @@
+/*
+ * Copyright (C) 2007-2017 S[&]T, The Netherlands.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "codadump.h"
+
+#include <errno.h>
+#include <stdarg.h>
+
+/* Output of the json and yaml modes is collected in a single buffer that is only written to ascii_output when it is
+ * full (or when output_flush() is called). This avoids the overhead of a stdio call for each item that is printed.
+ */
+#define OUTPUT_BUFFER_SIZE (1024 * 1024)
+
+static char output_buffer[OUTPUT_BUFFER_SIZE];
+static long output_length = 0;
+
+void output_flush()
+{
+    if (output_length > 0)
+    {
+        if (fwrite(output_buffer, 1, output_length, ascii_output) != (size_t)output_length)
+        {
+            fprintf(stderr, "ERROR: could not write output (%s)\n", strerror(errno));
+            exit(1);
+        }
+        output_length = 0;
+    }
+}
+
+void output_write(const char *data, long length)
+{
+    if (output_length + length > OUTPUT_BUFFER_SIZE)
+    {
+        output_flush();
+        if (length > OUTPUT_BUFFER_SIZE)
+        {
+            if (fwrite(data, 1, length, ascii_output) != (size_t)length)
+            {
+                fprintf(stderr, "ERROR: could not write output (%s)\n", strerror(errno));
+                exit(1);
+            }
+            return;
+        }
+    }
+    memcpy(&output_buffer[output_length], data, length);
+    output_length += length;
+}
+
+void output_string(const char *str)
+{
+    output_write(str, (long)strlen(str));
+}
+
+void output_char(char c)
+{
+    if (output_length == OUTPUT_BUFFER_SIZE)
+    {
+        output_flush();
+    }
+    output_buffer[output_length++] = c;
+}
+
+void output_printf(const char *templ, ...)
+{
+    va_list ap;
+    int length;
+
+    va_start(ap, templ);
+    length = vsnprintf(&output_buffer[output_length], OUTPUT_BUFFER_SIZE - output_length, templ, ap);
+    va_end(ap);
+    if (length < 0)
+    {
+        return;
+    }
+    if (length >= OUTPUT_BUFFER_SIZE - output_length)
+    {
+        /* the result did not fit in the remaining space of the buffer */
+        output_flush();
+        va_start(ap, templ);
+        if (length < OUTPUT_BUFFER_SIZE)
+        {
+            vsnprintf(output_buffer, OUTPUT_BUFFER_SIZE, templ, ap);
+        }
+        else
+        {
+            length = 0;
+            vfprintf(ascii_output, templ, ap);
+        }
+        va_end(ap);
+    }
+    output_length += length;
+}
+
+/* print a string using the escape sequences that are shared by JSON and YAML double quoted strings */
+void output_escaped(const char *data, long length)
+{
+    static const char hex[] = "0123456789abcdef";
+    long start = 0;
+    long i;
+
+    for (i = 0; i < length; i++)
+    {
+        unsigned char c = (unsigned char)data[i];
+
+        if (c >= 32 && c <= 126 && c != '"' && c != '\\')
+        {
+            continue;
+        }
+        if (i > start)
+        {
+            output_write(&data[start], i - start);
+        }
+        start = i + 1;
+        switch (c)
+        {
+            case '\b':
+                output_write("\\b", 2);
+                break;
+            case '\f':
+                output_write("\\f", 2);
+                break;
+            case '\n':
+                output_write("\\n", 2);
+                break;
+            case '\r':
+                output_write("\\r", 2);
+                break;
+            case '\t':
+                output_write("\\t", 2);
+                break;
+            case '"':
+                output_write("\\\"", 2);
+                break;
+            case '\\':
+                output_write("\\\\", 2);
+                break;
+            default:
+                {
+                    char str[6];
+
+                    str[0] = '\\';
+                    str[1] = 'u';
+                    str[2] = '0';
+                    str[3] = '0';
+                    str[4] = hex[c >> 4];
+                    str[5] = hex[c & 0xf];
+                    output_write(str, 6);
+                }
+                break;
+        }
+    }
+    if (i > start)
+    {
+        output_write(&data[start], i - start);
+    }
+}
+
+void output_uint64(uint64_t value)
+{
+    char str[21];
+    char *s = &str[21];
+
+    do
+    {
+        *--s = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    output_write(s, (long)(&str[21] - s));
+}
+
+void output_int64(int64_t value)
+{
+    if (value < 0)
+    {
+        output_char('-');
+        output_uint64(~(uint64_t)value + 1);
+    }
+    else
+    {
+        output_uint64((uint64_t)value);
+    }
+}
+
+/* The shortest representation of a floating point value is determined using the Grisu3 algorithm (Florian Loitsch,
+ * "Printing Floating-Point Numbers Quickly and Accurately with Integers", PLDI 2010). For the small fraction of values
+ * for which Grisu3 can not guarantee that its result is the shortest, the digits are determined using printf/strtod.
+ */
+
+typedef struct diy_fp
+{
+    uint64_t f;
+    int e;
+} diy_fp;
+
+/* normalized 64-bit approximations of 10^decimal_exponent (i.e. f * 2^e with f split into a high and low part) */
+static const struct
+{
+    uint32_t f_high;
+    uint32_t f_low;
+    int e;
+    int decimal_exponent;
+} cached_powers[] = {
+    {0xfa8fd5a0, 0x081c0288, -1220, -348},
+    {0xbaaee17f, 0xa23ebf76, -1193, -340},
+    {0x8b16fb20, 0x3055ac76, -1166, -332},
+    {0xcf42894a, 0x5dce35ea, -1140, -324},
+    {0x9a6bb0aa, 0x55653b2d, -1113, -316},
+    {0xe61acf03, 0x3d1a45df, -1087, -308},
+    {0xab70fe17, 0xc79ac6ca, -1060, -300},
+    {0xff77b1fc, 0xbebcdc4f, -1034, -292},
+    {0xbe5691ef, 0x416bd60c, -1007, -284},
+    {0x8dd01fad, 0x907ffc3c, -980, -276},
+    {0xd3515c28, 0x31559a83, -954, -268},
+    {0x9d71ac8f, 0xada6c9b5, -927, -260},
+    {0xea9c2277, 0x23ee8bcb, -901, -252},
+    {0xaecc4991, 0x4078536d, -874, -244},
+    {0x823c1279, 0x5db6ce57, -847, -236},
+    {0xc2109436, 0x4dfb5637, -821, -228},
+    {0x9096ea6f, 0x3848984f, -794, -220},
+    {0xd77485cb, 0x25823ac7, -768, -212},
+    {0xa086cfcd, 0x97bf97f4, -741, -204},
+    {0xef340a98, 0x172aace5, -715, -196},
+    {0xb23867fb, 0x2a35b28e, -688, -188},
+    {0x84c8d4df, 0xd2c63f3b, -661, -180},
+    {0xc5dd4427, 0x1ad3cdba, -635, -172},
+    {0x936b9fce, 0xbb25c996, -608, -164},
+    {0xdbac6c24, 0x7d62a584, -582, -156},
+    {0xa3ab6658, 0x0d5fdaf6, -555, -148},
+    {0xf3e2f893, 0xdec3f126, -529, -140},
+    {0xb5b5ada8, 0xaaff80b8, -502, -132},
+    {0x87625f05, 0x6c7c4a8b, -475, -124},
+    {0xc9bcff60, 0x34c13053, -449, -116},
+    {0x964e858c, 0x91ba2655, -422, -108},
+    {0xdff97724, 0x70297ebd, -396, -100},
+    {0xa6dfbd9f, 0xb8e5b88f, -369, -92},
+    {0xf8a95fcf, 0x88747d94, -343, -84},
+    {0xb9447093, 0x8fa89bcf, -316, -76},
+    {0x8a08f0f8, 0xbf0f156b, -289, -68},
+    {0xcdb02555, 0x653131b6, -263, -60},
+    {0x993fe2c6, 0xd07b7fac, -236, -52},
+    {0xe45c10c4, 0x2a2b3b06, -210, -44},
+    {0xaa242499, 0x697392d3, -183, -36},
+    {0xfd87b5f2, 0x8300ca0e, -157, -28},
+    {0xbce50864, 0x92111aeb, -130, -20},
+    {0x8cbccc09, 0x6f5088cc, -103, -12},
+    {0xd1b71758, 0xe219652c, -77, -4},
+    {0x9c400000, 0x00000000, -50, 4},
+    {0xe8d4a510, 0x00000000, -24, 12},
+    {0xad78ebc5, 0xac620000, 3, 20},
+    {0x813f3978, 0xf8940984, 30, 28},
+    {0xc097ce7b, 0xc90715b3, 56, 36},
+    {0x8f7e32ce, 0x7bea5c70, 83, 44},
+    {0xd5d238a4, 0xabe98068, 109, 52},
+    {0x9f4f2726, 0x179a2245, 136, 60},
+    {0xed63a231, 0xd4c4fb27, 162, 68},
+    {0xb0de6538, 0x8cc8ada8, 189, 76},
+    {0x83c7088e, 0x1aab65db, 216, 84},
+    {0xc45d1df9, 0x42711d9a, 242, 92},
+    {0x924d692c, 0xa61be758, 269, 100},
+    {0xda01ee64, 0x1a708dea, 295, 108},
+    {0xa26da399, 0x9aef774a, 322, 116},
+    {0xf209787b, 0xb47d6b85, 348, 124},
+    {0xb454e4a1, 0x79dd1877, 375, 132},
+    {0x865b8692, 0x5b9bc5c2, 402, 140},
+    {0xc83553c5, 0xc8965d3d, 428, 148},
+    {0x952ab45c, 0xfa97a0b3, 455, 156},
+    {0xde469fbd, 0x99a05fe3, 481, 164},
+    {0xa59bc234, 0xdb398c25, 508, 172},
+    {0xf6c69a72, 0xa3989f5c, 534, 180},
+    {0xb7dcbf53, 0x54e9bece, 561, 188},
+    {0x88fcf317, 0xf22241e2, 588, 196},
+    {0xcc20ce9b, 0xd35c78a5, 614, 204},
+    {0x98165af3, 0x7b2153df, 641, 212},
+    {0xe2a0b5dc, 0x971f303a, 667, 220},
+    {0xa8d9d153, 0x5ce3b396, 694, 228},
+    {0xfb9b7cd9, 0xa4a7443c, 720, 236},
+    {0xbb764c4c, 0xa7a44410, 747, 244},
+    {0x8bab8eef, 0xb6409c1a, 774, 252},
+    {0xd01fef10, 0xa657842c, 800, 260},
+    {0x9b10a4e5, 0xe9913129, 827, 268},
+    {0xe7109bfb, 0xa19c0c9d, 853, 276},
+    {0xac2820d9, 0x623bf429, 880, 284},
+    {0x80444b5e, 0x7aa7cf85, 907, 292},
+    {0xbf21e440, 0x03acdd2d, 933, 300},
+    {0x8e679c2f, 0x5e44ff8f, 960, 308},
+    {0xd433179d, 0x9c8cb841, 986, 316},
+    {0x9e19db92, 0xb4e31ba9, 1013, 324},
+    {0xeb96bf6e, 0xbadf77d9, 1039, 332},
+    {0xaf87023b, 0x9bf0ee6b, 1066, 340}
+};
+
+#define NUM_CACHED_POWERS ((int)(sizeof(cached_powers) / sizeof(cached_powers[0])))
+
+/* range for the binary exponent of the scaled value, such that the integral part fits in 32 bits */
+#define GRISU_MIN_EXPONENT (-60)
+#define GRISU_MAX_EXPONENT (-32)
+
+#define MAX_NUM_DIGITS 18
+
+static diy_fp diy_fp_normalize(diy_fp x)
+{
+    while ((x.f >> 54) == 0)
+    {
+        x.f <<= 10;
+        x.e -= 10;
+    }
+    while ((x.f >> 63) == 0)
+    {
+        x.f <<= 1;
+        x.e--;
+    }
+    return x;
+}
+
+static diy_fp diy_fp_multiply(diy_fp x, diy_fp y)
+{
+    uint64_t mask32 = 0xffffffff;
+    uint64_t a = x.f >> 32;
+    uint64_t b = x.f & mask32;
+    uint64_t c = y.f >> 32;
+    uint64_t d = y.f & mask32;
+    uint64_t ac = a * c;
+    uint64_t bc = b * c;
+    uint64_t ad = a * d;
+    uint64_t bd = b * d;
+    uint64_t tmp;
+    diy_fp result;
+
+    tmp = (bd >> 32) + (ad & mask32) + (bc & mask32);
+    tmp += (uint64_t)1 << 31;   /* round */
+    result.f = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
+    result.e = x.e + y.e + 64;
+
+    return result;
+}
+
+/* get the cached power c for which GRISU_MIN_EXPONENT <= e + c.e + 64 <= GRISU_MAX_EXPONENT */
+static diy_fp get_cached_power(int e, int *decimal_exponent)
+{
+    diy_fp c;
+    int index;
+
+    /* estimate the index (0.30103 ~= log10(2)), the loops below correct for any rounding */
+    index = (int)(((GRISU_MIN_EXPONENT + GRISU_MAX_EXPONENT) / 2 - (e + 64) + 63) * 0.30102999566398114 + 348) / 8;
+    if (index < 0)
+    {
+        index = 0;
+    }
+    if (index >= NUM_CACHED_POWERS)
+    {
+        index = NUM_CACHED_POWERS - 1;
+    }
+    while (index < NUM_CACHED_POWERS - 1 && e + cached_powers[index].e + 64 < GRISU_MIN_EXPONENT)
+    {
+        index++;
+    }
+    while (index > 0 && e + cached_powers[index].e + 64 > GRISU_MAX_EXPONENT)
+    {
+        index--;
+    }
+    c.f = ((uint64_t)cached_powers[index].f_high << 32) | cached_powers[index].f_low;
+    c.e = cached_powers[index].e;
+    *decimal_exponent = cached_powers[index].decimal_exponent;
+
+    return c;
+}
+
+/* Adjust the last digit such that the result is as close as possible to the exact value.
+ * Returns 1 if the result is guaranteed to be the shortest correct representation, 0 otherwise.
+ */
+static int round_weed(char *digits, int num_digits, uint64_t distance_too_high_w, uint64_t unsafe_interval,
+                      uint64_t rest, uint64_t ten_kappa, uint64_t unit)
+{
+    uint64_t small_distance = distance_too_high_w - unit;
+    uint64_t big_distance = distance_too_high_w + unit;
+
+    while (rest < small_distance && unsafe_interval - rest >= ten_kappa &&
+           (rest + ten_kappa < small_distance || small_distance - rest >= rest + ten_kappa - small_distance))
+    {
+        digits[num_digits - 1]--;
+        rest += ten_kappa;
+    }
+    if (rest < big_distance && unsafe_interval - rest >= ten_kappa &&
+        (rest + ten_kappa < big_distance || big_distance - rest > rest + ten_kappa - big_distance))
+    {
+        return 0;
+    }
+    return 2 * unit <= rest && rest <= unsafe_interval - 4 * unit;
+}
+
+/* generate the shortest digits for w that lie within the (scaled) boundaries low and high */
+static int digit_gen(diy_fp low, diy_fp w, diy_fp high, char *digits, int *num_digits, int *kappa)
+{
+    static const uint32_t powers_of_ten[] = {
+        0, 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+    };
+    uint64_t unit = 1;
+    uint64_t too_low = low.f - unit;
+    uint64_t too_high = high.f + unit;
+    uint64_t unsafe_interval = too_high - too_low;
+    uint64_t one = (uint64_t)1 << -w.e;
+    uint32_t integrals = (uint32_t)(too_high >> -w.e);
+    uint64_t fractionals = too_high & (one - 1);
+    uint32_t divisor;
+    int i;
+
+    i = 10;
+    while (integrals < powers_of_ten[i])
+    {
+        i--;
+    }
+    divisor = powers_of_ten[i];
+    *kappa = i;
+    *num_digits = 0;
+    while (*kappa > 0)
+    {
+        uint64_t rest;
+
+        digits[(*num_digits)++] = (char)('0' + integrals / divisor);
+        integrals %= divisor;
+        (*kappa)--;
+        rest = ((uint64_t)integrals << -w.e) + fractionals;
+        if (rest < unsafe_interval)
+        {
+            return round_weed(digits, *num_digits, too_high - w.f, unsafe_interval, rest,
+                              (uint64_t)divisor << -w.e, unit);
+        }
+        divisor /= 10;
+    }
+    while (*num_digits < MAX_NUM_DIGITS)
+    {
+        fractionals *= 10;
+        unit *= 10;
+        unsafe_interval *= 10;
+        digits[(*num_digits)++] = (char)('0' + (fractionals >> -w.e));
+        fractionals &= one - 1;
+        (*kappa)--;
+        if (fractionals < unsafe_interval)
+        {
+            return round_weed(digits, *num_digits, (too_high - w.f) * unit, unsafe_interval, fractionals, one, unit);
+        }
+    }
+    return 0;
+}
+
+/* determine the shortest digits for a positive value using Grisu3 (returns 0 if this was not possible) */
+static int grisu3(double value, int is_float, char *digits, int *num_digits, int *exponent)
+{
+    diy_fp w, low, high, c;
+    int lower_boundary_is_closer;
+    int decimal_exponent;
+    int kappa;
+
+    if (is_float)
+    {
+        float float_value = (float)value;
+        uint32_t bits;
+        int biased_exponent;
+
+        memcpy(&bits, &float_value, sizeof(bits));
+        biased_exponent = (int)((bits >> 23) & 0xff);
+        w.f = bits & 0x7fffff;
+        if (biased_exponent != 0)
+        {
+            w.f += 0x800000;
+            w.e = biased_exponent - 150;
+        }
+        else
+        {
+            w.e = -149;
+        }
+        lower_boundary_is_closer = ((bits & 0x7fffff) == 0 && biased_exponent > 1);
+    }
+    else
+    {
+        uint64_t bits;
+        uint64_t significand_mask = ((uint64_t)1 << 52) - 1;
+        int biased_exponent;
+
+        memcpy(&bits, &value, sizeof(bits));
+        biased_exponent = (int)((bits >> 52) & 0x7ff);
+        w.f = bits & significand_mask;
+        if (biased_exponent != 0)
+        {
+            w.f += (uint64_t)1 << 52;
+            w.e = biased_exponent - 1075;
+        }
+        else
+        {
+            w.e = -1074;
+        }
+        lower_boundary_is_closer = ((bits & significand_mask) == 0 && biased_exponent > 1);
+    }
+
+    /* the boundaries are halfway between the value and its neighbours */
+    high.f = (w.f << 1) + 1;
+    high.e = w.e - 1;
+    high = diy_fp_normalize(high);
+    if (lower_boundary_is_closer)
+    {
+        low.f = (w.f << 2) - 1;
+        low.e = w.e - 2;
+    }
+    else
+    {
+        low.f = (w.f << 1) - 1;
+        low.e = w.e - 1;
+    }
+    low.f <<= low.e - high.e;
+    low.e = high.e;
+    w = diy_fp_normalize(w);
+
+    c = get_cached_power(w.e, &decimal_exponent);
+    if (!digit_gen(diy_fp_multiply(low, c), diy_fp_multiply(w, c), diy_fp_multiply(high, c), digits, num_digits,
+                   &kappa))
+    {
+        return 0;
+    }
+    *exponent = *num_digits - 1 + kappa - decimal_exponent;
+
+    return 1;
+}
+
+/* determine the shortest digits for a positive value using printf and strtod
+ * (the digits for each precision are taken from printf itself, such that they are the correctly rounded digits of
+ * the value; rounding the digits of a higher precision would round twice and could end up one digit off)
+ */
+static void get_round_trip_digits(double value, int is_float, char *digits, int *num_digits, int *exponent)
+{
+    int max_precision = is_float ? 9 : 17;
+    char str[32];
+    char *exponent_str;
+    int precision;
+
+    for (precision = 1; precision < max_precision; precision++)
+    {
+        double result;
+
+        sprintf(str, "%.*e", precision - 1, value);
+        result = strtod(str, NULL);
+        if (is_float ? (float)result == (float)value : result == value)
+        {
+            break;
+        }
+    }
+    if (precision == max_precision)
+    {
+        sprintf(str, "%.*e", precision - 1, value);
+    }
+
+    digits[0] = str[0];
+    if (precision > 1)
+    {
+        memcpy(&digits[1], &str[2], precision - 1);
+    }
+    exponent_str = strchr(str, 'e');
+    assert(exponent_str != NULL);
+    *exponent = atoi(&exponent_str[1]);
+    *num_digits = precision;
+}
+
+/* Print a floating point value using the least number of significant digits that still converts back to the same
+ * value. The notation (fixed or exponential) is chosen in the same way as printf does with "%.<exponent_limit>g".
+ */
+static void output_real(double value, int is_float)
+{
+    int exponent_limit = is_float ? 7 : 16;
+    double limit = is_float ? 1e7 : 1e16;
+    char digits[MAX_NUM_DIGITS];
+    int num_digits;
+    int exponent;
+    int i;
+
+    if (coda_isNaN(value) || coda_isInf(value))
+    {
+        output_printf(is_float ? "%.7g" : "%.16g", value);
+        return;
+    }
+    if (value > -limit && value < limit && value == (double)(int64_t)value)
+    {
+        /* integral values are printed without any formatting overhead */
+        if (value == 0)
+        {
+            /* preserve the sign of negative zero */
+            output_string((1 / value) < 0 ? "-0" : "0");
+        }
+        else
+        {
+            output_int64((int64_t)value);
+        }
+        return;
+    }
+
+    if (value < 0)
+    {
+        output_char('-');
+        value = -value;
+    }
+    if (!grisu3(value, is_float, digits, &num_digits, &exponent))
+    {
+        get_round_trip_digits(value, is_float, digits, &num_digits, &exponent);
+    }
+    while (num_digits > 1 && digits[num_digits - 1] == '0')
+    {
+        num_digits--;
+    }
+
+    if (exponent < -4 || exponent >= exponent_limit)
+    {
+        output_char(digits[0]);
+        if (num_digits > 1)
+        {
+            output_char('.');
+            output_write(&digits[1], num_digits - 1);
+        }
+        output_char('e');
+        output_char(exponent < 0 ? '-' : '+');
+        if (exponent < 0)
+        {
+            exponent = -exponent;
+        }
+        if (exponent < 10)
+        {
+            output_char('0');
+        }
+        output_int64(exponent);
+    }
+    else if (exponent >= 0)
+    {
+        if (num_digits <= exponent + 1)
+        {
+            output_write(digits, num_digits);
+            for (i = num_digits; i <= exponent; i++)
+            {
+                output_char('0');
+            }
+        }
+        else
+        {
+            output_write(digits, exponent + 1);
+            output_char('.');
+            output_write(&digits[exponent + 1], num_digits - exponent - 1);
+        }
+    }
+    else
+    {
+        output_write("0.", 2);
+        for (i = exponent + 1; i < 0; i++)
+        {
+            output_char('0');
+        }
+        output_write(digits, num_digits);
+    }
+}
+
+void output_double(double value)
+{
+    output_real(value, 0);
+}
+
+void output_float(double value)
+{
+    output_real(value, 1);
+}
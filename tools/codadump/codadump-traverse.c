@@ -288,6 +288,10 @@ static void handle_data_element()
         export_data_element_to_hdf4();
     }
 #endif
+    else if (run_mode == RUN_MODE_COLUMN)
+    {
+        export_data_element_to_column();
+    }
 }
 
 /* If the user explicitly asks for traversal of a hidden record field,
@@ -572,6 +576,10 @@ void traverse_product()
     {
         handle_coda_error();
     }
+    if (coda_set_product_access_pattern(traverse_info.pf, coda_access_pattern_sequential) != 0)
+    {
+        handle_coda_error();
+    }
     if (coda_cursor_set_product(&traverse_info.cursor, traverse_info.pf) != 0)
     {
         handle_coda_error();
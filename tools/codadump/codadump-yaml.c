@@ -31,7 +31,7 @@
 
 #include "codadump.h"
 
-#include <stdarg.h>
+#define MAX_BULK_READ_ELEMENTS 65536
 
 static int INDENT = 0;
 
@@ -44,79 +44,134 @@ static void indent(void)
     assert(INDENT >= 0);
     for (i = INDENT; i > 0; i--)
     {
-        fprintf(ascii_output, "  ");
+        output_write("  ", 2);
     }
 }
 
-static int ff_printf(const char *templ, ...)
-{
-    int result;
-    va_list ap;
-
-    va_start(ap, templ);
-    result = vfprintf(ascii_output, templ, ap);
-    va_end(ap);
-
-    return result;
-}
-
-static int fi_printf(const char *templ, ...)
-{
-    int result;
-    va_list ap;
-
-    indent();
-
-    va_start(ap, templ);
-    result = vfprintf(ascii_output, templ, ap);
-    va_end(ap);
-
-    return result;
-}
-
-static void print_escaped(const char *data, long length)
+/* print an array of numbers using bulk reads of the array elements
+ * returns 1 if the array was printed and 0 if the elements need to be printed individually
+ */
+static int print_numeric_array(coda_cursor *cursor, long num_elements)
 {
+    coda_native_type read_type;
+    coda_type_class type_class;
+    coda_type *type;
+    void *data;
+    long length;
+    long offset;
     long i;
 
-    for (i = 0; i < length; i++)
+    if (coda_cursor_get_type(cursor, &type) != 0)
     {
-        char c;
+        handle_coda_error();
+    }
+    if (coda_type_get_array_base_type(type, &type) != 0)
+    {
+        handle_coda_error();
+    }
+    if (coda_type_get_class(type, &type_class) != 0)
+    {
+        handle_coda_error();
+    }
+    if (type_class != coda_integer_class && type_class != coda_real_class)
+    {
+        return 0;
+    }
+    if (show_attributes)
+    {
+        int has_attributes;
 
-        c = data[i];
-        switch (c)
+        if (coda_type_has_attributes(type, &has_attributes) != 0)
         {
-            case '\b':
-                ff_printf("\\b");
-                break;
-            case '\f':
-                ff_printf("\\f");
-                break;
-            case '\n':
-                ff_printf("\\n");
-                break;
-            case '\r':
-                ff_printf("\\r");
-                break;
-            case '\t':
-                ff_printf("\\t");
-                break;
-            case '"':
-                ff_printf("\\\"");
+            handle_coda_error();
+        }
+        if (has_attributes)
+        {
+            return 0;
+        }
+    }
+    if (coda_type_get_read_type(type, &read_type) != 0)
+    {
+        handle_coda_error();
+    }
+    if (read_type == coda_native_type_not_available)
+    {
+        return 0;
+    }
+
+    length = (num_elements < MAX_BULK_READ_ELEMENTS ? num_elements : MAX_BULK_READ_ELEMENTS);
+    data = malloc(length * sizeof(double));
+    if (data == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(length * sizeof(double)), __FILE__, __LINE__);
+        handle_coda_error();
+    }
+    for (offset = 0; offset < num_elements; offset += length)
+    {
+        if (offset + length > num_elements)
+        {
+            length = num_elements - offset;
+        }
+        switch (read_type)
+        {
+            case coda_native_type_int8:
+            case coda_native_type_int16:
+            case coda_native_type_int32:
+            case coda_native_type_int64:
+                if (coda_cursor_read_int64_partial_array(cursor, offset, length, (int64_t *)data) != 0)
+                {
+                    handle_coda_error();
+                }
+                for (i = 0; i < length; i++)
+                {
+                    indent();
+                    output_write("- ", 2);
+                    output_int64(((int64_t *)data)[i]);
+                    output_char('\n');
+                }
                 break;
-            case '\\':
-                ff_printf("\\\\");
+            case coda_native_type_uint8:
+            case coda_native_type_uint16:
+            case coda_native_type_uint32:
+            case coda_native_type_uint64:
+                if (coda_cursor_read_uint64_partial_array(cursor, offset, length, (uint64_t *)data) != 0)
+                {
+                    handle_coda_error();
+                }
+                for (i = 0; i < length; i++)
+                {
+                    indent();
+                    output_write("- ", 2);
+                    output_uint64(((uint64_t *)data)[i]);
+                    output_char('\n');
+                }
                 break;
             default:
-                if (c >= 32 && c <= 126)
+                if (coda_cursor_read_double_partial_array(cursor, offset, length, (double *)data) != 0)
                 {
-                    ff_printf("%c", c);
+                    handle_coda_error();
                 }
-                else
+                for (i = 0; i < length; i++)
                 {
-                    ff_printf("\\u%02x", (int)(unsigned char)c);
+                    indent();
+                    output_write("- ", 2);
+                    if (read_type == coda_native_type_float)
+                    {
+                        output_float(((double *)data)[i]);
+                    }
+                    else
+                    {
+                        output_double(((double *)data)[i]);
+                    }
+                    output_char('\n');
                 }
+                break;
         }
     }
+    free(data);
+
+    return 1;
 }
 
 static void print_data(coda_cursor *cursor, int compound_newline)
@@ -134,10 +189,10 @@ static void print_data(coda_cursor *cursor, int compound_newline)
         {
             if (compound_newline)
             {
-                ff_printf("\n");
+                output_char('\n');
                 indent();
             }
-            ff_printf("attr: ");
+            output_string("attr: ");
             if (coda_cursor_goto_attributes(cursor) != 0)
             {
                 handle_coda_error();
@@ -146,7 +201,8 @@ static void print_data(coda_cursor *cursor, int compound_newline)
             print_data(cursor, 1);
             INDENT--;
             coda_cursor_goto_parent(cursor);
-            fi_printf("data: ");
+            indent();
+            output_string("data: ");
             INDENT++;
         }
     }
@@ -174,7 +230,7 @@ static void print_data(coda_cursor *cursor, int compound_newline)
 
                     if (compound_newline)
                     {
-                        ff_printf("\n");
+                        output_char('\n');
                     }
                     if (coda_cursor_get_type(cursor, &record_type) != 0)
                     {
@@ -205,7 +261,8 @@ static void print_data(coda_cursor *cursor, int compound_newline)
                         {
                             indent();
                         }
-                        ff_printf("%s: ", field_name);
+                        output_string(field_name);
+                        output_write(": ", 2);
                         INDENT++;
                         print_data(cursor, 1);
                         INDENT--;
@@ -242,7 +299,8 @@ static void print_data(coda_cursor *cursor, int compound_newline)
                                 {
                                     first_field = 0;
                                 }
-                                ff_printf("%s: ", field_name);
+                                output_string(field_name);
+                                output_write(": ", 2);
                                 INDENT++;
                                 print_data(cursor, 1);
                                 INDENT--;
@@ -260,7 +318,7 @@ static void print_data(coda_cursor *cursor, int compound_newline)
                 }
                 else
                 {
-                    ff_printf("{}\n");
+                    output_string("{}\n");
                 }
             }
             break;
@@ -285,35 +343,39 @@ static void print_data(coda_cursor *cursor, int compound_newline)
                     }
                     if (num_elements > 0)
                     {
-                        ff_printf("\n");
-                        if (coda_cursor_goto_first_array_element(cursor) != 0)
+                        output_char('\n');
+                        if (!print_numeric_array(cursor, num_elements))
                         {
-                            handle_coda_error();
-                        }
-                        for (i = 0; i < num_elements; i++)
-                        {
-                            fi_printf("- ");
-                            INDENT++;
-                            print_data(cursor, 0);
-                            INDENT--;
-                            if (i < num_elements - 1)
+                            if (coda_cursor_goto_first_array_element(cursor) != 0)
                             {
-                                if (coda_cursor_goto_next_array_element(cursor) != 0)
+                                handle_coda_error();
+                            }
+                            for (i = 0; i < num_elements; i++)
+                            {
+                                indent();
+                                output_write("- ", 2);
+                                INDENT++;
+                                print_data(cursor, 0);
+                                INDENT--;
+                                if (i < num_elements - 1)
                                 {
-                                    handle_coda_error();
+                                    if (coda_cursor_goto_next_array_element(cursor) != 0)
+                                    {
+                                        handle_coda_error();
+                                    }
                                 }
                             }
+                            coda_cursor_goto_parent(cursor);
                         }
-                        coda_cursor_goto_parent(cursor);
                     }
                     else
                     {
-                        ff_printf("[]\n");
+                        output_string("[]\n");
                     }
                 }
                 else
                 {
-                    ff_printf("[]\n");
+                    output_string("[]\n");
                 }
             }
             break;
@@ -339,9 +401,9 @@ static void print_data(coda_cursor *cursor, int compound_newline)
                                 handle_coda_error();
                             }
 
-                            ff_printf("\"");
-                            print_escaped(&data, 1);
-                            ff_printf("\"\n");
+                            output_char('"');
+                            output_escaped(&data, 1);
+                            output_string("\"\n");
                         }
                         break;
                     case coda_native_type_string:
@@ -366,9 +428,9 @@ static void print_data(coda_cursor *cursor, int compound_newline)
                                 handle_coda_error();
                             }
 
-                            ff_printf("\"");
-                            print_escaped(data, length);
-                            ff_printf("\"\n", length);
+                            output_char('"');
+                            output_escaped(data, length);
+                            output_string("\"\n");
 
                             free(data);
                         }
@@ -397,9 +459,9 @@ static void print_data(coda_cursor *cursor, int compound_newline)
                                 handle_coda_error();
                             }
 
-                            ff_printf("\"");
-                            print_escaped((char *)data, (long)byte_size);
-                            ff_printf("\"\n");
+                            output_char('"');
+                            output_escaped((char *)data, (long)byte_size);
+                            output_string("\"\n");
 
                             free(data);
                         }
@@ -415,7 +477,8 @@ static void print_data(coda_cursor *cursor, int compound_newline)
                                 handle_coda_error();
                             }
 
-                            ff_printf("%ld\n", (long)data);
+                            output_int64(data);
+                            output_char('\n');
                         }
                         break;
                     case coda_native_type_uint8:
@@ -429,35 +492,34 @@ static void print_data(coda_cursor *cursor, int compound_newline)
                                 handle_coda_error();
                             }
 
-                            ff_printf("%lu\n", (unsigned long)data);
+                            output_uint64(data);
+                            output_char('\n');
                         }
                         break;
                     case coda_native_type_int64:
                         {
                             int64_t data;
-                            char s[21];
 
                             if (coda_cursor_read_int64(cursor, &data) != 0)
                             {
                                 handle_coda_error();
                             }
 
-                            coda_str64(data, s);
-                            ff_printf("%s\n", s);
+                            output_int64(data);
+                            output_char('\n');
                         }
                         break;
                     case coda_native_type_uint64:
                         {
                             uint64_t data;
-                            char s[21];
 
                             if (coda_cursor_read_uint64(cursor, &data) != 0)
                             {
                                 handle_coda_error();
                             }
 
-                            coda_str64u(data, s);
-                            ff_printf("%s\n", s);
+                            output_uint64(data);
+                            output_char('\n');
                         }
                         break;
                     case coda_native_type_float:
@@ -472,16 +534,18 @@ static void print_data(coda_cursor *cursor, int compound_newline)
 
                             if (read_type == coda_native_type_float)
                             {
-                                ff_printf("%.7g\n", data);
+                                output_float(data);
+                                output_char('\n');
                             }
                             else
                             {
-                                ff_printf("%.16g\n", data);
+                                output_double(data);
+                                output_char('\n');
                             }
                         }
                         break;
                     case coda_native_type_not_available:
-                        ff_printf("null\n");
+                        output_string("null\n");
                         break;
                 }
             }
@@ -498,7 +562,7 @@ static void print_data(coda_cursor *cursor, int compound_newline)
                 switch (special_type)
                 {
                     case coda_special_no_data:
-                        ff_printf("null\n");
+                        output_string("null\n");
                         break;
                     case coda_special_vsf_integer:
                         {
@@ -509,7 +573,8 @@ static void print_data(coda_cursor *cursor, int compound_newline)
                                 handle_coda_error();
                             }
 
-                            ff_printf("%.16g\n", data);
+                            output_double(data);
+                            output_char('\n');
                         }
                         break;
                     case coda_special_time:
@@ -523,17 +588,19 @@ static void print_data(coda_cursor *cursor, int compound_newline)
                             }
                             if (coda_isNaN(data) || coda_isInf(data))
                             {
-                                ff_printf("%.16g\n", data);
+                                output_double(data);
+                                output_char('\n');
                             }
                             else
                             {
                                 if (coda_time_double_to_string(data, "yyyy-MM-dd'T'HH:mm:ss.SSSSSS", str) != 0)
                                 {
-                                    ff_printf("\"{--invalid time value--}\"");
+                                    output_string("\"{--invalid time value--}\"\n");
                                 }
                                 else
                                 {
-                                    ff_printf("%s\n", str);
+                                    output_string(str);
+                                    output_char('\n');
                                 }
                             }
                         }
@@ -547,7 +614,7 @@ static void print_data(coda_cursor *cursor, int compound_newline)
                                 handle_coda_error();
                             }
 
-                            ff_printf("%g + %gi\n", re, im);
+                            output_printf("%g + %gi\n", re, im);
                         }
                         break;
                 }
@@ -583,6 +650,14 @@ void print_yaml_data(int include_attributes)
     {
         handle_coda_error();
     }
+    if (starting_path == NULL)
+    {
+        /* the full product will be dumped from start to end */
+        if (coda_set_product_access_pattern(pf, coda_access_pattern_sequential) != 0)
+        {
+            handle_coda_error();
+        }
+    }
 
     if (coda_cursor_set_product(&cursor, pf) != 0)
     {
@@ -599,6 +674,7 @@ void print_yaml_data(int include_attributes)
 
     coda_set_option_perform_boundary_checks(0);
     print_data(&cursor, 0);
+    output_flush();
 
     coda_close(pf);
 }
@@ -39,6 +39,7 @@ traverse_info_t traverse_info;
 hdf4_info_t hdf4_info;
 #endif
 char *ascii_col_sep;
+int ascii_num_threads;
 FILE *ascii_output;
 char *output_file_name;
 char *starting_path;
@@ -96,6 +97,12 @@ static void print_help()
     printf("                    restrict the output to data that matches the filter\n");
     printf("            -i, --index\n");
     printf("                    print the array index for each array element\n");
+#ifdef HAVE_PTHREAD
+    printf("            -j, --threads <number of threads>\n");
+    printf("                    format the data using the given number of threads;\n");
+    printf("                    the outermost array of each data element is split\n");
+    printf("                    into chunks that are formatted in parallel (default: 1)\n");
+#endif
     printf("            -l, --label\n");
     printf("                    print the full name and array dims for each data block\n");
     printf("            -o, --output <filename>\n");
@@ -129,6 +136,24 @@ static void print_help()
     printf("                    base type\n");
     printf("\n");
 #endif
+    printf("    codadump [-D definitionpath] column [<column options>] <product file>\n");
+    printf("        Export each data element of a product file as a column of raw binary\n");
+    printf("        values (little endian) and write a JSON schema describing the columns\n");
+    printf("        Column options:\n");
+    printf("            -d, --disable_conversions\n");
+    printf("                    do not perform unit/value conversions\n");
+    printf("            -f '<filter expression>', --filter '<filter expression>'\n");
+    printf("                    restrict the output to data that matches the filter\n");
+    printf("            -o, --output <directory>\n");
+    printf("                    write output to specified directory\n");
+    printf("                    (default: <product file>.columns)\n");
+    printf("            -s, --silent\n");
+    printf("                    run in silent mode\n");
+    printf("            --no_special_types\n");
+    printf("                    bypass special data types from the CODA format definition -\n");
+    printf("                    data with a special type is treated using its non-special\n");
+    printf("                    base type\n");
+    printf("\n");
     printf("    codadump [-D definitionpath] json [<json options>] <product file>\n");
     printf("        Write the contents of a product file to a JSON file\n");
     printf("        JSON options:\n");
@@ -142,6 +167,10 @@ static void print_help()
     printf("            -p, --path <path>\n");
     printf("                    path (in the form of a CODA node expression) to the\n");
     printf("                    location in the product where the operation should begin\n");
+    printf("            --ndjson\n");
+    printf("                    if the data is an array, write each array element as a\n");
+    printf("                    separate JSON value on its own line (newline delimited\n");
+    printf("                    JSON) instead of writing a single JSON array\n");
     printf("            --no_special_types\n");
     printf("                    bypass special data types from the CODA format definition -\n");
     printf("                    data with a special type is treated using its non-special\n");
@@ -203,6 +232,7 @@ static void print_help()
 
 void handle_coda_error()
 {
+    output_flush();
     fprintf(stderr, "ERROR: %s\n", coda_errno_to_string(coda_errno));
     fflush(stderr);
     exit(1);
@@ -315,6 +345,7 @@ static void handle_ascii_run_mode(int argc, char *argv[])
     traverse_info.filter[0] = NULL;
     output_file_name = NULL;
     ascii_col_sep = " ";
+    ascii_num_threads = 1;
     ascii_output = stdout;
     verbosity = 1;
     calc_dim = 1;
@@ -347,6 +378,19 @@ static void handle_ascii_run_mode(int argc, char *argv[])
         {
             show_index = 1;
         }
+#ifdef HAVE_PTHREAD
+        else if ((strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "--threads") == 0) &&
+                 i + 1 < argc && argv[i + 1][0] != '-')
+        {
+            if (sscanf(argv[i + 1], "%d", &ascii_num_threads) != 1 || ascii_num_threads < 1)
+            {
+                fprintf(stderr, "ERROR: invalid number of threads\n");
+                print_help();
+                exit(1);
+            }
+            i++;
+        }
+#endif
         else if (strcmp(argv[i], "-l") == 0 || strcmp(argv[i], "--label") == 0)
         {
             show_label = 1;
@@ -404,6 +448,7 @@ static void handle_ascii_run_mode(int argc, char *argv[])
     coda_set_option_perform_conversions(perform_conversions);
     traverse_info_init();
     dim_info_init();
+    ascii_info_init();
     if (output_file_name != NULL)
     {
         ascii_output = fopen(output_file_name, "w");
@@ -420,6 +465,7 @@ static void handle_ascii_run_mode(int argc, char *argv[])
     {
         fclose(ascii_output);
     }
+    ascii_info_done();
     dim_info_done();
     traverse_info_done();
     coda_done();
@@ -538,11 +584,123 @@ static void handle_hdf4_run_mode(int argc, char *argv[])
 }
 #endif
 
+static void handle_column_run_mode(int argc, char *argv[])
+{
+    int own_output_file_name = 0;
+    int use_special_types;
+    int perform_conversions;
+    int i;
+
+    traverse_info.file_name = NULL;
+    traverse_info.filter[0] = NULL;
+    output_file_name = NULL;
+    verbosity = 1;
+    calc_dim = 1;
+    use_special_types = 1;
+    perform_conversions = 1;
+
+    for (i = 0; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-d") == 0 || strcmp(argv[i], "--disable_conversions") == 0)
+        {
+            perform_conversions = 0;
+        }
+        else if ((strcmp(argv[i], "-f") == 0 || strcmp(argv[i], "--filter") == 0) &&
+                 i + 1 < argc && argv[i + 1][0] != '-')
+        {
+            traverse_info.filter[0] = codadump_filter_create(argv[i + 1]);
+            if (traverse_info.filter[0] == NULL)
+            {
+                fprintf(stderr, "ERROR: incorrect filter or empty filter\n");
+                print_help();
+                exit(1);
+            }
+            i++;
+        }
+        else if ((strcmp(argv[i], "-o") == 0 || strcmp(argv[i], "--output") == 0) &&
+                 i + 1 < argc && argv[i + 1][0] != '-')
+        {
+            output_file_name = argv[i + 1];
+            i++;
+        }
+        else if (strcmp(argv[i], "-s") == 0 || strcmp(argv[i], "--silent") == 0)
+        {
+            verbosity = 0;
+        }
+        else if (strcmp(argv[i], "--no_special_types") == 0)
+        {
+            use_special_types = 0;
+        }
+        else if (i == argc - 1 && argv[i][0] != '-')
+        {
+            traverse_info.file_name = argv[i];
+        }
+        else
+        {
+            fprintf(stderr, "ERROR: invalid arguments\n");
+            print_help();
+            exit(1);
+        }
+    }
+
+    if (traverse_info.file_name == NULL)
+    {
+        fprintf(stderr, "ERROR: invalid arguments\n");
+        print_help();
+        exit(1);
+    }
+
+    if (output_file_name == NULL)
+    {
+        own_output_file_name = 1;
+        output_file_name = malloc(strlen(traverse_info.file_name) + 9);
+        if (output_file_name == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           strlen(traverse_info.file_name) + 9, __FILE__, __LINE__);
+            handle_coda_error();
+        }
+        sprintf(output_file_name, "%s.columns", traverse_info.file_name);
+    }
+
+    if ((traverse_info.file_name[0] == '\0') || (output_file_name[0] == '\0'))
+    {
+        fprintf(stderr, "ERROR: invalid arguments\n");
+        print_help();
+        exit(1);
+    }
+
+    if (coda_init() != 0)
+    {
+        fprintf(stderr, "ERROR: %s\n", coda_errno_to_string(coda_errno));
+        exit(1);
+    }
+    coda_set_option_bypass_special_types(!use_special_types);
+    coda_set_option_perform_boundary_checks(0);
+    coda_set_option_perform_conversions(perform_conversions);
+    traverse_info_init();
+    dim_info_init();
+    column_info_init();
+
+    traverse_product();
+
+    column_info_done();
+    dim_info_done();
+    traverse_info_done();
+    coda_done();
+
+    if (own_output_file_name)
+    {
+        free(output_file_name);
+    }
+}
+
 static void handle_json_run_mode(int argc, char *argv[])
 {
     int use_special_types;
     int perform_conversions;
     int include_attributes;
+    int ndjson;
     int i;
 
     traverse_info.file_name = NULL;
@@ -552,6 +710,7 @@ static void handle_json_run_mode(int argc, char *argv[])
     use_special_types = 1;
     perform_conversions = 1;
     include_attributes = 0;
+    ndjson = 0;
 
     for (i = 0; i < argc; i++)
     {
@@ -575,6 +734,10 @@ static void handle_json_run_mode(int argc, char *argv[])
             starting_path = argv[i + 1];
             i++;
         }
+        else if (strcmp(argv[i], "--ndjson") == 0)
+        {
+            ndjson = 1;
+        }
         else if (strcmp(argv[i], "--no_special_types") == 0)
         {
             use_special_types = 0;
@@ -615,7 +778,7 @@ static void handle_json_run_mode(int argc, char *argv[])
         }
     }
 
-    print_json_data(include_attributes);
+    print_json_data(include_attributes, ndjson);
 
     if (output_file_name != NULL)
     {
@@ -856,6 +1019,12 @@ int main(int argc, char *argv[])
         handle_hdf4_run_mode(argc - i, &argv[i]);
     }
 #endif
+    else if (strcmp(argv[i], "column") == 0)
+    {
+        run_mode = RUN_MODE_COLUMN;
+        i++;
+        handle_column_run_mode(argc - i, &argv[i]);
+    }
     else if (strcmp(argv[i], "json") == 0)
     {
         run_mode = RUN_MODE_JSON;
@@ -58,6 +58,7 @@ typedef enum run_mode
     RUN_MODE_LIST,
     RUN_MODE_ASCII,
     RUN_MODE_HDF4,
+    RUN_MODE_COLUMN,
     RUN_MODE_JSON,
     RUN_MODE_YAML,
     RUN_MODE_DEBUG
@@ -65,6 +66,7 @@ typedef enum run_mode
 
 extern run_mode_t run_mode;
 extern char *ascii_col_sep;
+extern int ascii_num_threads;
 extern FILE *ascii_output;
 extern char *output_file_name;
 extern char *starting_path;
@@ -166,9 +168,28 @@ extern hdf4_info_t hdf4_info;
 /* codadump.c functions */
 void handle_coda_error();
 
+/* codadump-output.c functions */
+void output_flush();
+void output_write(const char *data, long length);
+void output_string(const char *str);
+void output_char(char c);
+void output_printf(const char *templ, ...);
+void output_escaped(const char *data, long length);
+void output_int64(int64_t value);
+void output_uint64(uint64_t value);
+void output_double(double value);
+void output_float(double value);
+
 /* codadump-ascii.c functions */
+void ascii_info_init();
+void ascii_info_done();
 void export_data_element_to_ascii();
 
+/* codadump-column.c functions */
+void column_info_init();
+void column_info_done();
+void export_data_element_to_column();
+
 /* codadump-dim.c functions */
 void print_all_distinct_dims(int dim_id);
 void dim_info_init();
@@ -191,7 +212,7 @@ void export_data_element_to_hdf4();
 #endif
 
 /* codadump-json.c functions */
-void print_json_data(int include_attributes);
+void print_json_data(int include_attributes, int ndjson);
 
 /* codadump-yaml.c functions */
 void print_yaml_data(int include_attributes);
@@ -39,6 +39,14 @@
 #include <string.h>
 
 #include "coda.h"
+#ifndef WIN32
+#include "workerpool.h"
+
+/* internal CODA functions */
+int coda_filefilter_walk(int num_filepaths, const char **filepathlist, int (*filefunc) (const char *, void *),
+                         int (*callbackfunc) (const char *, coda_filefilter_status, const char *, void *),
+                         void *userdata);
+#endif
 
 static int verbosity;
 
@@ -63,6 +71,10 @@ static void print_help()
     printf("                    restrict the output to data that matches the filter\n");
     printf("                    if no filter is provided codafind will find all files that\n");
     printf("                    can be opened with CODA\n");
+    printf("            -j, --jobs <n>\n");
+    printf("                    open and match up to <n> files in parallel using separate\n");
+    printf("                    worker processes (results are still reported in the same\n");
+    printf("                    order as without this option)\n");
     printf("            -V, --verbose\n");
     printf("                    show the match result for each file\n");
     printf("\n");
@@ -131,14 +143,152 @@ int callback(const char *filepath, coda_filefilter_status status, const char *er
     return 0;
 }
 
+#ifndef WIN32
+
+/* Parallel matching of files.
+ * Since the CODA library itself is not thread-safe, files are opened and matched against the filter by the worker
+ * processes of a worker_pool (see tools/common/workerpool.h), using coda_match_filefilter() on a single file.
+ * The main process walks the directory trees using the same directory walk as coda_match_filefilter() and submits
+ * each file to the pool. The walk only advances when a worker is available for a new file, so reading directory
+ * entries overlaps with the matching of files by the workers. Paths that could not be processed by the walk itself
+ * are added to the pool as already completed results. The pool passes all results to match_result() in the original
+ * order, so the output is the same as for a serial run.
+ */
+
+typedef struct worker_result_struct
+{
+    coda_filefilter_status status;
+    char *error;
+} worker_result;
+
+/* a match result is encoded as the status, a flag whether there is an error message, and the error message itself */
+static int encode_result(coda_filefilter_status status, const char *error, char **reply, long *reply_length)
+{
+    int value[2];
+
+    value[0] = (int)status;
+    value[1] = error != NULL;
+    *reply_length = (long)sizeof(value) + (error != NULL ? (long)strlen(error) : 0);
+    *reply = malloc(*reply_length);
+    if (*reply == NULL)
+    {
+        return -1;
+    }
+    memcpy(*reply, value, sizeof(value));
+    if (error != NULL)
+    {
+        memcpy(&(*reply)[sizeof(value)], error, strlen(error));
+    }
+
+    return 0;
+}
+
+static int worker_callback(const char *filepath, coda_filefilter_status status, const char *error, void *userdata)
+{
+    worker_result *result = (worker_result *)userdata;
+
+    (void)filepath;     /* prevent unused warning */
+
+    result->status = status;
+    if (error != NULL)
+    {
+        result->error = strdup(error);
+    }
+
+    return 0;
+}
+
+/* called in a worker process for each file that needs to be matched */
+static int match_request(const char *filepath, char **reply, long *reply_length, void *userdata)
+{
+    const char *filter = (const char *)userdata;
+    worker_result result;
+    int status;
+
+    result.status = coda_ffs_error;
+    result.error = NULL;
+    if (coda_match_filefilter(filter, 1, &filepath, worker_callback, &result) != 0)
+    {
+        result.status = coda_ffs_error;
+        result.error = strdup(coda_errno_to_string(coda_errno));
+    }
+    status = encode_result(result.status, result.error, reply, reply_length);
+    if (result.error != NULL)
+    {
+        free(result.error);
+    }
+
+    return status;
+}
+
+/* called in the main process for each result (in the order of the directory walk) */
+static int match_result(const char *filepath, const char *reply, long reply_length, void *userdata)
+{
+    int value[2];
+
+    (void)userdata;     /* prevent unused warning */
+
+    if (reply == NULL || reply_length < (long)sizeof(value))
+    {
+        return callback(filepath, coda_ffs_error, "worker process terminated unexpectedly", NULL);
+    }
+    memcpy(value, reply, sizeof(value));
+
+    /* the pool always terminates a reply with a '\0', so the error message can be used as is */
+    return callback(filepath, (coda_filefilter_status)value[0], value[1] ? &reply[sizeof(value)] : NULL, NULL);
+}
+
+/* called by the directory walk for each file that needs to be matched */
+static int walk_file(const char *filepath, void *userdata)
+{
+    return worker_pool_submit((worker_pool *)userdata, filepath);
+}
+
+/* called by the directory walk for each path that could not be processed */
+static int walk_error(const char *filepath, coda_filefilter_status status, const char *error, void *userdata)
+{
+    char *reply;
+    long reply_length;
+    int result;
+
+    if (encode_result(status, error, &reply, &reply_length) != 0)
+    {
+        fprintf(stderr, "ERROR: out of memory\n");
+        exit(1);
+    }
+    result = worker_pool_add_result((worker_pool *)userdata, filepath, reply, reply_length);
+    free(reply);
+
+    return result;
+}
+
+static int match_filefilter_parallel(const char *filter, int num_filepaths, const char **filepathlist, int num_jobs)
+{
+    worker_pool *pool;
+    int result;
+
+    pool = worker_pool_new(num_jobs, match_request, match_result, (void *)filter);
+    coda_filefilter_walk(num_filepaths, filepathlist, walk_file, walk_error, pool);
+
+    /* wait for the files that are still being matched (unless the callback stopped the processing) */
+    result = worker_pool_finish(pool);
+    worker_pool_delete(pool);
+
+    return result;
+}
+
+#endif
+
 int main(int argc, char *argv[])
 {
     char *filter = NULL;
     int perform_conversions;
+    int num_jobs;
     int i;
 
     verbosity = 0;
     perform_conversions = 1;
+    num_jobs = 1;
 
     if (argc == 1 || strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0)
     {
@@ -184,6 +334,18 @@ int main(int argc, char *argv[])
             filter = argv[i + 1];
             i++;
         }
+        else if ((strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "--jobs") == 0) && i + 1 < argc &&
+                 argv[i + 1][0] != '-')
+        {
+            num_jobs = atoi(argv[i + 1]);
+            if (num_jobs < 1)
+            {
+                fprintf(stderr, "ERROR: invalid number of jobs\n");
+                print_help();
+                exit(1);
+            }
+            i++;
+        }
         else if (strcmp(argv[i], "-V") == 0 || strcmp(argv[i], "--verbosity") == 0)
         {
             verbosity = 1;
@@ -218,7 +380,42 @@ int main(int argc, char *argv[])
 
     coda_set_option_perform_conversions(perform_conversions);
 
-    if (coda_match_filefilter(filter, argc - i, (const char **)&argv[i], &callback, NULL) != 0)
+    if (num_jobs > 1)
+    {
+#ifdef WIN32
+        fprintf(stderr, "ERROR: parallel matching of files is not supported on this platform\n");
+        exit(1);
+#else
+        coda_expression_type result_type;
+        coda_expression *expr;
+
+        /* verify the filter up front, such that errors are reported in the same way as for a serial run */
+        if (filter != NULL && filter[0] != '\0')
+        {
+            if (coda_expression_from_string(filter, &expr) != 0)
+            {
+                fprintf(stderr, "ERROR: %s\n", coda_errno_to_string(coda_errno));
+                exit(1);
+            }
+            if (coda_expression_get_type(expr, &result_type) != 0)
+            {
+                fprintf(stderr, "ERROR: %s\n", coda_errno_to_string(coda_errno));
+                exit(1);
+            }
+            coda_expression_delete(expr);
+            if (result_type != coda_expression_boolean)
+            {
+                fprintf(stderr, "ERROR: expression does not result in a boolean value\n");
+                exit(1);
+            }
+        }
+        if (match_filefilter_parallel(filter, argc - i, (const char **)&argv[i], num_jobs) != 0)
+        {
+            exit(1);
+        }
+#endif
+    }
+    else if (coda_match_filefilter(filter, argc - i, (const char **)&argv[i], &callback, NULL) != 0)
     {
         fprintf(stderr, "ERROR: %s\n", coda_errno_to_string(coda_errno));
         exit(1);
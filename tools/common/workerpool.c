@@ -0,0 +1,481 @@
+/*
+ * Copyright (C) 2007-2017 S[&]T, The Netherlands.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifndef WIN32
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "coda.h"
+#include "pipeio.h"
+#include "workerpool.h"
+
+#define MAX_PENDING_REQUESTS_PER_WORKER 8
+
+typedef struct worker_struct
+{
+    pid_t pid;
+    int request_fd;             /* pipe for sending requests to the worker */
+    int reply_fd;               /* pipe for receiving replies from the worker */
+    long entry_index;           /* index of the entry that is being handled by the worker (-1 if the worker is idle) */
+} worker;
+
+typedef struct worker_pool_entry_struct
+{
+    char *request;
+    char *reply;                /* NULL if the worker terminated unexpectedly */
+    long reply_length;
+    int done;
+} worker_pool_entry;
+
+struct worker_pool_struct
+{
+    int num_workers;
+    worker *workers;
+    struct pollfd *pollfds;
+    worker_pool_entry *entries; /* ring buffer (entry i is stored at entries[i % entries_size]) */
+    long entries_size;
+    long first_index;           /* index of the first entry that has not been passed to the result function yet */
+    long num_entries;           /* total number of entries that were added */
+    worker_pool_request_func request_func;
+    worker_pool_result_func result_func;
+    void *userdata;
+    int result;                 /* return value of the result function that stopped the processing (or 0) */
+};
+
+static void out_of_memory(void)
+{
+    fprintf(stderr, "ERROR: out of memory\n");
+    exit(1);
+}
+
+/* main loop of a worker process (never returns) */
+static void run_worker(worker_pool *pool, int request_fd, int reply_fd)
+{
+    char *request = NULL;
+    long request_size = 0;
+
+    for (;;)
+    {
+        char *reply;
+        long reply_length;
+        long length;
+
+        if (pipe_read_all(request_fd, &length, sizeof(length)) != 0)
+        {
+            /* no more requests */
+            break;
+        }
+        if (length + 1 > request_size)
+        {
+            request_size = length + 1;
+            request = realloc(request, request_size);
+            if (request == NULL)
+            {
+                _exit(1);
+            }
+        }
+        if (pipe_read_all(request_fd, request, length) != 0)
+        {
+            _exit(1);
+        }
+        request[length] = '\0';
+
+        reply = NULL;
+        reply_length = 0;
+        if (pool->request_func(request, &reply, &reply_length, pool->userdata) != 0)
+        {
+            _exit(1);
+        }
+        if (pipe_write_all(reply_fd, &reply_length, sizeof(reply_length)) != 0 ||
+            pipe_write_all(reply_fd, reply, reply_length) != 0)
+        {
+            _exit(1);
+        }
+        if (reply != NULL)
+        {
+            free(reply);
+        }
+    }
+
+    if (request != NULL)
+    {
+        free(request);
+    }
+    coda_done();
+
+    /* use _exit() such that the atexit handlers and stdio buffers inherited from the main process are left alone */
+    _exit(0);
+}
+
+static int start_worker(worker_pool *pool, int index)
+{
+    int request_pipe[2];
+    int reply_pipe[2];
+    pid_t pid;
+
+    if (pipe(request_pipe) != 0)
+    {
+        return -1;
+    }
+    if (pipe(reply_pipe) != 0)
+    {
+        close(request_pipe[0]);
+        close(request_pipe[1]);
+        return -1;
+    }
+
+    /* make sure that nothing is written twice when the child process flushes its copy of the stdio buffers */
+    fflush(NULL);
+
+    pid = fork();
+    if (pid < 0)
+    {
+        close(request_pipe[0]);
+        close(request_pipe[1]);
+        close(reply_pipe[0]);
+        close(reply_pipe[1]);
+        return -1;
+    }
+    if (pid == 0)
+    {
+        int i;
+
+        /* close the pipes of the other workers that were inherited from the main process */
+        for (i = 0; i < pool->num_workers; i++)
+        {
+            if (i != index && pool->workers[i].pid > 0)
+            {
+                close(pool->workers[i].request_fd);
+                close(pool->workers[i].reply_fd);
+            }
+        }
+        close(request_pipe[1]);
+        close(reply_pipe[0]);
+        run_worker(pool, request_pipe[0], reply_pipe[1]);
+    }
+
+    close(request_pipe[0]);
+    close(reply_pipe[1]);
+    pool->workers[index].pid = pid;
+    pool->workers[index].request_fd = request_pipe[1];
+    pool->workers[index].reply_fd = reply_pipe[0];
+    pool->workers[index].entry_index = -1;
+
+    return 0;
+}
+
+static void stop_worker(worker *worker)
+{
+    close(worker->request_fd);
+    close(worker->reply_fd);
+    waitpid(worker->pid, NULL, 0);
+    worker->pid = 0;
+    worker->entry_index = -1;
+}
+
+static void restart_worker(worker_pool *pool, int index)
+{
+    stop_worker(&pool->workers[index]);
+    if (start_worker(pool, index) != 0)
+    {
+        fprintf(stderr, "ERROR: could not start worker process (%s)\n", strerror(errno));
+        exit(1);
+    }
+}
+
+static void set_worker_failure(worker_pool_entry *entry)
+{
+    if (entry->reply != NULL)
+    {
+        free(entry->reply);
+    }
+    entry->reply = NULL;
+    entry->reply_length = 0;
+    entry->done = 1;
+}
+
+static void free_entry(worker_pool_entry *entry)
+{
+    free(entry->request);
+    if (entry->reply != NULL)
+    {
+        free(entry->reply);
+    }
+}
+
+/* pass all results that are available to the result function in the original order */
+static void flush_entries(worker_pool *pool)
+{
+    while (pool->first_index < pool->num_entries && pool->entries[pool->first_index % pool->entries_size].done)
+    {
+        worker_pool_entry *entry = &pool->entries[pool->first_index % pool->entries_size];
+
+        if (pool->result == 0)
+        {
+            pool->result = pool->result_func(entry->request, entry->reply, entry->reply_length, pool->userdata);
+        }
+        free_entry(entry);
+        pool->first_index++;
+    }
+}
+
+/* wait until at least one of the busy workers has finished and process the results */
+static void wait_for_results(worker_pool *pool)
+{
+    int k;
+
+    for (k = 0; k < pool->num_workers; k++)
+    {
+        pool->pollfds[k].fd = pool->workers[k].entry_index != -1 ? pool->workers[k].reply_fd : -1;
+        pool->pollfds[k].events = POLLIN;
+        pool->pollfds[k].revents = 0;
+    }
+    while (poll(pool->pollfds, pool->num_workers, -1) < 0)
+    {
+        if (errno != EINTR)
+        {
+            fprintf(stderr, "ERROR: could not wait for worker processes (%s)\n", strerror(errno));
+            exit(1);
+        }
+    }
+    for (k = 0; k < pool->num_workers; k++)
+    {
+        worker *worker = &pool->workers[k];
+        worker_pool_entry *entry;
+
+        if (pool->pollfds[k].fd == -1 || pool->pollfds[k].revents == 0)
+        {
+            continue;
+        }
+        entry = &pool->entries[worker->entry_index % pool->entries_size];
+        if (pipe_read_all(worker->reply_fd, &entry->reply_length, sizeof(entry->reply_length)) == 0 &&
+            entry->reply_length >= 0 && (entry->reply = malloc(entry->reply_length + 1)) != NULL &&
+            pipe_read_all(worker->reply_fd, entry->reply, entry->reply_length) == 0)
+        {
+            entry->reply[entry->reply_length] = '\0';
+            entry->done = 1;
+            worker->entry_index = -1;
+        }
+        else
+        {
+            /* the worker crashed (or did not respond properly) while handling this request */
+            set_worker_failure(entry);
+            restart_worker(pool, k);
+        }
+    }
+
+    flush_entries(pool);
+}
+
+/* add a new entry to the ring buffer (waiting for results of the workers if the ring buffer is full) */
+static worker_pool_entry *add_entry(worker_pool *pool, const char *request)
+{
+    worker_pool_entry *entry;
+
+    /* the oldest entry of a full ring buffer is always being handled by one of the workers */
+    while (pool->num_entries - pool->first_index >= pool->entries_size)
+    {
+        wait_for_results(pool);
+    }
+    entry = &pool->entries[pool->num_entries % pool->entries_size];
+    entry->request = strdup(request);
+    if (entry->request == NULL)
+    {
+        out_of_memory();
+    }
+    entry->reply = NULL;
+    entry->reply_length = 0;
+    entry->done = 0;
+    pool->num_entries++;
+
+    return entry;
+}
+
+/* Create a pool of num_workers worker processes.
+ * request_func is called in the worker processes and result_func in the main process (see workerpool.h).
+ */
+worker_pool *worker_pool_new(int num_workers, worker_pool_request_func request_func,
+                             worker_pool_result_func result_func, void *userdata)
+{
+    worker_pool *pool;
+    int k;
+
+    /* a failed write to a worker that terminated is handled via the return value of write() */
+    signal(SIGPIPE, SIG_IGN);
+
+    pool = malloc(sizeof(worker_pool));
+    if (pool == NULL)
+    {
+        out_of_memory();
+    }
+    pool->num_workers = num_workers;
+    pool->entries_size = (long)num_workers * MAX_PENDING_REQUESTS_PER_WORKER;
+    pool->first_index = 0;
+    pool->num_entries = 0;
+    pool->request_func = request_func;
+    pool->result_func = result_func;
+    pool->userdata = userdata;
+    pool->result = 0;
+    pool->workers = malloc(num_workers * sizeof(worker));
+    pool->pollfds = malloc(num_workers * sizeof(struct pollfd));
+    pool->entries = malloc(pool->entries_size * sizeof(worker_pool_entry));
+    if (pool->workers == NULL || pool->pollfds == NULL || pool->entries == NULL)
+    {
+        out_of_memory();
+    }
+    for (k = 0; k < num_workers; k++)
+    {
+        pool->workers[k].pid = 0;
+        pool->workers[k].entry_index = -1;
+    }
+    for (k = 0; k < num_workers; k++)
+    {
+        if (start_worker(pool, k) != 0)
+        {
+            fprintf(stderr, "ERROR: could not start worker process (%s)\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    return pool;
+}
+
+/* Give a request to the next idle worker (waiting for one of the workers to finish if all of them are busy) */
+int worker_pool_submit(worker_pool *pool, const char *request)
+{
+    worker_pool_entry *entry;
+    long length;
+    int k;
+
+    if (pool->result != 0)
+    {
+        return pool->result;
+    }
+
+    for (;;)
+    {
+        for (k = 0; k < pool->num_workers; k++)
+        {
+            if (pool->workers[k].entry_index == -1)
+            {
+                break;
+            }
+        }
+        if (k < pool->num_workers)
+        {
+            break;
+        }
+        wait_for_results(pool);
+    }
+
+    entry = add_entry(pool, request);
+    pool->workers[k].entry_index = pool->num_entries - 1;
+    length = (long)strlen(request);
+    if (pipe_write_all(pool->workers[k].request_fd, &length, sizeof(length)) != 0 ||
+        pipe_write_all(pool->workers[k].request_fd, request, length) != 0)
+    {
+        set_worker_failure(entry);
+        restart_worker(pool, k);
+        flush_entries(pool);
+    }
+
+    return pool->result;
+}
+
+/* Add a result for a request that was handled by the main process itself (keeping the order of the results) */
+int worker_pool_add_result(worker_pool *pool, const char *request, const char *reply, long reply_length)
+{
+    worker_pool_entry *entry;
+
+    if (pool->result != 0)
+    {
+        return pool->result;
+    }
+
+    entry = add_entry(pool, request);
+    entry->reply = malloc(reply_length + 1);
+    if (entry->reply == NULL)
+    {
+        out_of_memory();
+    }
+    memcpy(entry->reply, reply, reply_length);
+    entry->reply[reply_length] = '\0';
+    entry->reply_length = reply_length;
+    entry->done = 1;
+    flush_entries(pool);
+
+    return pool->result;
+}
+
+/* Wait until the results of all submitted requests have been passed to the result function */
+int worker_pool_finish(worker_pool *pool)
+{
+    while (pool->result == 0 && pool->first_index < pool->num_entries)
+    {
+        wait_for_results(pool);
+    }
+
+    return pool->result;
+}
+
+/* Stop all workers and release the pool (results that were not passed to the result function yet are discarded) */
+void worker_pool_delete(worker_pool *pool)
+{
+    int k;
+
+    for (k = 0; k < pool->num_workers; k++)
+    {
+        stop_worker(&pool->workers[k]);
+    }
+    while (pool->first_index < pool->num_entries)
+    {
+        free_entry(&pool->entries[pool->first_index % pool->entries_size]);
+        pool->first_index++;
+    }
+    free(pool->entries);
+    free(pool->workers);
+    free(pool->pollfds);
+    free(pool);
+}
+
+#endif
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2007-2017 S[&]T, The Netherlands.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+/* A pool of worker processes that handle requests (such as a filename) in parallel.
+ * Each request is handled by the next idle worker. The replies are passed to a result function in the main process in
+ * the order in which the requests were submitted. Pending results are kept in a ring buffer with a fixed number of
+ * entries per worker; submitting a request waits for the workers when the ring buffer is full.
+ * A worker that terminates unexpectedly is restarted and the request that it was handling is reported as failed.
+ * Fatal errors (out of memory, unable to start a worker process) are reported on stderr and terminate the program.
+ */
+
+typedef struct worker_pool_struct worker_pool;
+
+/* Handles a single request in a worker process.
+ * The reply should be allocated with malloc() (it will be freed by the worker pool) and may be NULL if the reply
+ * length is 0. Returning a non-zero value terminates the worker process (the request is then reported as failed).
+ */
+typedef int (*worker_pool_request_func) (const char *request, char **reply, long *reply_length, void *userdata);
+
+/* Receives the reply for a request in the main process (reply is NULL if the worker terminated unexpectedly).
+ * Returning a non-zero value stops the passing of any further results; this value is then returned by the
+ * worker_pool_submit(), worker_pool_add_result(), and worker_pool_finish() functions.
+ */
+typedef int (*worker_pool_result_func) (const char *request, const char *reply, long reply_length, void *userdata);
+
+worker_pool *worker_pool_new(int num_workers, worker_pool_request_func request_func,
+                             worker_pool_result_func result_func, void *userdata);
+int worker_pool_submit(worker_pool *pool, const char *request);
+int worker_pool_add_result(worker_pool *pool, const char *request, const char *reply, long reply_length);
+int worker_pool_finish(worker_pool *pool);
+void worker_pool_delete(worker_pool *pool);
+
+#endif